@@ -705,6 +705,15 @@ function(hpx_check_for_mm_prefetch)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_mm_stream)
+  add_hpx_config_test(
+    HPX_WITH_MM_STREAM
+    SOURCE cmake/tests/mm_stream.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_stable_inplace_merge)
   add_hpx_config_test(
@@ -0,0 +1,20 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__)
+#include <emmintrin.h>
+#endif
+
+int main()
+{
+    alignas(16) char buffer[16] = {};
+    __m128i value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(buffer));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(buffer), value);
+    _mm_sfence();
+}
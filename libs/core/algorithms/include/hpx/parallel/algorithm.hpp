@@ -30,6 +30,7 @@
 #include <hpx/parallel/algorithms/lexicographical_compare.hpp>
 #include <hpx/parallel/algorithms/make_heap.hpp>
 #include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/algorithms/move.hpp>
@@ -37,6 +38,8 @@
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partial_sort_copy.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/pop_heap_n.hpp>
+#include <hpx/parallel/algorithms/push_heap_n.hpp>
 #include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/algorithms/remove_copy.hpp>
 #include <hpx/parallel/algorithms/replace.hpp>
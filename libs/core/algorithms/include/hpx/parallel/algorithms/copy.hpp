@@ -326,6 +326,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/non_temporal_stores.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
@@ -361,8 +362,19 @@ namespace hpx::parallel {
             {
                 using hpx::get;
                 auto iters = part_begin.get_iterator_tuple();
-                util::copy_n<execution_policy_type>(
-                    get<0>(iters), part_size, get<1>(iters));
+                using in_iter = std::decay_t<decltype(get<0>(iters))>;
+                using out_iter = std::decay_t<decltype(get<1>(iters))>;
+                if constexpr (util::uses_non_temporal_copy_v<
+                                  execution_policy_type, in_iter, out_iter>)
+                {
+                    util::stream_copy_n(
+                        get<0>(iters), part_size, get<1>(iters));
+                }
+                else
+                {
+                    util::copy_n<execution_policy_type>(
+                        get<0>(iters), part_size, get<1>(iters));
+                }
             }
         };
 
@@ -499,12 +511,7 @@ namespace hpx::parallel {
                     util::foreach_partitioner<ExPolicy>::call(
                         HPX_FORWARD(ExPolicy, policy),
                         zip_iterator(first, dest), count,
-                        [](zip_iterator part_begin, std::size_t part_size,
-                            std::size_t) {
-                            auto iters = part_begin.get_iterator_tuple();
-                            util::copy_n<ExPolicy>(hpx::get<0>(iters),
-                                part_size, hpx::get<1>(iters));
-                        },
+                        copy_iteration<ExPolicy>(),
                         [](zip_iterator&& last) -> zip_iterator {
                             auto iters = last.get_iterator_tuple();
                             util::copy_synchronize(
@@ -0,0 +1,62 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge path partitioning: the merge of two sorted sequences of length
+    // len1 and len2 can be viewed as a path through a len1 x len2 grid. Every
+    // cross diagonal (i + j == diag) is crossed by the path exactly once,
+    // which splits the merged output into the first diag elements (taken from
+    // [first1, first1 + i) and [first2, first2 + j)) and the rest. Searching
+    // the crossing point on equidistant diagonals gives perfectly balanced
+    // and independent pieces of work, regardless of how the values of the
+    // two sequences are distributed.
+    //
+    // Returns the number of elements contributed by the first sequence to the
+    // first diag elements of the merged output. Equivalent elements of the
+    // first sequence precede the ones of the second sequence (stable merge).
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    constexpr std::size_t merge_path_search(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diag, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        std::size_t low = diag > len2 ? diag - len2 : 0;
+        std::size_t high = (std::min) (diag, len1);
+
+        while (low < high)
+        {
+            std::size_t const mid = low + (high - low) / 2;
+
+            // *(first1 + mid) belongs to the first diag elements if it is not
+            // greater than *(first2 + diag - mid - 1)
+            if (!HPX_INVOKE(comp,
+                    HPX_INVOKE(proj2, *(first2 + (diag - mid - 1))),
+                    HPX_INVOKE(proj1, *(first1 + mid))))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,388 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges smaller than this are sorted using the comparison based sort
+    inline constexpr std::size_t radix_sort_limit = 65536ul;
+
+    // The minimal number of elements handled by a single task
+    inline constexpr std::size_t radix_sort_min_chunk_size = 16384ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keys of these types are sorted by mapping them onto unsigned integers of
+    // the same size which preserve their ordering.
+    template <typename Key>
+    inline constexpr bool is_radix_sort_key_v =
+        (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) ||
+        (std::is_floating_point_v<Key> &&
+            std::numeric_limits<Key>::is_iec559 &&
+            (sizeof(Key) == sizeof(std::uint32_t) ||
+                sizeof(Key) == sizeof(std::uint64_t)));
+
+    template <typename Key, typename Enable = void>
+    struct radix_sort_unsigned
+    {
+        using type = std::make_unsigned_t<Key>;
+    };
+
+    template <typename Key>
+    struct radix_sort_unsigned<Key,
+        std::enable_if_t<std::is_floating_point_v<Key>>>
+    {
+        using type = std::conditional_t<sizeof(Key) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+    };
+
+    template <typename Key>
+    using radix_sort_unsigned_t = typename radix_sort_unsigned<Key>::type;
+
+    template <typename Key>
+    constexpr radix_sort_unsigned_t<Key> radix_sort_key(Key key) noexcept
+    {
+        using unsigned_type = radix_sort_unsigned_t<Key>;
+        constexpr unsigned_type sign_bit = unsigned_type(1)
+            << (std::numeric_limits<unsigned_type>::digits - 1);
+
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            // -0.0 and 0.0 compare equal, they have to map onto the same key
+            if (key == Key(0))
+                key = Key(0);
+
+            unsigned_type bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+            return (bits & sign_bit) ? static_cast<unsigned_type>(~bits) :
+                                       static_cast<unsigned_type>(
+                                           bits | sign_bit);
+        }
+        else if constexpr (std::is_signed_v<Key>)
+        {
+            return static_cast<unsigned_type>(
+                static_cast<unsigned_type>(key) ^ sign_bit);
+        }
+        else
+        {
+            return static_cast<unsigned_type>(key);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Direction of the sort implied by the comparison function: 1 for
+    // ascending, -1 for descending, and 0 if the comparison function is not
+    // known to compare the keys directly.
+    template <typename Comp, typename Key>
+    struct radix_sort_direction : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<hpx::parallel::detail::less, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::less<Key>, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::less<>, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<hpx::parallel::detail::greater, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::greater<Key>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_direction<std::greater<>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    // Projections which are known to extract the key from the elements
+    template <typename Proj>
+    struct is_radix_sort_projection : std::false_type
+    {
+    };
+
+    template <>
+    struct is_radix_sort_projection<hpx::identity> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename RandomIt, typename Comp, typename Proj,
+        typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename RandomIt, typename Comp, typename Proj>
+    struct is_radix_sortable<RandomIt, Comp, Proj,
+        std::enable_if_t<hpx::traits::is_random_access_iterator_v<RandomIt> &&
+            is_radix_sort_projection<std::decay_t<Proj>>::value &&
+            hpx::is_invocable_v<std::decay_t<Proj>&,
+                hpx::traits::iter_reference_t<RandomIt>>>>
+    {
+        using key_type = std::decay_t<hpx::util::invoke_result_t<
+            std::decay_t<Proj>&, hpx::traits::iter_reference_t<RandomIt>>>;
+        using value_type = hpx::traits::iter_value_t<RandomIt>;
+
+        static constexpr bool value = is_radix_sort_key_v<key_type> &&
+            radix_sort_direction<std::decay_t<Comp>, key_type>::value != 0 &&
+            std::is_default_constructible_v<value_type> &&
+            std::is_move_assignable_v<value_type>;
+    };
+
+    template <typename RandomIt, typename Comp, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        is_radix_sortable<RandomIt, Comp, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Exec, typename F>
+    void radix_sort_bulk(Exec& exec, std::size_t num_tasks, F&& f)
+    {
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(num_tasks));
+
+        auto&& workitems =
+            execution::bulk_async_execute(exec, HPX_FORWARD(F, f), shape);
+
+        hpx::wait_all(workitems);
+        util::detail::handle_local_exceptions<ExPolicy>::call(workitems);
+    }
+
+    // Parallel LSD radix sort using 8 bit digits. Each pass builds per-task
+    // histograms of the current digit, turns them into per-task output
+    // offsets (an exclusive scan in digit-major order), and scatters the
+    // elements to a buffer of the same size. Passes for digits which are
+    // equal for all keys are skipped. The sort is stable.
+    template <typename ExPolicy, typename Exec, typename RandomIt,
+        typename Proj>
+    void parallel_radix_sort(Exec& exec, RandomIt first, std::size_t count,
+        std::size_t cores, Proj proj, bool descending)
+    {
+        using value_type = hpx::traits::iter_value_t<RandomIt>;
+        using key_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            hpx::traits::iter_reference_t<RandomIt>>>;
+        using unsigned_type = radix_sort_unsigned_t<key_type>;
+
+        constexpr std::size_t radix_bits = 8;
+        constexpr std::size_t radix = std::size_t(1) << radix_bits;
+        constexpr std::size_t num_digits = sizeof(unsigned_type);
+
+        using histogram = std::array<std::size_t, radix>;
+
+        std::size_t const num_tasks = (std::max) (std::size_t(1),
+            (std::min) (cores, count / radix_sort_min_chunk_size));
+        std::size_t const chunk_size = (count + num_tasks - 1) / num_tasks;
+
+        unsigned_type const mask = descending ? unsigned_type(~unsigned_type(0)) :
+                                                unsigned_type(0);
+        auto const get_key = [&proj, mask](auto&& value) {
+            return static_cast<unsigned_type>(
+                radix_sort_key(static_cast<key_type>(
+                    HPX_INVOKE(proj, HPX_FORWARD(decltype(value), value)))) ^
+                mask);
+        };
+
+        // The first sweep builds the histograms for all digits at once, the
+        // totals decide which digits need to be sorted at all.
+        std::vector<histogram> histograms(num_tasks * num_digits);
+        radix_sort_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+            histogram* h = &histograms[task * num_digits];
+            std::fill(h, h + num_digits, histogram{});
+
+            std::size_t const begin = task * chunk_size;
+            std::size_t const end = (std::min) (begin + chunk_size, count);
+            for (RandomIt it = first + begin, last = first + end; it != last;
+                ++it)
+            {
+                unsigned_type const key = get_key(*it);
+                for (std::size_t d = 0; d != num_digits; ++d)
+                {
+                    ++h[d][(key >> (d * radix_bits)) & (radix - 1)];
+                }
+            }
+        });
+
+        std::array<bool, num_digits> skip_digit{};
+        for (std::size_t d = 0; d != num_digits; ++d)
+        {
+            for (std::size_t bucket = 0; bucket != radix; ++bucket)
+            {
+                std::size_t total = 0;
+                for (std::size_t task = 0; task != num_tasks; ++task)
+                {
+                    total += histograms[task * num_digits + d][bucket];
+                }
+                if (total != 0)
+                {
+                    skip_digit[d] = (total == count);
+                    break;
+                }
+            }
+        }
+
+        std::vector<value_type> buffer(count);
+
+        // runs one scatter pass from src to dst
+        auto const scatter = [&](std::size_t digit, auto src, auto dst) {
+            radix_sort_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+                histogram offsets = histograms[task * num_digits + digit];
+
+                std::size_t const begin = task * chunk_size;
+                std::size_t const end = (std::min) (begin + chunk_size, count);
+                std::size_t const shift = digit * radix_bits;
+                for (auto it = src + begin, last = src + end; it != last; ++it)
+                {
+                    std::size_t const bucket =
+                        (get_key(*it) >> shift) & (radix - 1);
+                    *(dst + offsets[bucket]++) = HPX_MOVE(*it);
+                }
+            });
+        };
+
+        // rebuilds the histograms of the given digit from src
+        auto const count_digit = [&](std::size_t digit, auto src) {
+            radix_sort_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+                histogram& h = histograms[task * num_digits + digit];
+                h.fill(0);
+
+                std::size_t const begin = task * chunk_size;
+                std::size_t const end = (std::min) (begin + chunk_size, count);
+                std::size_t const shift = digit * radix_bits;
+                for (auto it = src + begin, last = src + end; it != last; ++it)
+                {
+                    ++h[(get_key(*it) >> shift) & (radix - 1)];
+                }
+            });
+        };
+
+        bool in_buffer = false;
+        bool first_pass = true;
+        for (std::size_t digit = 0; digit != num_digits; ++digit)
+        {
+            if (skip_digit[digit])
+                continue;
+
+            // the histograms of the first sweep are valid for the first
+            // pass only, the elements have been moved after that
+            if (!first_pass)
+            {
+                if (in_buffer)
+                    count_digit(digit, buffer.data());
+                else
+                    count_digit(digit, first);
+            }
+            first_pass = false;
+
+            // turn the counts into the offsets at which each task stores its
+            // elements
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != radix; ++bucket)
+            {
+                for (std::size_t task = 0; task != num_tasks; ++task)
+                {
+                    std::size_t& h =
+                        histograms[task * num_digits + digit][bucket];
+                    std::size_t const c = h;
+                    h = offset;
+                    offset += c;
+                }
+            }
+
+            if (in_buffer)
+                scatter(digit, buffer.data(), first);
+            else
+                scatter(digit, first, buffer.data());
+
+            in_buffer = !in_buffer;
+        }
+
+        // move the elements back if an odd number of passes was needed
+        if (in_buffer)
+        {
+            radix_sort_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+                std::size_t const begin = task * chunk_size;
+                std::size_t const end = (std::min) (begin + chunk_size, count);
+                std::move(buffer.begin() + begin, buffer.begin() + end,
+                    first + begin);
+            });
+        }
+    }
+
+    // Asynchronously sort the given range, Comp has to be a comparison
+    // function for which is_radix_sortable_v holds
+    template <typename Comp, typename ExPolicy, typename RandomIt,
+        typename Proj>
+    hpx::future<RandomIt> parallel_radix_sort_async(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj)
+    {
+        using key_type = typename is_radix_sortable<RandomIt, Comp,
+            Proj>::key_type;
+        constexpr bool descending =
+            radix_sort_direction<std::decay_t<Comp>, key_type>::value < 0;
+
+        std::size_t const count = last - first;
+        std::size_t const cores =
+            hpx::execution::experimental::processing_units_count(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, count);
+
+        return execution::async_execute(policy.executor(),
+            [exec = policy.executor(), first, last, count, cores,
+                proj = HPX_FORWARD(Proj, proj)]() mutable -> RandomIt {
+                parallel_radix_sort<std::decay_t<ExPolicy>>(
+                    exec, first, count, cores, HPX_MOVE(proj), descending);
+                return last;
+            });
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
 #include <cstddef>
@@ -17,6 +18,31 @@
 
 namespace hpx::parallel::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Marks a reduction operation which may be associative only (as for the
+    // scan algorithms). The elements have to be combined in order, this rules
+    // out combining vector packs element-wise (see datapar/reduce.hpp).
+    template <typename Reduce>
+    struct ordered_reduce_op
+    {
+        template <typename T1, typename T2>
+        constexpr auto operator()(T1&& t1, T2&& t2)
+            -> hpx::util::invoke_result_t<Reduce&, T1, T2>
+        {
+            return HPX_INVOKE(r_, HPX_FORWARD(T1, t1), HPX_FORWARD(T2, t2));
+        }
+
+        Reduce r_;
+    };
+
+    template <typename Reduce>
+    inline constexpr bool is_ordered_reduce_op_v = false;
+
+    template <typename Reduce>
+    inline constexpr bool is_ordered_reduce_op_v<ordered_reduce_op<Reduce>> =
+        true;
+
+    ///////////////////////////////////////////////////////////////////////////
     template <typename ExPolicy>
     struct sequential_reduce_t final
       : hpx::functional::detail::tag_fallback<sequential_reduce_t<ExPolicy>>
@@ -7,21 +7,108 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/rfa.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <cmath>
 #include <cstddef>
-#include <cstring>
+#include <functional>
 #include <limits>
 #include <type_traits>
 #include <utility>
-#include "rfa.hpp"
 
 namespace hpx::parallel::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The accumulator used for reproducible sums of values of type T
+    template <typename T>
+    using deterministic_accumulator =
+        rfa::reproducible_floating_accumulator<T>;
+
+    // Sums are computed reproducibly if the executor parameters of the
+    // execution policy ask for it (see
+    // hpx::execution::experimental::deterministic_reduction), the values are
+    // of a floating point type supported by the accumulator, and they are
+    // combined using std::plus.
+    template <typename T, typename Reduce>
+    inline constexpr bool is_deterministic_sum_v =
+        (std::is_same_v<T, float> || std::is_same_v<T, double>) &&
+        (std::is_same_v<std::decay_t<Reduce>, std::plus<>> ||
+            std::is_same_v<std::decay_t<Reduce>, std::plus<T>>);
+
+    // The accumulator to use for reproducible sums of values of type T,
+    // combined using Reduce. This is an empty type if the sum can't be
+    // computed reproducibly.
+    template <typename T, typename Reduce, typename Enable = void>
+    struct deterministic_accumulator_for
+    {
+        using type = hpx::util::unused_type;
+    };
+
+    template <typename T, typename Reduce>
+    struct deterministic_accumulator_for<T, Reduce,
+        std::enable_if_t<is_deterministic_sum_v<T, Reduce>>>
+    {
+        using type = deterministic_accumulator<T>;
+    };
+
+    template <typename ExPolicy>
+    inline constexpr bool has_deterministic_reduction_v =
+        hpx::execution::experimental::extract_has_deterministic_reduction_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type>;
+
+    template <typename ExPolicy, typename T, typename Reduce>
+    inline constexpr bool uses_deterministic_reduction_v =
+        has_deterministic_reduction_v<ExPolicy> &&
+        is_deterministic_sum_v<T, Reduce>;
+
+    // Deposit conv(*it) for all it in [first, first + count) into the given
+    // accumulator. The accumulator is renormalized on return.
+    template <typename T, typename Iter, typename Conv>
+    void deterministic_accumulate_n(deterministic_accumulator<T>& acc,
+        Iter first, std::size_t count, Conv&& conv)
+    {
+        T max_abs_val = static_cast<T>(0.0);
+        std::size_t deposits = 0;
+        for (/* */; count != 0; (void) --count, ++first)
+        {
+            T const val = static_cast<T>(HPX_INVOKE(conv, *first));
+            T const abs_val = std::abs(val);
+            if (max_abs_val < abs_val)
+            {
+                acc.set_max_abs_val(abs_val);
+                max_abs_val = abs_val;
+            }
+
+            acc.unsafe_add(val);
+            if (++deposits == acc.endurance())
+            {
+                acc.renorm();
+                deposits = 0;
+            }
+        }
+        acc.renorm();
+    }
+
+    // Combine the initial value and the accumulators of all partitions, the
+    // result does not depend on their order.
+    template <typename T, typename Results>
+    T deterministic_sum(T const& init, Results const& results)
+    {
+        deterministic_accumulator<T> acc;
+        acc += init;
+        for (auto const& result : results)
+        {
+            acc += result;
+        }
+        return acc.conv();
+    }
+
     template <typename ExPolicy>
     struct sequential_reduce_deterministic_t final
       : hpx::functional::detail::tag_fallback<
@@ -37,9 +124,6 @@ namespace hpx::parallel::detail {
             /// TODO: Put constraint on Reduce to be a binary plus operator
             (void) r;
 
-            // hpx_rfa_bin_host_buffer should be initialized by the frontend of
-            // this method
-
             hpx::parallel::detail::rfa::reproducible_floating_accumulator<T>
                 rfa;
             rfa.set_max_abs_val(init);
@@ -80,9 +164,6 @@ namespace hpx::parallel::detail {
                 ExPolicy&&, InIterB first, std::size_t partition_size, T init,
                 std::true_type&&)
         {
-            // hpx_rfa_bin_host_buffer should be initialized by the frontend of
-            // this method
-
             hpx::parallel::detail::rfa::reproducible_floating_accumulator<T>
                 rfa;
             rfa.zero();
@@ -115,9 +196,6 @@ namespace hpx::parallel::detail {
             sequential_reduce_deterministic_rfa_t, ExPolicy&&, InIterB first,
             std::size_t partition_size, T init, std::false_type&&)
         {
-            // hpx_rfa_bin_host_buffer should be initialized by the frontend of
-            // this method
-
             T rfa;
             rfa.zero();
             rfa += init;
@@ -176,6 +176,11 @@ namespace hpx::parallel::detail::rfa {
             return bins[d];
         }
 
+        constexpr ftype const& operator[](int d) const
+        {
+            return bins[d];
+        }
+
         void initialize_bins()
         {
             if constexpr (std::is_same_v<ftype, float>)
@@ -199,7 +204,17 @@ namespace hpx::parallel::detail::rfa {
         }
     };
 
-    static char hpx_rfa_bin_host_buffer[sizeof(RFA_bins<double>)];
+    // The reference bins are computed once for each floating point type
+    template <class ftype>
+    RFA_bins<ftype> const& get_rfa_bins()
+    {
+        static RFA_bins<ftype> const bins = [] {
+            RFA_bins<ftype> b;
+            b.initialize_bins();
+            return b;
+        }();
+        return bins;
+    }
 
     ///Class to hold a reproducible summation of the numbers passed to it
     ///
@@ -249,8 +264,7 @@ namespace hpx::parallel::detail::rfa {
         ///Return a binned floating-point reference bin
         inline const ftype* binned_bins(const int x) const
         {
-            return &reinterpret_cast<RFA_bins<ftype>&>(
-                hpx_rfa_bin_host_buffer)[x];
+            return &get_rfa_bins<ftype>()[x];
         }
 
         ///Get the bit representation of a float
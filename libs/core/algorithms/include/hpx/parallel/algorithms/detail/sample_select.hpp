@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges smaller than this are handled sequentially
+    inline constexpr std::size_t sample_select_limit = 1ul << 16;
+
+    // The maximal number of elements drawn as a sample from the range
+    inline constexpr std::size_t sample_select_sample_size = 1ul << 14;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rearrange [first, last) such that *nth is the element which would be
+    // there if the range was sorted, all elements before nth are not greater
+    // and all elements after nth are not less than *nth.
+    //
+    // Every round draws a random sample, sorts it, and selects two splitters
+    // from the sample which enclose the requested position with high
+    // probability. Two parallel partitioning passes classify the range into
+    // the elements less than the lower splitter, the ones between both
+    // splitters, and the ones greater than the upper splitter. Only the
+    // bucket holding nth is processed further, the bucket between the
+    // splitters is expected to be much smaller than the input. Long runs of
+    // equivalent elements end up in the middle bucket and are never touched
+    // again.
+    template <typename ExPolicy, typename RandomIt, typename Pred,
+        typename Proj>
+    void parallel_sample_select(ExPolicy& policy, RandomIt first,
+        RandomIt nth, RandomIt last, Pred& pred, Proj& proj)
+    {
+        using value_type = std::decay_t<decltype(HPX_INVOKE(proj, *first))>;
+
+        std::mt19937_64 gen(static_cast<std::uint64_t>(last - first));
+
+        // if a round did not reduce the size of the range, the next one falls
+        // back to a single splitter
+        bool narrow = false;
+        while (static_cast<std::size_t>(last - first) >= sample_select_limit)
+        {
+            auto const count = static_cast<std::size_t>(last - first);
+            auto const rank = static_cast<std::size_t>(nth - first);
+
+            std::size_t const sample_size =
+                (std::min) (sample_select_sample_size, count / 16);
+
+            std::uniform_int_distribution<std::size_t> dist(0, count - 1);
+            std::vector<value_type> sample;
+            sample.reserve(sample_size);
+            for (std::size_t i = 0; i != sample_size; ++i)
+            {
+                sample.push_back(HPX_INVOKE(proj, *(first + dist(gen))));
+            }
+            std::sort(sample.begin(), sample.end(),
+                [&](value_type const& lhs, value_type const& rhs) {
+                    return HPX_INVOKE(pred, lhs, rhs);
+                });
+
+            // the rank of nth in the sample has a standard deviation of at
+            // most sqrt(sample_size) / 2, the splitters are three standard
+            // deviations away from its expected position
+            std::size_t const pos = rank * sample_size / count;
+            std::size_t const delta = narrow ?
+                0 :
+                static_cast<std::size_t>(
+                    1.5 * std::sqrt(static_cast<double>(sample_size)));
+
+            value_type const& lower = sample[pos > delta ? pos - delta : 0];
+            value_type const& upper =
+                sample[(std::min) (pos + delta, sample_size - 1)];
+
+            // the lower bucket can't hold all elements as the lower splitter
+            // itself is not part of it
+            RandomIt const middle_first =
+                partition<RandomIt>().call(policy(hpx::execution::non_task),
+                    first, last,
+                    [&](value_type const& value) {
+                        return HPX_INVOKE(pred, value, lower);
+                    },
+                    proj);
+
+            if (nth < middle_first)
+            {
+                narrow = false;
+                last = middle_first;
+                continue;
+            }
+
+            // the middle bucket holds at least the upper splitter
+            RandomIt const middle_last =
+                partition<RandomIt>().call(policy(hpx::execution::non_task),
+                    middle_first, last,
+                    [&](value_type const& value) {
+                        return !HPX_INVOKE(pred, upper, value);
+                    },
+                    proj);
+
+            if (nth >= middle_last)
+            {
+                narrow = false;
+                first = middle_last;
+                continue;
+            }
+
+            // all elements of the middle bucket are equivalent
+            if (!HPX_INVOKE(pred, lower, upper))
+            {
+                return;
+            }
+
+            narrow = middle_first == first && middle_last == last;
+            first = middle_first;
+            last = middle_last;
+        }
+
+        std::nth_element(first, nth, last,
+            util::compare_projected<Pred&, Proj&>(pred, proj));
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -1,4 +1,4 @@
-//  Copyright (c) 2007-2024 Hartmut Kaiser
+//  Copyright (c) 2007-2026 Hartmut Kaiser
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -7,279 +7,267 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/assert.hpp>
 #include <hpx/functional/invoke.hpp>
 
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/clear_container.hpp>
-#include <hpx/parallel/util/foreach_partitioner.hpp>
-#include <hpx/parallel/util/partitioner.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#else
-#include <memory>
-#endif
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/timing/steady_clock.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
+    // The minimal number of input elements handled by a single task
+    inline constexpr std::size_t set_operation_min_chunk_size = 2048ul;
+
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // An output iterator which counts the elements written through it without
+    // storing them.
+    struct set_operation_counter
     {
-        template <typename T>
-        class rewritable_ref
-        {
-        public:
-            rewritable_ref() = default;
-
-            explicit constexpr rewritable_ref(T const& item) noexcept
-              : item_(&item)
-            {
-            }
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
 
-            rewritable_ref& operator=(T const& item)
+        struct proxy
+        {
+            template <typename T>
+            constexpr proxy& operator=(T&&) noexcept
             {
-                item_ = &item;
                 return *this;
             }
+        };
 
-            // different versions of clang-format produce different results
-            // clang-format off
-            operator T const&() const
-            {
-                HPX_ASSERT(item_ != nullptr);
-                return *item_;
-            }
-            // clang-format on
+        constexpr proxy operator*() const noexcept
+        {
+            return proxy{};
+        }
 
-        private:
-            T const* item_ = nullptr;
-        };
+        constexpr set_operation_counter& operator++() noexcept
+        {
+            ++count;
+            return *this;
+        }
+
+        constexpr set_operation_counter operator++(int) noexcept
+        {
+            set_operation_counter tmp = *this;
+            ++count;
+            return tmp;
+        }
 
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
-        using type = std::conditional_t<std::is_scalar_v<value_type>,
-            value_type, rewritable_ref<value_type>>;
+        std::size_t count = 0;
     };
 
-    struct set_chunk_data
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the positions in both input sequences at which the output of a set
+    // operation can be split into two independent parts, close to the cross
+    // diagonal diag of the merge path.
+    //
+    // The sequential set operations pair the n-th element of a group of
+    // equivalent elements in the first sequence with the n-th equivalent
+    // element in the second sequence. The merge path may split such a group
+    // anywhere, the split is therefore moved such that it separates the
+    // group between two of those pairs.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_split(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t diag,
+        F& f, Proj1& proj1, Proj2& proj2)
     {
-        static constexpr std::size_t uninit_start =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_len = static_cast<std::size_t>(0);
-        static constexpr std::size_t uninit_start_index =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first1 =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first2 =
-            static_cast<std::size_t>(-1);
-
-        std::size_t start = uninit_start;
-        std::size_t len = uninit_len;
-        std::size_t start_index = uninit_start_index;
-        std::size_t first1 = uninit_first1;
-        std::size_t first2 = uninit_first2;
-    };
+        std::size_t const i = merge_path_search(
+            first1, len1, first2, len2, diag, f, proj1, proj2);
+        std::size_t const j = diag - i;
+
+        if (i == len1 && j == len2)
+        {
+            return {i, j};
+        }
+
+        auto split_at = [&](auto const& key) -> std::pair<std::size_t,
+                                                 std::size_t> {
+            // the equivalent elements in front of the split
+            std::size_t const begin1 = static_cast<std::size_t>(
+                detail::lower_bound(first1, first1 + i, key, f, proj1) -
+                first1);
+            std::size_t const begin2 = static_cast<std::size_t>(
+                detail::lower_bound(first2, first2 + j, key, f, proj2) -
+                first2);
+
+            // all equivalent elements
+            std::size_t const end1 = static_cast<std::size_t>(
+                detail::upper_bound(first1 + i, first1 + len1, key, f, proj1) -
+                first1);
+            std::size_t const end2 = static_cast<std::size_t>(
+                detail::upper_bound(first2 + j, first2 + len2, key, f, proj2) -
+                first2);
+
+            std::size_t const pairs = (i - begin1 + j - begin2 + 1) / 2;
+            return {begin1 + (std::min) (pairs, end1 - begin1),
+                begin2 + (std::min) (pairs, end2 - begin2)};
+        };
+
+        // the group is determined by the element following the split in the
+        // merged sequence
+        if (i != len1 &&
+            (j == len2 ||
+                !HPX_INVOKE(f, HPX_INVOKE(proj2, *(first2 + j)),
+                    HPX_INVOKE(proj1, *(first1 + i)))))
+        {
+            return split_at(HPX_INVOKE(proj1, *(first1 + i)));
+        }
+        return split_at(HPX_INVOKE(proj2, *(first2 + j)));
+    }
+
+    template <typename ExPolicy, typename Exec, typename F>
+    void set_operation_bulk(Exec& exec, std::size_t num_tasks, F&& f)
+    {
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(num_tasks));
+
+        auto&& workitems =
+            execution::bulk_async_execute(exec, HPX_FORWARD(F, f), shape);
+
+        hpx::wait_all(workitems);
+        util::detail::handle_local_exceptions<ExPolicy>::call(workitems);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
+    // Both input sequences are split into pieces using merge path
+    // partitioning. Every piece is processed twice by the sequential set
+    // operation: the first pass only counts the generated elements, the
+    // second pass writes them directly to their final position, which is
+    // determined by a prefix sum over the counts.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename F, typename Proj1,
-        typename Proj2, typename Combiner, typename SetOp>
+        typename Proj2, typename SetOp>
     util::detail::algorithm_result_t<ExPolicy,
         util::in_in_out_result<Iter1, Iter2, Iter3>>
     set_operation(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2,
-        Combiner&& combiner, SetOp&& setop)
+        SetOp&& setop)
     {
         using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-        using difference_type1 =
-            typename std::iterator_traits<Iter1>::difference_type;
-        using difference_type2 =
-            typename std::iterator_traits<Iter2>::difference_type;
-
-        // allocate intermediate buffers
-        difference_type1 len1 = detail::distance(first1, last1);
-        difference_type2 len2 = detail::distance(first2, last2);
-
-        using buffer_type = typename set_operations_buffer<Iter3>::type;
+        auto const len1 =
+            static_cast<std::size_t>(detail::distance(first1, last1));
+        auto const len2 =
+            static_cast<std::size_t>(detail::distance(first2, last2));
+        std::size_t const count = len1 + len2;
 
-        std::size_t cores =
+        std::size_t const cores =
             hpx::execution::experimental::processing_units_count(
                 policy.parameters(), policy.executor(),
-                hpx::chrono::null_duration, (std::min) (len1, len2));
-
-        std::size_t const step = (len1 + cores - 1) / cores;
-
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
-#else
-        boost::shared_array<buffer_type> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
-#endif
-
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t const part_size) mutable -> void {
-            HPX_ASSERT(part_size == 1);
-            HPX_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 =
-                (std::min) (start1 + step, static_cast<std::size_t>(len1));
-
-            if (start1 >= end1)
+                hpx::chrono::null_duration, count);
+
+        std::size_t const num_tasks = (std::max) (std::size_t(1),
+            (std::min) (cores, count / set_operation_min_chunk_size));
+
+        auto run = [exec = policy.executor(), num_tasks, first1, len1, first2,
+                       len2, dest, f = HPX_FORWARD(F, f),
+                       proj1 = HPX_FORWARD(Proj1, proj1),
+                       proj2 = HPX_FORWARD(Proj2, proj2),
+                       setop = HPX_FORWARD(SetOp, setop)]() mutable
+            -> result_type {
+            using exec_policy = std::decay_t<ExPolicy>;
+
+            // a single piece is processed by the sequential set operation
+            // directly, neither splitting nor counting is needed
+            if (num_tasks == 1)
             {
-                return;
-            }
-
-            bool const first_partition = start1 == 0;
-            bool const last_partition = end1 == static_cast<std::size_t>(len1);
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all elements of
-                // this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
+                try
                 {
-                    return;
+                    auto r = setop(first1, first1 + len1, first2, first2 + len2,
+                        dest, f);
+                    return result_type{r.in1, r.in2, r.out};
                 }
-
-                // move backwards to find earliest element which is equal to the
-                // last element of the current chunk
-                if (end1 != 0)
+                catch (...)
                 {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
+                    util::detail::handle_local_exceptions<exec_policy>::call(
+                        std::current_exception());
                 }
             }
 
-            // move backwards to find earliest element which is equal to the
-            // first element of the current chunk
-            if (start1 != 0)
+            // splits[task] holds the start of the pieces of task
+            std::vector<std::pair<std::size_t, std::size_t>> splits(
+                num_tasks + 1);
+            splits[0] = {0, 0};
+            splits[num_tasks] = {len1, len2};
+
+            set_operation_bulk<exec_policy>(
+                exec, num_tasks - 1, [&](std::size_t task) {
+                    splits[task + 1] = set_operation_split(first1, len1,
+                        first2, len2, (task + 1) * (len1 + len2) / num_tasks,
+                        f, proj1, proj2);
+                });
+
+            // count the elements generated for each of the pieces
+            std::vector<std::size_t> offsets(num_tasks + 1);
+            std::vector<result_type> results(num_tasks);
+
+            set_operation_bulk<exec_policy>(
+                exec, num_tasks, [&](std::size_t task) {
+                    auto const [begin1, begin2] = splits[task];
+                    auto const [end1, end2] = splits[task + 1];
+
+                    offsets[task + 1] = setop(first1 + begin1, first1 + end1,
+                        first2 + begin2, first2 + end2,
+                        set_operation_counter{}, f)
+                                            .out.count;
+                });
+
+            for (std::size_t task = 0; task != num_tasks; ++task)
             {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
+                offsets[task + 1] += offsets[task];
             }
 
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
-            {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
+            // generate the output directly into the destination
+            set_operation_bulk<exec_policy>(
+                exec, num_tasks, [&](std::size_t task) {
+                    auto const [begin1, begin2] = splits[task];
+                    auto const [end1, end2] = splits[task + 1];
 
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
-            }
+                    auto r = setop(first1 + begin1, first1 + end1,
+                        first2 + begin2, first2 + end2,
+                        std::next(dest, offsets[task]), f);
+                    results[task] = result_type{r.in1, r.in2, r.out};
+                });
 
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
+            // the last piece determines the positions reached in the input
+            return results.back();
         };
 
-        // second step, is executed after all partitions are done running
-
-        // different versions of clang-format produce different formatting
-        // clang-format off
-        auto f2 = [buffer, chunks, cores, first1, first2, dest](
-                      auto&& data) -> result_type {
-            // clang-format on
-
-            // make sure iterators embedded in function object that is attached
-            // to futures are invalidated
-            util::detail::clear_container(data);
-
-            // accumulate real length and rightmost positions in input sequences
-            std::size_t first1_pos = 0;
-            std::size_t first2_pos = 0;
-
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
-            {
-                set_chunk_data const* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != static_cast<std::size_t>(-1))
-                {
-                    first1_pos = (std::max) (first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != static_cast<std::size_t>(-1))
-                {
-                    first2_pos = (std::max) (first2_pos, curr_chunk->first2);
-                }
-            }
-
-            // finally, copy data to destination
-            parallel::util::
-                foreach_partitioner<hpx::execution::parallel_policy>::call(
-                    hpx::execution::par, chunks.get(), cores,
-                    [buffer, dest](
-                        set_chunk_data* ch, std::size_t, std::size_t) {
-                        if (ch->start == set_chunk_data::uninit_start ||
-                            ch->start_index ==
-                                set_chunk_data::uninit_start_index ||
-                            ch->len == set_chunk_data::uninit_len)
-                        {
-                            return;
-                        }
-                        std::copy(buffer.get() + ch->start,
-                            buffer.get() + ch->start + ch->len,
-                            dest + ch->start_index);
-                    },
-                    [](set_chunk_data* last) -> set_chunk_data* {
-                        return last;
-                    });
-
-            return {std::next(first1, first1_pos),
-                std::next(first2, first2_pos),
-                std::next(dest, chunk->start_index + chunk->len)};
-        };
-
-        // fill the buffer piecewise
-        return parallel::util::partitioner<ExPolicy, result_type, void>::call(
-            policy, chunks.get(), cores, HPX_MOVE(f1), HPX_MOVE(f2));
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return util::detail::algorithm_result<ExPolicy, result_type>::get(
+                execution::async_execute(policy.executor(), HPX_MOVE(run)));
+        }
+        else
+        {
+            return util::detail::algorithm_result<ExPolicy, result_type>::get(
+                run());
+        }
     }
 
     /// \endcond
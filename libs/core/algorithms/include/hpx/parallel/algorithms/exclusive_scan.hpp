@@ -297,6 +297,7 @@ namespace hpx {
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -403,51 +404,93 @@ namespace hpx::parallel {
 
                 using hpx::get;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-                    *dst++ = val;
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                // step 4 use this return value
+                auto f4 = [last_iter, final_dest](std::vector<T>&&,
+                              std::vector<hpx::future<void>>&& data) {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    util::detail::clear_container(data);
+                    return util::in_out_result<FwdIter1, FwdIter2>{
+                        last_iter, final_dest};
                 };
 
-                return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
-                    call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        zip_iterator(first, dest), count, init,
-                        // step 1 performs first part of scan algorithm
-                        [op, last](zip_iterator part_begin,
-                            std::size_t part_size) -> T {
-                            T part_init = get<0>(*part_begin++);
-
-                            auto iters = part_begin.get_iterator_tuple();
-                            if (get<0>(iters) != last)
-                            {
-                                return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
-                            }
-                            return part_init;
-                        },
-                        // step 2 propagates the partition results from left
-                        // to right
-                        op,
-                        // step 3 runs final accumulation on each partition
-                        HPX_MOVE(f3),
-                        // step 4 use this return value
-                        [last_iter, final_dest](std::vector<T>&&,
-                            std::vector<hpx::future<void>>&& data) {
-                            // make sure iterators embedded in function object that is
-                            // attached to futures are invalidated
-                            util::detail::clear_container(data);
-                            return util::in_out_result<FwdIter1, FwdIter2>{
-                                last_iter, final_dest};
-                        });
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  ExPolicy> ||
+                    util::uses_single_pass_scan_v<ExPolicy>)
+                {
+                    // The first step only reduces each partition (using the
+                    // vectorized reduction), the third step scans it starting
+                    // off the accumulated value. This touches the destination
+                    // only once. The single-pass scan relies on this as well,
+                    // it reads its input from memory once only.
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 reduces each partition
+                            [op](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                FwdIter1 src =
+                                    get<0>(part_begin.get_iterator_tuple());
+                                T part_init = *src;
+                                return sequential_reduce<
+                                    std::decay_t<ExPolicy>>(++src,
+                                    part_size - 1, part_init,
+                                    ordered_reduce_op<std::decay_t<Op>>{op});
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 scans each partition
+                            [op](zip_iterator part_begin, std::size_t part_size,
+                                T val) mutable -> void {
+                                auto iters = part_begin.get_iterator_tuple();
+                                sequential_exclusive_scan_n(get<0>(iters),
+                                    part_size, get<1>(iters), val, op);
+                            },
+                            HPX_MOVE(f4));
+                }
+                else
+                {
+                    auto f3 = [op](zip_iterator part_begin,
+                                  std::size_t part_size,
+                                  T val) mutable -> void {
+                        FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
+                        *dst++ = val;
+
+                        // MSVC 2015 fails if op is captured by reference
+                        util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
+                            [=, &val](FwdIter2 it) mutable -> void {
+                                *it = HPX_INVOKE(op, val, *it);
+                            });
+                    };
+
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 performs first part of scan algorithm
+                            [op, last](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                T part_init = get<0>(*part_begin++);
+
+                                auto iters = part_begin.get_iterator_tuple();
+                                if (get<0>(iters) != last)
+                                {
+                                    return sequential_exclusive_scan_n(
+                                        get<0>(iters), part_size - 1,
+                                        get<1>(iters), part_init, op);
+                                }
+                                return part_init;
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 runs final accumulation on each partition
+                            HPX_MOVE(f3), HPX_MOVE(f4));
+                }
             }
         };
         /// \endcond
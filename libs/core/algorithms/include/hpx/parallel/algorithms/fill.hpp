@@ -167,6 +167,8 @@ namespace hpx {
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/non_temporal_stores.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -180,6 +182,32 @@ namespace hpx::parallel {
     // fill
     namespace detail {
         /// \cond NOINTERNAL
+        template <typename ExPolicy, typename FwdIter, typename T>
+        decltype(auto) parallel_stream_fill_n(
+            ExPolicy&& policy, FwdIter first, std::size_t count, T const& val)
+        {
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            if constexpr (!has_scheduler_executor)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        FwdIter>::get(HPX_MOVE(first));
+                }
+            }
+
+            using value_type = hpx::traits::iter_value_t<FwdIter>;
+            return util::foreach_partitioner<ExPolicy>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count,
+                [val = value_type(val)](FwdIter part_begin,
+                    std::size_t part_size, std::size_t) {
+                    util::stream_fill_n(part_begin, part_size, val);
+                },
+                hpx::identity_v);
+        }
+
         template <typename T>
         struct fill_iteration
         {
@@ -226,9 +254,19 @@ namespace hpx::parallel {
                     }
                 }
 
-                return for_each_n<FwdIter>().call(HPX_FORWARD(ExPolicy, policy),
-                    first, detail::distance(first, last),
-                    fill_iteration<T>{val}, hpx::identity_v);
+                if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                  FwdIter>)
+                {
+                    return parallel_stream_fill_n(HPX_FORWARD(ExPolicy, policy),
+                        first, detail::distance(first, last), val);
+                }
+                else
+                {
+                    return for_each_n<FwdIter>().call(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), fill_iteration<T>{val},
+                        hpx::identity_v);
+                }
             }
         };
         /// \endcond
@@ -259,9 +297,18 @@ namespace hpx::parallel {
             static decltype(auto) parallel(ExPolicy&& policy, FwdIter first,
                 std::size_t count, T const& val)
             {
-                return for_each_n<FwdIter>().call(
-                    HPX_FORWARD(ExPolicy, policy), first, count,
-                    [val](auto&& v) -> void { v = val; }, hpx::identity_v);
+                if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                  FwdIter>)
+                {
+                    return parallel_stream_fill_n(
+                        HPX_FORWARD(ExPolicy, policy), first, count, val);
+                }
+                else
+                {
+                    return for_each_n<FwdIter>().call(
+                        HPX_FORWARD(ExPolicy, policy), first, count,
+                        [val](auto&& v) -> void { v = val; }, hpx::identity_v);
+                }
             }
         };
         /// \endcond
@@ -748,6 +748,7 @@ namespace hpx { namespace experimental {
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
 #include <hpx/parallel/algorithms/for_loop_induction.hpp>
 #include <hpx/parallel/algorithms/for_loop_reduction.hpp>
 #include <hpx/parallel/util/adapt_sharing_mode.hpp>
@@ -771,6 +772,28 @@ namespace hpx::parallel {
 
         ///////////////////////////////////////////////////////////////////////
         HPX_HAS_XXX_TRAIT_DEF(needs_current_thread_num);
+        HPX_HAS_MEMBER_XXX_TRAIT_DEF(enable_deterministic_reduction);
+
+        // Reduction objects compute their sums reproducibly if the executor
+        // parameters of the execution policy ask for it
+        template <typename ExPolicy, typename T>
+        void enable_deterministic_reduction([[maybe_unused]] T& arg)
+        {
+            if constexpr (has_deterministic_reduction_v<ExPolicy> &&
+                has_enable_deterministic_reduction_v<T>)
+            {
+                arg.enable_deterministic_reduction();
+            }
+        }
+
+        template <typename ExPolicy, typename... Ts, std::size_t... Is>
+        void enable_deterministic_reduction(
+            hpx::tuple<Ts...>& args, hpx::util::index_pack<Is...>)
+        {
+            (detail::enable_deterministic_reduction<ExPolicy>(
+                 hpx::get<Is>(args)),
+                ...);
+        }
 
         ///////////////////////////////////////////////////////////////////////
         template <typename... Ts, std::size_t... Is>
@@ -1180,6 +1203,10 @@ namespace hpx::parallel {
                 args_type all_args = hpx::forward_as_tuple(
                     HPX_FORWARD(Arg, arg), HPX_FORWARD(Args, args)...);
 
+                auto pack = hpx::util::make_index_pack_t<sizeof...(Args) + 1>();
+                detail::enable_deterministic_reduction<ExPolicy>(
+                    all_args, pack);
+
                 // perform iteration
                 auto iter = part_iterations<ExPolicy, F, void, args_type>{
                     HPX_FORWARD(F, f), all_args};
@@ -1187,7 +1214,6 @@ namespace hpx::parallel {
                 iter(iter_or_r, size, 0);
 
                 // make sure live-out variables are properly set on return
-                auto pack = hpx::util::make_index_pack_t<sizeof...(Args) + 1>();
                 exit_iteration(all_args, pack, size);
 
                 return {};
@@ -1248,6 +1274,9 @@ namespace hpx::parallel {
                     args_type args =
                         hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
 
+                    detail::enable_deterministic_reduction<policy_type>(
+                        args, hpx::util::make_index_pack_t<sizeof...(Ts)>());
+
                     return util::detail::algorithm_result<policy_type>::get(
                         util::partitioner<policy_type>::call_with_index(
                             hinted_policy, iter_or_r, size, 1,
@@ -1332,6 +1361,9 @@ namespace hpx::parallel {
                     current_thread = hpx::get_worker_thread_num();
                 }
 
+                detail::enable_deterministic_reduction<ExPolicy>(arg);
+                (detail::enable_deterministic_reduction<ExPolicy>(args), ...);
+
                 arg.init_iteration(0, current_thread);
                 (args.init_iteration(0, current_thread), ...);
 
@@ -1450,6 +1482,9 @@ namespace hpx::parallel {
                     args_type args =
                         hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
 
+                    detail::enable_deterministic_reduction<policy_type>(
+                        args, hpx::util::make_index_pack_t<sizeof...(Ts)>());
+
                     return util::detail::algorithm_result<policy_type>::get(
                         util::partitioner<policy_type>::call_with_index(
                             hinted_policy, first, size, stride,
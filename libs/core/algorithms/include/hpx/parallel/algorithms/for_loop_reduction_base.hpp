@@ -14,6 +14,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -22,6 +23,7 @@
 #endif
 
 #include <cstddef>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -34,10 +36,17 @@ namespace hpx::parallel::detail {
     {
         using needs_current_thread_num = void;
 
+        // Sums of floating point values can be computed reproducibly
+        static constexpr bool supports_deterministic_reduction =
+            is_deterministic_sum_v<T, Op>;
+        using accumulator_type =
+            typename deterministic_accumulator_for<T, Op>::type;
+
         template <typename Op_>
         constexpr reduction_helper(T& var, T const& identity, Op_&& op)
           : var_(var)
           , op_(HPX_FORWARD(Op_, op))
+          , identity_(identity)
         {
             std::size_t const cores =
                 hpx::parallel::execution::detail::get_os_thread_count();
@@ -62,28 +71,77 @@ namespace hpx::parallel::detail {
             return data_[current_thread].data_;
         }
 
-        HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr void next_iteration(
-            std::size_t /*current_thread*/) noexcept
+        HPX_HOST_DEVICE HPX_FORCEINLINE void next_iteration(
+            [[maybe_unused]] std::size_t current_thread) noexcept
         {
+            if constexpr (supports_deterministic_reduction)
+            {
+                // every iteration starts off a fresh view, its final value is
+                // deposited into the accumulator of the current thread
+                if (accumulators_)
+                {
+                    T& view = data_[current_thread].data_;
+                    accumulators_[current_thread].data_ += view;
+                    view = identity_;
+                }
+            }
         }
 
         HPX_HOST_DEVICE void exit_iteration(std::size_t /*index*/)
         {
             std::size_t const cores =
                 hpx::parallel::execution::detail::get_os_thread_count();
+
+            if constexpr (supports_deterministic_reduction)
+            {
+                if (accumulators_)
+                {
+                    // the views may hold the contribution of a last iteration
+                    // which was not followed by next_iteration
+                    accumulator_type acc;
+                    acc += var_;
+                    for (std::size_t i = 0; i != cores; ++i)
+                    {
+                        acc += accumulators_[i].data_;
+                        acc += data_[i].data_;
+                    }
+                    var_ = acc.conv();
+                    return;
+                }
+            }
+
             for (std::size_t i = 0; i != cores; ++i)
             {
                 var_ = op_(var_, data_[i].data_);
             }
         }
 
+        // Accumulate the sum reproducibly, the result will not depend on the
+        // number of threads or on the assignment of iterations to threads.
+        // The identity is required to be zero.
+        void enable_deterministic_reduction()
+        {
+            if constexpr (supports_deterministic_reduction)
+            {
+                std::size_t const cores =
+                    hpx::parallel::execution::detail::get_os_thread_count();
+                accumulators_.reset(
+                    new hpx::util::cache_line_data<accumulator_type>[cores]);
+            }
+        }
+
     private:
         T& var_;
         Op op_;
+        T identity_;
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
         std::shared_ptr<hpx::util::cache_line_data<T>[]> data_;
+        std::shared_ptr<hpx::util::cache_line_data<accumulator_type>[]>
+            accumulators_;
 #else
         boost::shared_array<hpx::util::cache_line_data<T>> data_;
+        boost::shared_array<hpx::util::cache_line_data<accumulator_type>>
+            accumulators_;
 #endif
     };
 }    // namespace hpx::parallel::detail
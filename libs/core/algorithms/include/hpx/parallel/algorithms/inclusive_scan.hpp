@@ -429,8 +429,11 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -496,6 +499,38 @@ namespace hpx::parallel {
             return init;
         }
 
+        // Reproducible version of the sequential inclusive_scan, every result
+        // is the rounded sum of all values deposited into the accumulator so
+        // far.
+        template <typename InIter, typename OutIter, typename T>
+        T sequential_inclusive_scan_deterministic_n(InIter first,
+            std::size_t count, OutIter dest, deterministic_accumulator<T>& acc)
+        {
+            T result = acc.conv();
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                acc += static_cast<T>(*first);
+                result = acc.conv();
+                *dest = result;
+            }
+            return result;
+        }
+
+        template <typename InIter, typename Sent, typename OutIter, typename T>
+        util::in_out_result<InIter, OutIter>
+        sequential_inclusive_scan_deterministic(
+            InIter first, Sent last, OutIter dest, T const& init)
+        {
+            deterministic_accumulator<T> acc;
+            acc += init;
+            for (/* */; first != last; (void) ++first, ++dest)
+            {
+                acc += static_cast<T>(*first);
+                *dest = acc.conv();
+            }
+            return util::in_out_result<InIter, OutIter>{first, dest};
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct inclusive_scan
@@ -512,8 +547,16 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, T const& init,
                 Op&& op)
             {
-                return sequential_inclusive_scan(
-                    first, last, dest, init, HPX_FORWARD(Op, op));
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T, Op>)
+                {
+                    return sequential_inclusive_scan_deterministic(
+                        first, last, dest, init);
+                }
+                else
+                {
+                    return sequential_inclusive_scan(
+                        first, last, dest, init, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename InIter, typename Sent,
@@ -521,8 +564,26 @@ namespace hpx::parallel {
             static constexpr util::in_out_result<InIter, OutIter> sequential(
                 ExPolicy, InIter first, Sent last, OutIter dest, Op&& op)
             {
-                return sequential_inclusive_scan_noinit(
-                    first, last, dest, HPX_FORWARD(Op, op));
+                using value_type =
+                    typename std::iterator_traits<InIter>::value_type;
+
+                if constexpr (uses_deterministic_reduction_v<ExPolicy,
+                                  value_type, Op>)
+                {
+                    if (first != last)
+                    {
+                        value_type init = *first;
+                        *dest++ = init;
+                        return sequential_inclusive_scan_deterministic(
+                            ++first, last, dest, init);
+                    }
+                    return util::in_out_result<InIter, OutIter>{first, dest};
+                }
+                else
+                {
+                    return sequential_inclusive_scan_noinit(
+                        first, last, dest, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -560,51 +621,135 @@ namespace hpx::parallel {
 
                 using hpx::get;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                // step 4 use this return value
+                auto f4 = [last_iter, final_dest](auto&&,
+                              std::vector<hpx::future<void>>&& data) {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    util::detail::clear_container(data);
+                    return util::in_out_result<FwdIter1, FwdIter2>{
+                        last_iter, final_dest};
                 };
 
-                return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
-                    call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        zip_iterator(first, dest), count, init,
-                        // step 1 performs first part of scan algorithm
-                        [op, last](zip_iterator part_begin,
-                            std::size_t part_size) -> T {
-                            T part_init = get<0>(*part_begin);
-                            get<1>(*part_begin++) = part_init;
-
-                            auto iters = part_begin.get_iterator_tuple();
-                            if (get<0>(iters) != last)
-                            {
-                                return sequential_inclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
-                            }
-                            return part_init;
-                        },
-                        // step 2 propagates the partition results from left
-                        // to right
-                        op,
-                        // step 3 runs final accumulation on each partition
-                        HPX_MOVE(f3),
-                        // step 4 use this return value
-                        [last_iter, final_dest](std::vector<T>&&,
-                            std::vector<hpx::future<void>>&& data) {
-                            // make sure iterators embedded in function object that is
-                            // attached to futures are invalidated
-                            util::detail::clear_container(data);
-                            return util::in_out_result<FwdIter1, FwdIter2>{
-                                last_iter, final_dest};
-                        });
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T, Op>)
+                {
+                    // Each partition deposits its values into an accumulator,
+                    // the accumulators are combined from left to right, and
+                    // the third step continues accumulating from the combined
+                    // value. The accumulated sums don't depend on the order in
+                    // which the values were deposited.
+                    using accumulator = deterministic_accumulator<T>;
+
+                    accumulator acc_init;
+                    acc_init += init;
+
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, accumulator>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, acc_init,
+                            // step 1 accumulates each partition
+                            [](zip_iterator part_begin,
+                                std::size_t part_size) -> accumulator {
+                                accumulator acc;
+                                deterministic_accumulate_n(acc,
+                                    get<0>(part_begin.get_iterator_tuple()),
+                                    part_size, hpx::identity_v);
+                                return acc;
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            [](accumulator lhs, accumulator const& rhs) {
+                                lhs += rhs;
+                                return lhs;
+                            },
+                            // step 3 scans each partition
+                            [](zip_iterator part_begin, std::size_t part_size,
+                                accumulator acc) -> void {
+                                auto iters = part_begin.get_iterator_tuple();
+                                sequential_inclusive_scan_deterministic_n(
+                                    get<0>(iters), part_size, get<1>(iters),
+                                    acc);
+                            },
+                            HPX_MOVE(f4));
+                }
+                else if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                       ExPolicy> ||
+                    util::uses_single_pass_scan_v<ExPolicy>)
+                {
+                    // The first step only reduces each partition (using the
+                    // vectorized reduction), the third step scans it starting
+                    // off the accumulated value. This touches the destination
+                    // only once. The single-pass scan relies on this as well,
+                    // it reads its input from memory once only.
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 reduces each partition
+                            [op](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                FwdIter1 src =
+                                    get<0>(part_begin.get_iterator_tuple());
+                                T part_init = *src;
+                                return sequential_reduce<
+                                    std::decay_t<ExPolicy>>(++src,
+                                    part_size - 1, part_init,
+                                    ordered_reduce_op<std::decay_t<Op>>{op});
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 scans each partition
+                            [op](zip_iterator part_begin, std::size_t part_size,
+                                T val) mutable -> void {
+                                auto iters = part_begin.get_iterator_tuple();
+                                sequential_inclusive_scan_n(get<0>(iters),
+                                    part_size, get<1>(iters), val, op);
+                            },
+                            HPX_MOVE(f4));
+                }
+                else
+                {
+                    auto f3 = [op](zip_iterator part_begin,
+                                  std::size_t part_size,
+                                  T val) mutable -> void {
+                        FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
+
+                        // MSVC 2015 fails if op is captured by reference
+                        util::loop_n<std::decay_t<ExPolicy>>(dst, part_size,
+                            [=, &val](FwdIter2 it) mutable -> void {
+                                *it = HPX_INVOKE(op, val, *it);
+                            });
+                    };
+
+                    return util::scan_partitioner<ExPolicy,
+                        util::in_out_result<FwdIter1, FwdIter2>, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 performs first part of scan algorithm
+                            [op, last](zip_iterator part_begin,
+                                std::size_t part_size) -> T {
+                                T part_init = get<0>(*part_begin);
+                                get<1>(*part_begin++) = part_init;
+
+                                auto iters = part_begin.get_iterator_tuple();
+                                if (get<0>(iters) != last)
+                                {
+                                    return sequential_inclusive_scan_n(
+                                        get<0>(iters), part_size - 1,
+                                        get<1>(iters), part_init, op);
+                                }
+                                return part_init;
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 runs final accumulation on each partition
+                            HPX_MOVE(f3), HPX_MOVE(f4));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
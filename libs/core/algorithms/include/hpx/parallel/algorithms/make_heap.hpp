@@ -193,7 +193,6 @@ namespace hpx {
 
 #include <hpx/config.hpp>
 #include <hpx/concepts/concepts.hpp>
-#include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/execution/traits/is_execution_policy.hpp>
@@ -201,21 +200,23 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <exception>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <type_traits>
 #include <utility>
@@ -284,17 +285,56 @@ namespace hpx::parallel {
             *start = top;
         }
 
+        // Sift down the inner nodes of the subtree rooted at root, limited to
+        // its topmost depth levels. The nodes of a level of the subtree are
+        // stored contiguously, the levels are processed bottom up.
         template <typename RndIter, typename Comp, typename Proj>
-        constexpr void sift_down_range(RndIter first, Comp&& comp, Proj&& proj,
+        constexpr void make_heap_subtree(RndIter first, Comp& comp,
+            Proj& proj,
             typename std::iterator_traits<RndIter>::difference_type len,
-            RndIter start, std::size_t count)
+            std::size_t root,
+            std::size_t depth = (std::numeric_limits<std::size_t>::max)())
         {
-            for (std::size_t i = 0; i != count; ++i)
+            if (len < 2)
+                return;
+
+            auto const last_inner = static_cast<std::size_t>((len - 2) / 2);
+
+            // find the deepest level of the subtree holding inner nodes
+            std::size_t level_first = root;
+            std::size_t width = 1;
+            while (depth > 1 && 2 * level_first + 1 <= last_inner)
             {
-                sift_down(first, comp, proj, len, start - i);
+                level_first = 2 * level_first + 1;
+                width *= 2;
+                --depth;
+            }
+
+            while (true)
+            {
+                if (level_first <= last_inner)
+                {
+                    std::size_t i =
+                        (std::min) (level_first + width - 1, last_inner) + 1;
+                    while (i != level_first)
+                    {
+                        --i;
+                        sift_down(first, comp, proj, len, first + i);
+                    }
+                }
+
+                if (width == 1)
+                    break;
+
+                level_first = (level_first - 1) / 2;
+                width /= 2;
             }
         }
 
+        // The minimal number of elements of the subtrees of a heap which are
+        // built concurrently
+        inline constexpr std::size_t make_heap_min_subtree_size = 4096;
+
         template <typename Iter, typename Sent, typename Comp, typename Proj>
         constexpr Iter sequential_make_heap(
             Iter first, Sent last, Comp&& comp, Proj&& proj)
@@ -314,6 +354,72 @@ namespace hpx::parallel {
             return first;
         }
 
+        // The level of the heap holding node i, the root is on level zero
+        constexpr std::size_t heap_level(std::size_t i) noexcept
+        {
+            std::size_t level = 0;
+            while (((i + 1) >> (level + 1)) != 0)
+            {
+                ++level;
+            }
+            return level;
+        }
+
+        // The minimal number of heap nodes sifted down by a single task
+        inline constexpr std::size_t heap_n_min_chunk_size = 256;
+
+        // Invoke f(i) for all i in [0, count). The invocations may run
+        // concurrently, they must touch disjoint parts of the heap only.
+        template <typename ExPolicy, typename F>
+        void heap_n_for_each(ExPolicy& policy, std::size_t count, F&& f)
+        {
+            using execution_policy = std::decay_t<ExPolicy>;
+            if constexpr (!hpx::is_sequenced_execution_policy_v<
+                              execution_policy>)
+            {
+                if (count >= 2 * heap_n_min_chunk_size)
+                {
+                    std::size_t const cores =
+                        hpx::execution::experimental::processing_units_count(
+                            policy.parameters(), policy.executor(),
+                            hpx::chrono::null_duration, count);
+
+                    std::size_t const chunk_size =
+                        (std::max) (heap_n_min_chunk_size,
+                            (count + 4 * cores - 1) / (4 * cores));
+                    std::size_t const num_chunks =
+                        (count + chunk_size - 1) / chunk_size;
+
+                    auto const shape = hpx::util::iterator_range(
+                        hpx::util::counting_iterator(std::size_t(0)),
+                        hpx::util::counting_iterator(num_chunks));
+
+                    auto&& workitems = execution::bulk_async_execute(
+                        policy.executor(),
+                        [&](std::size_t chunk) {
+                            std::size_t const end =
+                                (std::min) ((chunk + 1) * chunk_size, count);
+                            for (std::size_t i = chunk * chunk_size; i != end;
+                                ++i)
+                            {
+                                f(i);
+                            }
+                        },
+                        shape);
+
+                    hpx::wait_all(workitems);
+                    util::detail::handle_local_exceptions<
+                        execution_policy>::call(workitems);
+                    return;
+                }
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct make_heap : public algorithm<make_heap<Iter>, Iter>
@@ -360,126 +466,65 @@ namespace hpx::parallel {
 
                 std::list<std::exception_ptr> errors;
 
-                using tuple_type = hpx::tuple<RndIter, std::size_t>;
-
-                auto op = [=](tuple_type const& t) {
-                    sift_down_range(first, comp, proj,
-                        static_cast<std::size_t>(n), hpx::get<0>(t),
-                        hpx::get<1>(t));
-                };
-
                 std::size_t const cores =
                     hpx::execution::experimental::processing_units_count(
                         policy.parameters(), policy.executor(),
                         hpx::chrono::null_duration, n);
 
-                // Take a standard chunk size (amount of work / cores), and only
-                // take a quarter of that. If our chunk size is too large a LOT
-                // of the work will be done sequentially due to the level
-                // barrier of heap parallelism. 1/4 of the standard chunk size
-                // is an estimate to lower the average number of levels done
-                // sequentially
-                std::size_t chunk_size =
-                    hpx::execution::experimental::get_chunk_size(
-                        policy.parameters(), policy.executor(),
-                        hpx::chrono::null_duration, cores, n);
-                chunk_size /= 4;
-
-                std::size_t max_chunks =
-                    hpx::execution::experimental::maximal_number_of_chunks(
-                        policy.parameters(), policy.executor(), cores, n);
-
-                util::detail::adjust_chunk_size_and_max_chunks(
-                    cores, n, chunk_size, max_chunks);
+                // The heap is split at the level holding the roots of the
+                // subtrees built concurrently. Aim for up to four subtrees
+                // per core to balance the load, while keeping each of them
+                // large enough to amortize the task overheads.
+                std::size_t level = 0;
+                while ((std::size_t(2) << level) <= 4 * cores &&
+                    (static_cast<std::size_t>(n) >> (level + 1)) >=
+                        make_heap_min_subtree_size)
+                {
+                    ++level;
+                }
 
                 try
                 {
-                    // parent of last node
-                    // last node has index (n-1)
-                    // parent of x is floor of (x-1)/2
-                    std::size_t start = (n - 2) / 2;
-                    while (start > 0)
+                    if (level == 0)
                     {
-                        /*
-                            helps find number of elements
-                            in parent level of start
-                            The following are indexes of
-                            elements in the heap, not the
-                            value of the elements
-                                    0
-                                1       2
-                              3   4   5   6
-                            (size of heap) n = 7
-                            (parent of last element) start = 2
-                            end_exclusive =>
-                                last element index in
-                                    parent level of start
-                        */
-                        std::size_t end_exclusive = static_cast<std::size_t>(
-                            std::pow(2, std::floor(std::log2(start))));
-                        if (end_exclusive >= 2)
-                        {
-                            end_exclusive -= static_cast<std::size_t>(2);
-                        }
-                        else
+                        sequential_make_heap(first, first + n, comp, proj);
+                    }
+                    else
+                    {
+                        std::size_t const roots_first =
+                            (std::size_t(1) << level) - 1;
+
+                        // Every subtree is built by a single task, all of
+                        // its levels are processed without synchronizing
+                        // with other tasks.
+                        auto op = [=](std::size_t root) {
+                            make_heap_subtree(first, comp, proj, n, root);
+                        };
+
+                        auto const shape = hpx::util::iterator_range(
+                            hpx::util::counting_iterator(roots_first),
+                            hpx::util::counting_iterator((std::min) (
+                                2 * roots_first + 1,
+                                static_cast<std::size_t>(n))));
+
+                        auto&& workitems = execution::bulk_async_execute(
+                            policy.executor(), op, shape);
+
+                        if (hpx::wait_all_nothrow(workitems))
                         {
-                            end_exclusive = static_cast<std::size_t>(0);
+                            // collect exceptions
+                            util::detail::handle_local_exceptions<
+                                ExPolicy>::call(workitems, errors, false);
                         }
-                        std::size_t level_items = start - end_exclusive;
 
-                        // If we can't at least run two chunks in parallel,
-                        // don't bother parallelizing and simply run
-                        // sequentially
-                        if (chunk_size * 2 > level_items)
-                        {
-                            op(hpx::make_tuple(first + start, level_items));
-                        }
-                        else
+                        if (errors.empty())
                         {
-                            std::vector<tuple_type> shapes;
-                            shapes.reserve(level_items / chunk_size + 1);
-
-                            std::size_t cnt = 0;
-                            while (cnt + chunk_size < level_items)
-                            {
-                                shapes.push_back(hpx::make_tuple(
-                                    first + start - cnt, chunk_size));
-                                cnt += chunk_size;
-                            }
-
-                            // Schedule any left-over work
-                            if (cnt < level_items)
-                            {
-                                shapes.push_back(hpx::make_tuple(
-                                    first + start - cnt, level_items - cnt));
-                            }
-
-                            // Reserve items/chunk_size spaces for async calls
-                            auto&& workitems = execution::bulk_async_execute(
-                                policy.executor(), op, shapes);
+                            scoped_params.mark_end_of_scheduling();
 
-                            // Required synchronization per level
-                            if (hpx::wait_all_nothrow(workitems))
-                            {
-                                // collect exceptions
-                                util::detail::handle_local_exceptions<
-                                    ExPolicy>::call(workitems, errors, false);
-                            }
+                            // the few nodes above the subtrees are sifted
+                            // down sequentially
+                            make_heap_subtree(first, comp, proj, n, 0, level);
                         }
-
-                        if (!errors.empty())
-                            break;    // stop on errors
-
-                        start = end_exclusive;
-                    }
-
-                    if (errors.empty())
-                    {
-                        scoped_params.mark_end_of_scheduling();
-
-                        // Perform sift down for the head node
-                        sift_down(first, comp = HPX_FORWARD(Comp, comp),
-                            HPX_FORWARD(Proj, proj), n, first);
                     }
                 }
                 catch ([[maybe_unused]] std::bad_alloc const& e)
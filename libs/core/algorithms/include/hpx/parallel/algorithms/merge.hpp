@@ -295,6 +295,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
@@ -309,6 +310,7 @@ namespace hpx {
 #include <exception>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -751,19 +753,16 @@ namespace hpx::parallel {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        template <typename ExPolicy, typename Iter1, typename Sent1,
-            typename Iter2, typename Sent2, typename Iter3, typename Comp,
+        // Partition the longer input sequence into chunks and find the
+        // corresponding pieces of the shorter one using binary search, used
+        // if merge path search is not possible.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Iter3, typename Size1, typename Size2, typename Comp,
             typename Proj1, typename Proj2>
-        decltype(auto) parallel_merge(ExPolicy&& policy, Iter1 first1,
-            Sent1 last1, Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp,
-            Proj1&& proj1, Proj2&& proj2)
+        decltype(auto) parallel_merge_reshape(ExPolicy&& policy, Iter1 first1,
+            Iter1 end1, Size1 len1, Iter2 first2, Iter2 end2, Size2 len2,
+            Iter3 dest, Comp&& comp, Proj1&& proj1, Proj2&& proj2)
         {
-            auto end1 = first1;
-            auto const len1 = detail::advance_and_get_distance(end1, last1);
-
-            auto end2 = first2;
-            auto const len2 = detail::advance_and_get_distance(end2, last2);
-
             using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
             auto f1 = [dest, comp, proj1, proj2](Iter1 it1, std::size_t size1,
@@ -804,6 +803,62 @@ namespace hpx::parallel {
                 HPX_MOVE(f2), HPX_MOVE(reshape));
         }
 
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2, typename Iter3, typename Comp,
+            typename Proj1, typename Proj2>
+        decltype(auto) parallel_merge(ExPolicy&& policy, Iter1 first1,
+            Sent1 last1, Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            auto end1 = first1;
+            auto const len1 = detail::advance_and_get_distance(end1, last1);
+
+            auto end2 = first2;
+            auto const len2 = detail::advance_and_get_distance(end2, last2);
+
+            using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
+
+            if constexpr (hpx::traits::is_random_access_iterator_v<Iter1> &&
+                hpx::traits::is_random_access_iterator_v<Iter2> &&
+                hpx::traits::is_random_access_iterator_v<Iter3>)
+            {
+                // Split the output into chunks and find the corresponding
+                // pieces of the input sequences using merge path search. This
+                // balances the work exactly, even for heavily skewed inputs.
+                auto const size1 = static_cast<std::size_t>(len1);
+                auto const size2 = static_cast<std::size_t>(len2);
+
+                auto f1 = [first1, size1, first2, size2, dest, comp, proj1,
+                              proj2](
+                              Iter3, std::size_t size, std::size_t base) {
+                    std::size_t const part1_begin = merge_path_search(
+                        first1, size1, first2, size2, base, comp, proj1, proj2);
+                    std::size_t const part1_end = merge_path_search(first1,
+                        size1, first2, size2, base + size, comp, proj1, proj2);
+
+                    sequential_merge(first1 + part1_begin, first1 + part1_end,
+                        first2 + (base - part1_begin),
+                        first2 + (base + size - part1_end), dest + base, comp,
+                        proj1, proj2);
+                };
+
+                auto f2 = [end1, end2](Iter3 last) {
+                    return result_type{end1, end2, last};
+                };
+
+                return util::foreach_partitioner<ExPolicy>::call(
+                    HPX_FORWARD(ExPolicy, policy), dest, size1 + size2,
+                    HPX_MOVE(f1), HPX_MOVE(f2));
+            }
+            else
+            {
+                return parallel_merge_reshape(HPX_FORWARD(ExPolicy, policy),
+                    first1, end1, len1, first2, end2, len2, dest,
+                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
+                    HPX_FORWARD(Proj2, proj2));
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename IterTuple>
         struct merge : public algorithm<merge<IterTuple>, IterTuple>
@@ -873,12 +928,15 @@ namespace hpx::parallel {
             return last;
         }
 
+        // Ranges smaller than this are merged sequentially
+        inline constexpr std::size_t inplace_merge_threshold = 65536ul;
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         void parallel_inplace_merge_helper(ExPolicy&& policy, Iter first,
             Iter middle, Sent last, Comp&& comp, Proj&& proj)
         {
-            constexpr std::size_t threshold = 65536ul;
+            constexpr std::size_t threshold = inplace_merge_threshold;
             static_assert(threshold >= 5ul);
 
             std::size_t const left_size = middle - first;
@@ -1005,6 +1063,45 @@ namespace hpx::parallel {
             }
         }
 
+        // Elements of these types are merged using a temporary buffer
+        template <typename Iter>
+        inline constexpr bool use_buffered_inplace_merge_v =
+            hpx::traits::is_random_access_iterator_v<Iter> &&
+            std::is_trivially_copyable_v<hpx::traits::iter_value_t<Iter>> &&
+            std::is_default_constructible_v<hpx::traits::iter_value_t<Iter>>;
+
+        // Copy both sequences to a temporary buffer and merge them back using
+        // merge path partitioning. Unlike the recursive algorithm above, all
+        // of the work is done in parallel and in equally sized pieces, at the
+        // expense of additional memory.
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        void parallel_inplace_merge_buffered(ExPolicy& policy, Iter first,
+            Iter middle, Iter last, Comp& comp, Proj& proj)
+        {
+            using value_type = hpx::traits::iter_value_t<Iter>;
+
+            std::size_t const size = last - first;
+            if (size <= inplace_merge_threshold)
+            {
+                sequential_inplace_merge(first, middle, last, comp, proj);
+                return;
+            }
+
+            // the elements of the buffer are not initialized
+            std::unique_ptr<value_type[]> buffer(new value_type[size]);
+            value_type* const buffer_first = buffer.get();
+            value_type* const buffer_middle = buffer_first + (middle - first);
+            value_type* const buffer_last = buffer_first + size;
+
+            hpx::copy(policy(hpx::execution::non_task), first, last,
+                buffer_first);
+
+            parallel_merge(policy(hpx::execution::non_task), buffer_first,
+                buffer_middle, buffer_middle, buffer_last, first, comp, proj,
+                proj);
+        }
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         hpx::future<Iter> parallel_inplace_merge(ExPolicy&& policy, Iter first,
@@ -1015,8 +1112,18 @@ namespace hpx::parallel {
                     proj = HPX_FORWARD(Proj, proj)]() mutable -> Iter {
                     try
                     {
-                        parallel_inplace_merge_helper(policy, first, middle,
-                            last, HPX_MOVE(comp), HPX_MOVE(proj));
+                        if constexpr (use_buffered_inplace_merge_v<Iter>)
+                        {
+                            parallel_inplace_merge_buffered(policy, first,
+                                middle,
+                                detail::advance_to_sentinel(middle, last), comp,
+                                proj);
+                        }
+                        else
+                        {
+                            parallel_inplace_merge_helper(policy, first, middle,
+                                last, HPX_MOVE(comp), HPX_MOVE(proj));
+                        }
                         return last;
                     }
                     catch (...)
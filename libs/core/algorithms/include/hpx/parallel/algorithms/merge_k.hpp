@@ -0,0 +1,605 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/merge_k.hpp
+/// \page hpx::experimental::merge_k
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Merges k sorted ranges (runs) into one sorted range beginning at
+    /// \a dest in a single pass over the data. The order of equivalent
+    /// elements in each of the runs is preserved. For equivalent elements of
+    /// different runs, the elements of the run appearing first in
+    /// [runs_first, runs_last) precede the others. The destination range
+    /// cannot overlap with any of the runs. Executed according to the policy.
+    ///
+    /// The merged output is split into equally sized pieces, the
+    /// corresponding pieces of all runs are found using an exact multi-way
+    /// selection. Every piece is merged sequentially using a tree of losers,
+    /// which needs log2(k) comparisons per element.
+    ///
+    /// \note   Complexity: Performs O(N log2(k)) applications of the
+    ///         comparison \a comp and each projection, where N is the sum of
+    ///         the sizes of all runs.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RunIter     The type of the iterators referring to the runs
+    ///                     (deduced). Its value type must be a range whose
+    ///                     iterators meet the requirements of a random access
+    ///                     iterator, for instance a std::vector or a
+    ///                     hpx::util::iterator_range.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a merge_k requires \a Comp to meet the
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param runs_first   Refers to the first of the sorted runs to merge.
+    /// \param runs_last    Refers to the end of the sorted runs to merge.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a merge_k algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. The algorithm returns the
+    ///           destination iterator to the end of the \a dest range.
+    ///
+    template <typename ExPolicy, typename RunIter, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    merge_k(ExPolicy&& policy, RunIter runs_first, RunIter runs_last,
+        RandIter dest, Comp comp = Comp(), Proj proj = Proj());
+
+    /// Merges k sorted ranges (runs) into one sorted range beginning at
+    /// \a dest in a single pass over the data using a tree of losers. The
+    /// order of equivalent elements in each of the runs is preserved. For
+    /// equivalent elements of different runs, the elements of the run
+    /// appearing first in [runs_first, runs_last) precede the others.
+    ///
+    /// \note   Complexity: Performs O(N log2(k)) applications of the
+    ///         comparison \a comp and each projection, where N is the sum of
+    ///         the sizes of all runs.
+    ///
+    /// \tparam RunIter     The type of the iterators referring to the runs
+    ///                     (deduced). Its value type must be a range whose
+    ///                     iterators meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param runs_first   Refers to the first of the sorted runs to merge.
+    /// \param runs_last    Refers to the end of the sorted runs to merge.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// \returns  The \a merge_k algorithm returns \a OutIter, the
+    ///           destination iterator to the end of the \a dest range.
+    ///
+    template <typename RunIter, typename OutIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    OutIter merge_k(RunIter runs_first, RunIter runs_last, OutIter dest,
+        Comp comp = Comp(), Proj proj = Proj());
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // The minimal number of elements handled by a single task
+    inline constexpr std::size_t merge_k_min_chunk_size = 16384ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A tournament tree of losers over k sorted sequences. The inner nodes
+    // 1 ... k-1 hold the loser of the match played at that node, node 0 holds
+    // the overall winner. After the winner has been consumed, only the
+    // matches on the path from its leaf to the root are replayed, which
+    // needs log2(k) comparisons per element. Exhausted sequences lose every
+    // match, equivalent elements are taken from the first sequence first.
+    template <typename Iter, typename Comp, typename Proj>
+    class loser_tree
+    {
+    public:
+        loser_tree(std::vector<std::pair<Iter, Iter>> runs, Comp& comp,
+            Proj& proj)
+          : runs_(HPX_MOVE(runs))
+          , tree_(runs_.size())
+          , comp_(comp)
+          , proj_(proj)
+        {
+            std::size_t const k = runs_.size();
+            HPX_ASSERT(k != 0);
+
+            // the leaves are the (virtual) nodes k ... 2k-1
+            std::vector<std::size_t> winners(2 * k);
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                winners[k + i] = i;
+            }
+
+            for (std::size_t node = k - 1; node != 0; --node)
+            {
+                std::size_t const lhs = winners[2 * node];
+                std::size_t const rhs = winners[2 * node + 1];
+                if (beats(lhs, rhs))
+                {
+                    winners[node] = lhs;
+                    tree_[node] = rhs;
+                }
+                else
+                {
+                    winners[node] = rhs;
+                    tree_[node] = lhs;
+                }
+            }
+            tree_[0] = k > 1 ? winners[1] : 0;
+        }
+
+        // Return the current overall minimum and advance past it. Must not
+        // be called once all sequences are exhausted.
+        Iter pop()
+        {
+            std::size_t winner = tree_[0];
+            Iter it = runs_[winner].first++;
+
+            std::size_t const k = runs_.size();
+            for (std::size_t node = (winner + k) / 2; node != 0; node /= 2)
+            {
+                if (beats(tree_[node], winner))
+                {
+                    std::swap(tree_[node], winner);
+                }
+            }
+            tree_[0] = winner;
+
+            return it;
+        }
+
+    private:
+        bool beats(std::size_t lhs, std::size_t rhs) const
+        {
+            auto const& [lhs_first, lhs_last] = runs_[lhs];
+            auto const& [rhs_first, rhs_last] = runs_[rhs];
+
+            if (rhs_first == rhs_last)
+                return true;
+            if (lhs_first == lhs_last)
+                return false;
+
+            // ties are won by the sequence with the smaller index
+            if (lhs < rhs)
+            {
+                return !HPX_INVOKE(comp_, HPX_INVOKE(proj_, *rhs_first),
+                    HPX_INVOKE(proj_, *lhs_first));
+            }
+            return HPX_INVOKE(comp_, HPX_INVOKE(proj_, *lhs_first),
+                HPX_INVOKE(proj_, *rhs_first));
+        }
+
+        std::vector<std::pair<Iter, Iter>> runs_;
+        std::vector<std::size_t> tree_;
+        Comp& comp_;
+        Proj& proj_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename OutIter, typename Comp, typename Proj>
+    OutIter sequential_merge_k(std::vector<std::pair<Iter, Iter>> runs,
+        OutIter dest, Comp& comp, Proj& proj)
+    {
+        runs.erase(std::remove_if(runs.begin(), runs.end(),
+                       [](auto const& run) { return run.first == run.second; }),
+            runs.end());
+
+        switch (runs.size())
+        {
+        case 0:
+            return dest;
+
+        case 1:
+            return std::copy(runs[0].first, runs[0].second, dest);
+
+        case 2:
+            return sequential_merge(runs[0].first, runs[0].second,
+                runs[1].first, runs[1].second, dest, comp, proj, proj)
+                .out;
+
+        default:
+            break;
+        }
+
+        std::size_t count = 0;
+        for (auto const& [first, last] : runs)
+        {
+            count += static_cast<std::size_t>(std::distance(first, last));
+        }
+
+        loser_tree<Iter, Comp, Proj> tree(HPX_MOVE(runs), comp, proj);
+        for (std::size_t i = 0; i != count; ++i, ++dest)
+        {
+            *dest = *tree.pop();
+        }
+        return dest;
+    }
+
+    // Determine how many elements each of the sorted sequences contributes
+    // to the first 'rank' elements of their (stable) merge. Every iteration
+    // selects the middle element of the largest remaining search window as
+    // pivot, determines its rank in the merged sequence using a binary
+    // search in every sequence, and narrows the search windows accordingly.
+    template <typename Iter, typename Comp, typename Proj>
+    std::vector<std::size_t> multiway_merge_split(
+        std::vector<std::pair<Iter, Iter>> const& runs, std::size_t rank,
+        Comp& comp, Proj& proj)
+    {
+        std::size_t const k = runs.size();
+
+        std::vector<std::size_t> low(k, 0);
+        std::vector<std::size_t> high(k);
+        for (std::size_t run = 0; run != k; ++run)
+        {
+            high[run] = static_cast<std::size_t>(
+                std::distance(runs[run].first, runs[run].second));
+        }
+
+        std::vector<std::size_t> counts(k);
+        while (true)
+        {
+            std::size_t pivot_run = k;
+            std::size_t largest = 0;
+            for (std::size_t run = 0; run != k; ++run)
+            {
+                if (high[run] - low[run] > largest)
+                {
+                    largest = high[run] - low[run];
+                    pivot_run = run;
+                }
+            }
+
+            // all search windows are empty
+            if (pivot_run == k)
+                break;
+
+            std::size_t const pivot_index = low[pivot_run] + largest / 2;
+            auto&& pivot =
+                HPX_INVOKE(proj, *(runs[pivot_run].first + pivot_index));
+
+            // the number of elements preceding the pivot in the merged
+            // sequence, equivalent elements of the sequences before the one
+            // of the pivot precede it as well
+            std::size_t pivot_rank = 0;
+            for (std::size_t run = 0; run != k; ++run)
+            {
+                auto const [first, last] = runs[run];
+                if (run < pivot_run)
+                {
+                    counts[run] = static_cast<std::size_t>(
+                        detail::upper_bound(first, last, pivot, comp, proj) -
+                        first);
+                }
+                else if (run > pivot_run)
+                {
+                    counts[run] = static_cast<std::size_t>(
+                        detail::lower_bound(first, last, pivot, comp, proj) -
+                        first);
+                }
+                else
+                {
+                    counts[run] = pivot_index;
+                }
+                pivot_rank += counts[run];
+            }
+
+            if (pivot_rank < rank)
+            {
+                // the pivot and all elements preceding it are part of the
+                // first 'rank' elements
+                for (std::size_t run = 0; run != k; ++run)
+                {
+                    low[run] = (std::max) (low[run], counts[run]);
+                }
+                low[pivot_run] = (std::max) (low[pivot_run], pivot_index + 1);
+            }
+            else
+            {
+                for (std::size_t run = 0; run != k; ++run)
+                {
+                    high[run] = (std::min) (high[run], counts[run]);
+                }
+            }
+        }
+
+        return low;
+    }
+
+    template <typename ExPolicy, typename Exec, typename F>
+    void merge_k_bulk(Exec& exec, std::size_t num_tasks, F&& f)
+    {
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(num_tasks));
+
+        auto&& workitems =
+            execution::bulk_async_execute(exec, HPX_FORWARD(F, f), shape);
+
+        hpx::wait_all(workitems);
+        util::detail::handle_local_exceptions<ExPolicy>::call(workitems);
+    }
+
+    // The merged output is split into equally sized pieces, one per task.
+    // The pieces of the runs making up each of those are determined first,
+    // afterwards every task merges its pieces sequentially.
+    template <typename ExPolicy, typename Exec, typename Iter,
+        typename RandIter, typename Comp, typename Proj>
+    RandIter parallel_merge_k(Exec& exec, std::size_t cores,
+        std::vector<std::pair<Iter, Iter>> const& runs, RandIter dest,
+        Comp& comp, Proj& proj)
+    {
+        std::size_t const k = runs.size();
+
+        std::size_t count = 0;
+        for (auto const& [first, last] : runs)
+        {
+            count += static_cast<std::size_t>(std::distance(first, last));
+        }
+
+        std::size_t const num_tasks = (std::max) (std::size_t(1),
+            (std::min) (cores, count / merge_k_min_chunk_size));
+        if (num_tasks == 1 || k < 2)
+        {
+            return sequential_merge_k(runs, dest, comp, proj);
+        }
+
+        // splits[task] holds the start of the pieces of task in all runs
+        std::vector<std::vector<std::size_t>> splits(num_tasks + 1);
+        splits[0].assign(k, 0);
+        splits[num_tasks].resize(k);
+        for (std::size_t run = 0; run != k; ++run)
+        {
+            splits[num_tasks][run] = static_cast<std::size_t>(
+                std::distance(runs[run].first, runs[run].second));
+        }
+
+        merge_k_bulk<ExPolicy>(exec, num_tasks - 1, [&](std::size_t task) {
+            splits[task + 1] = multiway_merge_split(
+                runs, (task + 1) * count / num_tasks, comp, proj);
+        });
+
+        merge_k_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+            std::vector<std::pair<Iter, Iter>> pieces;
+            pieces.reserve(k);
+
+            std::vector<std::size_t> const& begin = splits[task];
+            std::vector<std::size_t> const& end = splits[task + 1];
+            for (std::size_t run = 0; run != k; ++run)
+            {
+                pieces.emplace_back(runs[run].first + begin[run],
+                    runs[run].first + end[run]);
+            }
+
+            sequential_merge_k(HPX_MOVE(pieces),
+                dest + task * count / num_tasks, comp, proj);
+        });
+
+        return dest + count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutIter>
+    struct merge_k : public algorithm<merge_k<OutIter>, OutIter>
+    {
+        constexpr merge_k() noexcept
+          : algorithm<merge_k, OutIter>("merge_k")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static OutIter sequential(ExPolicy,
+            std::vector<std::pair<Iter, Iter>> runs, OutIter dest,
+            Comp&& comp, Proj&& proj)
+        {
+            return sequential_merge_k(HPX_MOVE(runs), dest, comp, proj);
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static util::detail::algorithm_result_t<ExPolicy, OutIter> parallel(
+            ExPolicy&& policy, std::vector<std::pair<Iter, Iter>> runs,
+            OutIter dest, Comp&& comp, Proj&& proj)
+        {
+            std::size_t count = 0;
+            for (auto const& [first, last] : runs)
+            {
+                count += static_cast<std::size_t>(std::distance(first, last));
+            }
+
+            std::size_t const cores =
+                hpx::execution::experimental::processing_units_count(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, count);
+
+            auto run = [exec = policy.executor(), cores, runs = HPX_MOVE(runs),
+                           dest, comp = HPX_FORWARD(Comp, comp),
+                           proj = HPX_FORWARD(Proj, proj)]() mutable
+                -> OutIter {
+                return parallel_merge_k<std::decay_t<ExPolicy>>(
+                    exec, cores, runs, dest, comp, proj);
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return util::detail::algorithm_result<ExPolicy, OutIter>::get(
+                    execution::async_execute(
+                        policy.executor(), HPX_MOVE(run)));
+            }
+            else
+            {
+                return util::detail::algorithm_result<ExPolicy, OutIter>::get(
+                    run());
+            }
+        }
+    };
+
+    // Collect the begin and end iterators of all runs
+    template <typename RunIter>
+    auto get_merge_k_runs(RunIter runs_first, RunIter runs_last)
+    {
+        using run_iterator = std::decay_t<decltype(hpx::util::begin(
+            *std::declval<RunIter&>()))>;
+
+        std::vector<std::pair<run_iterator, run_iterator>> runs;
+        for (/**/; runs_first != runs_last; ++runs_first)
+        {
+            runs.emplace_back(
+                hpx::util::begin(*runs_first), hpx::util::end(*runs_first));
+        }
+        return runs;
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    template <typename ExPolicy, typename RunIter, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    // clang-format off
+        requires (
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<RunIter> &&
+            hpx::traits::is_iterator_v<RandIter>
+        )
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    merge_k(ExPolicy&& policy, RunIter runs_first, RunIter runs_last,
+        RandIter dest, Comp comp = Comp(), Proj proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+            "Requires at least random access iterator.");
+
+        auto runs =
+            hpx::parallel::detail::get_merge_k_runs(runs_first, runs_last);
+
+        static_assert(hpx::traits::is_random_access_iterator_v<
+                          typename decltype(runs)::value_type::first_type>,
+            "Requires runs with at least random access iterators.");
+
+        return hpx::parallel::detail::merge_k<RandIter>().call(
+            HPX_FORWARD(ExPolicy, policy), HPX_MOVE(runs), dest,
+            HPX_MOVE(comp), HPX_MOVE(proj));
+    }
+
+    template <typename RunIter, typename OutIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    // clang-format off
+        requires (
+            hpx::traits::is_iterator_v<RunIter> &&
+            hpx::traits::is_iterator_v<OutIter>
+        )
+    // clang-format on
+    OutIter merge_k(RunIter runs_first, RunIter runs_last, OutIter dest,
+        Comp comp = Comp(), Proj proj = Proj())
+    {
+        auto runs =
+            hpx::parallel::detail::get_merge_k_runs(runs_first, runs_last);
+
+        static_assert(hpx::traits::is_random_access_iterator_v<
+                          typename decltype(runs)::value_type::first_type>,
+            "Requires runs with at least random access iterators.");
+
+        return hpx::parallel::detail::sequential_merge_k(
+            HPX_MOVE(runs), dest, comp, proj);
+    }
+}    // namespace hpx::experimental
+
+#endif
@@ -113,7 +113,6 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
-#include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
@@ -121,6 +120,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/sample_select.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -131,7 +131,6 @@ namespace hpx {
 #include <cstdint>
 #include <exception>
 #include <iterator>
-#include <list>
 #include <type_traits>
 #include <utility>
 
@@ -334,109 +333,6 @@ namespace hpx::parallel {
             recursive_partial_sort(
                 first, middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
         }
-
-        // Internal function to divide and sort the ranges
-        //
-        // policy : execution policy
-        // first : iterator to the first element
-        // middle: iterator defining the last element to be sorted
-        // last : iterator to the element after the end in the range
-        // level : level of depth from the top level call
-        // comp : object for to Comp elements
-        //
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp = Comp());
-
-        struct sort_thread_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return sort_thread(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        struct parallel_partial_sort_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return parallel_partial_sort(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp)
-        {
-            std::int64_t nelem = last - first;
-            std::int64_t const nmid = middle - first;
-            HPX_ASSERT(nelem >= nmid);
-
-            if (nelem == 0 || nmid == 0)
-            {
-                return hpx::make_ready_future(last);
-            }
-
-            if (nmid < 4096 || level < 12)
-            {
-                recursive_partial_sort(first, middle, last, level, comp);
-                return hpx::make_ready_future(last);
-            }
-
-            Iter c_last = filter(first, last, comp);
-            if (middle >= c_last)
-            {
-                // figure out the chunk size to use
-                std::size_t const cores =
-                    hpx::execution::experimental::processing_units_count(
-                        policy.parameters(), policy.executor(),
-                        hpx::chrono::null_duration, nelem);
-
-                // number of elements to sort
-                std::size_t chunk_size =
-                    hpx::execution::experimental::get_chunk_size(
-                        policy.parameters(), policy.executor(),
-                        hpx::chrono::null_duration, cores, nelem);
-
-                hpx::future<Iter> left = execution::async_execute(
-                    policy.executor(), sort_thread_helper(), policy, first,
-                    c_last, comp, chunk_size);
-
-                hpx::future<Iter> right;
-                if (middle != c_last)
-                {
-                    right = execution::async_execute(policy.executor(),
-                        parallel_partial_sort_helper(), policy, c_last + 1,
-                        middle, last, level - 1, comp);
-                }
-                else
-                {
-                    right = hpx::make_ready_future(last);
-                }
-
-                return hpx::dataflow(
-                    [last](hpx::future<Iter>&& leftf,
-                        hpx::future<Iter>&& rightf) -> Iter {
-                        if (leftf.has_exception() || rightf.has_exception())
-                        {
-                            std::list<std::exception_ptr> errors;
-                            if (leftf.has_exception())
-                                errors.push_back(leftf.get_exception_ptr());
-                            if (rightf.has_exception())
-                                errors.push_back(rightf.get_exception_ptr());
-
-                            throw exception_list(HPX_MOVE(errors));
-                        }
-                        return last;
-                    },
-                    HPX_MOVE(left), HPX_MOVE(right));
-            }
-
-            return parallel_partial_sort(HPX_FORWARD(ExPolicy, policy), first,
-                middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
-        }
         /// \endcond NOINTERNAL
     }    // end namespace detail
 
@@ -504,9 +400,33 @@ namespace hpx::parallel {
             }
         }
 
-        std::uint32_t level = parallel::detail::nbits64(nelem) * 2;
-        return detail::parallel_partial_sort(HPX_FORWARD(ExPolicy, policy),
-            first, middle, first + nelem, level, HPX_FORWARD(Comp, comp));
+        Iter last = first + nelem;
+        if (nmid == 0)
+        {
+            return hpx::make_ready_future(last);
+        }
+
+        // move the middle - first smallest elements to the front, the last
+        // of those is already at its final position; if all elements have
+        // to be sorted, no element is in place yet
+        Iter sort_last = middle;
+        if (nmid != nelem)
+        {
+            sort_last = middle - 1;
+
+            hpx::identity proj;
+            detail::parallel_sample_select(
+                policy, first, sort_last, last, comp, proj);
+        }
+
+        return hpx::dataflow(
+            hpx::launch::sync,
+            [last](hpx::future<Iter>&& f) -> Iter {
+                f.get();
+                return last;
+            },
+            detail::parallel_sort_async(HPX_FORWARD(ExPolicy, policy), first,
+                sort_last, HPX_FORWARD(Comp, comp)));
     }
 
     ///////////////////////////////////////////////////////////////////////
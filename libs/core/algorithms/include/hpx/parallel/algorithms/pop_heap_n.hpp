@@ -0,0 +1,357 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/pop_heap_n.hpp
+/// \page hpx::experimental::pop_heap_n
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Removes the \a count largest elements from the \a max \a heap
+    /// [first, last). Afterwards, [first, last - count) is a \a max \a heap
+    /// and [last - count, last) holds the removed elements in ascending
+    /// order, which is the same as calling std::pop_heap \a count times.
+    /// All elements are removed in a single step: the removed elements are
+    /// exchanged with the elements at the end of the heap, and the nodes
+    /// which received a new element are sifted down level by level, the
+    /// nodes of each level concurrently. Executed according to the policy.
+    ///
+    /// \note   Complexity: Performs O(count * log2(N)) applications of the
+    ///         comparison \a comp and each projection, where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the heap.
+    /// \param count        The number of elements to remove, this must not be
+    ///                     larger than the size of the heap.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// The comparison operations in the parallel \a pop_heap_n algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a pop_heap_n algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a pop_heap_n algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. The algorithm returns \a last.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    pop_heap_n(ExPolicy&& policy, RandIter first, RandIter last,
+        std::size_t count, Comp comp = Comp(), Proj proj = Proj());
+
+    /// Removes the \a count largest elements from the \a max \a heap
+    /// [first, last). Afterwards, [first, last - count) is a \a max \a heap
+    /// and [last - count, last) holds the removed elements in ascending
+    /// order, which is the same as calling std::pop_heap \a count times.
+    ///
+    /// \note   Complexity: Performs O(count * log2(N)) applications of the
+    ///         comparison \a comp and each projection, where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam RandIter    The type of the iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the heap.
+    /// \param count        The number of elements to remove, this must not be
+    ///                     larger than the size of the heap.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// \returns  The \a pop_heap_n algorithm returns \a last.
+    ///
+    template <typename RandIter, typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    RandIter pop_heap_n(RandIter first, RandIter last, std::size_t count,
+        Comp comp = Comp(), Proj proj = Proj());
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/make_heap.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+    template <typename ExPolicy, typename RandIter, typename Comp,
+        typename Proj>
+    RandIter pop_heap_n_helper(ExPolicy& policy, RandIter first,
+        RandIter last, std::size_t count, Comp& comp, Proj& proj)
+    {
+        using difference_type =
+            typename std::iterator_traits<RandIter>::difference_type;
+
+        auto const len = static_cast<std::size_t>(last - first);
+        HPX_ASSERT(count <= len);
+
+        if (count == 0)
+        {
+            return last;
+        }
+
+        // The largest elements form a subtree around the root. It is grown
+        // by adding the largest of the children of the nodes collected so
+        // far.
+        auto less = [&](std::size_t lhs, std::size_t rhs) {
+            return HPX_INVOKE(comp, HPX_INVOKE(proj, *(first + lhs)),
+                HPX_INVOKE(proj, *(first + rhs)));
+        };
+
+        std::vector<std::size_t> largest;
+        largest.reserve(count);
+
+        std::priority_queue<std::size_t, std::vector<std::size_t>,
+            decltype(less)>
+            candidates(less);
+        candidates.push(0);
+
+        while (largest.size() != count)
+        {
+            std::size_t const node = candidates.top();
+            candidates.pop();
+            largest.push_back(node);
+
+            for (std::size_t child = 2 * node + 1;
+                child != 2 * node + 3 && child < len; ++child)
+            {
+                candidates.push(child);
+            }
+        }
+
+        // The largest elements in front of the remaining heap are exchanged
+        // with the other elements at its end.
+        std::size_t const heap_len = len - count;
+        std::sort(largest.begin(), largest.end());
+
+        std::size_t const num_holes = static_cast<std::size_t>(
+            std::lower_bound(largest.begin(), largest.end(), heap_len) -
+            largest.begin());
+
+        std::vector<std::size_t> fill;
+        fill.reserve(num_holes);
+
+        auto it = largest.begin() + num_holes;
+        for (std::size_t pos = heap_len; pos != len; ++pos)
+        {
+            if (it != largest.end() && *it == pos)
+            {
+                ++it;
+            }
+            else
+            {
+                fill.push_back(pos);
+            }
+        }
+        HPX_ASSERT(fill.size() == num_holes);
+
+        heap_n_for_each(policy, num_holes, [&](std::size_t i) {
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+            std::ranges::iter_swap(first + largest[i], first + fill[i]);
+#else
+            std::iter_swap(first + largest[i], first + fill[i]);
+#endif
+        });
+
+        sort<RandIter>().call(policy, first + heap_len, last, comp, proj);
+
+        // The nodes which received a new element include all of their
+        // ancestors, they are sifted down level by level, starting with the
+        // deepest level. The nodes on the same level are independent of
+        // each other.
+        std::size_t end = num_holes;
+        while (end != 0)
+        {
+            std::size_t const level_first =
+                (std::size_t(1) << heap_level(largest[end - 1])) - 1;
+            std::size_t const begin = static_cast<std::size_t>(
+                std::lower_bound(
+                    largest.begin(), largest.begin() + end, level_first) -
+                largest.begin());
+
+            heap_n_for_each(policy, end - begin, [&](std::size_t i) {
+                sift_down(first, comp, proj,
+                    static_cast<difference_type>(heap_len),
+                    first + largest[begin + i]);
+            });
+
+            end = begin;
+        }
+
+        return last;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename RandIter>
+    struct pop_heap_n : public algorithm<pop_heap_n<RandIter>, RandIter>
+    {
+        constexpr pop_heap_n() noexcept
+          : algorithm<pop_heap_n, RandIter>("pop_heap_n")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static Iter sequential(ExPolicy, Iter first, Iter last,
+            std::size_t count, Comp&& comp, Proj&& proj)
+        {
+            return pop_heap_n_helper(
+                hpx::execution::seq, first, last, count, comp, proj);
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static util::detail::algorithm_result_t<ExPolicy, Iter> parallel(
+            ExPolicy&& policy, Iter first, Iter last, std::size_t count,
+            Comp&& comp, Proj&& proj)
+        {
+            auto run = [exec_policy = policy(hpx::execution::non_task), first,
+                           last, count, comp = HPX_FORWARD(Comp, comp),
+                           proj = HPX_FORWARD(Proj, proj)]() mutable -> Iter {
+                try
+                {
+                    return pop_heap_n_helper(
+                        exec_policy, first, last, count, comp, proj);
+                }
+                catch (hpx::exception_list const&)
+                {
+                    throw;
+                }
+                catch (...)
+                {
+                    util::detail::handle_local_exceptions<
+                        decltype(exec_policy)>::call(std::current_exception());
+                }
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return util::detail::algorithm_result<ExPolicy, Iter>::get(
+                    execution::async_execute(
+                        policy.executor(), HPX_MOVE(run)));
+            }
+            else
+            {
+                return util::detail::algorithm_result<ExPolicy, Iter>::get(
+                    run());
+            }
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    // clang-format off
+        requires (
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<RandIter>
+        )
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    pop_heap_n(ExPolicy&& policy, RandIter first, RandIter last,
+        std::size_t count, Comp comp = Comp(), Proj proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+            "Requires at least random access iterator.");
+
+        return hpx::parallel::detail::pop_heap_n<RandIter>().call(
+            HPX_FORWARD(ExPolicy, policy), first, last, count, HPX_MOVE(comp),
+            HPX_MOVE(proj));
+    }
+
+    template <typename RandIter, typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+        requires(hpx::traits::is_iterator_v<RandIter>)
+    RandIter pop_heap_n(RandIter first, RandIter last, std::size_t count,
+        Comp comp = Comp(), Proj proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+            "Requires at least random access iterator.");
+
+        return hpx::parallel::detail::pop_heap_n<RandIter>().call(
+            hpx::execution::seq, first, last, count, HPX_MOVE(comp),
+            HPX_MOVE(proj));
+    }
+}    // namespace hpx::experimental
+
+#endif
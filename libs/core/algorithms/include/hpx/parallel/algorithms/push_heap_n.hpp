@@ -0,0 +1,334 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/push_heap_n.hpp
+/// \page hpx::experimental::push_heap_n
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Inserts the last \a count elements of the range [first, last) into
+    /// the \a max \a heap [first, last - count), which makes [first, last) a
+    /// \a max \a heap. All elements are inserted in a single step, the
+    /// ancestors of the inserted elements are sifted down level by level,
+    /// the nodes of each level concurrently. If more elements are inserted
+    /// than the heap holds, the heap is rebuilt instead. Executed according
+    /// to the policy.
+    ///
+    /// \note   Complexity: Performs O(count * log2(N / count) + log2(N)^2)
+    ///         applications of the comparison \a comp and each projection,
+    ///         where N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the elements to insert.
+    /// \param count        The number of elements to insert, which are
+    ///                     located at the end of the range [first, last).
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// The comparison operations in the parallel \a push_heap_n algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a push_heap_n algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a push_heap_n algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. The algorithm returns \a last.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    push_heap_n(ExPolicy&& policy, RandIter first, RandIter last,
+        std::size_t count, Comp comp = Comp(), Proj proj = Proj());
+
+    /// Inserts the last \a count elements of the range [first, last) into
+    /// the \a max \a heap [first, last - count), which makes [first, last) a
+    /// \a max \a heap.
+    ///
+    /// \note   Complexity: Performs O(count * log2(N / count) + log2(N)^2)
+    ///         applications of the comparison \a comp and each projection,
+    ///         where N = std::distance(first, last).
+    ///
+    /// \tparam RandIter    The type of the iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the elements to insert.
+    /// \param count        The number of elements to insert, which are
+    ///                     located at the end of the range [first, last).
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// \returns  The \a push_heap_n algorithm returns \a last.
+    ///
+    template <typename RandIter, typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    RandIter push_heap_n(RandIter first, RandIter last, std::size_t count,
+        Comp comp = Comp(), Proj proj = Proj());
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/make_heap.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Invoke f(node_first, node_last) for the ranges of nodes which are
+    // ancestors of the nodes [first, last), level by level, starting with
+    // the deepest level. The nodes [first, last) must not have any children
+    // and are located on at most two adjacent levels.
+    template <typename F>
+    void for_each_heap_ancestor_level(
+        std::size_t first, std::size_t last, F&& f)
+    {
+        std::size_t const lo = first;
+        std::size_t const hi = last - 1;
+        std::size_t const level_lo = heap_level(lo);
+        std::size_t const level_hi = heap_level(hi);
+        HPX_ASSERT(level_hi <= level_lo + 1);
+
+        // the ancestor on the given level of node i located on level from
+        auto ancestor = [](std::size_t i, std::size_t from, std::size_t to) {
+            return ((i + 1) >> (from - to)) - 1;
+        };
+
+        for (std::size_t level = level_hi; level-- != 0;)
+        {
+            if (level_lo == level_hi)
+            {
+                f(ancestor(lo, level_lo, level),
+                    ancestor(hi, level_hi, level) + 1);
+                continue;
+            }
+
+            // The nodes on the deeper level start at the beginning of their
+            // level, the others reach up to the end of their level. The
+            // ancestors of both parts may overlap.
+            std::size_t const level_first = (std::size_t(1) << level) - 1;
+            std::size_t const level_last = 2 * level_first + 1;
+
+            std::size_t const left_last = ancestor(hi, level_hi, level) + 1;
+            if (level == level_lo)
+            {
+                f(level_first, left_last);
+                continue;
+            }
+
+            std::size_t const right_first = ancestor(lo, level_lo, level);
+            if (right_first <= left_last)
+            {
+                f(level_first, level_last);
+            }
+            else
+            {
+                f(level_first, left_last);
+                f(right_first, level_last);
+            }
+        }
+    }
+
+    template <typename ExPolicy, typename RandIter, typename Comp,
+        typename Proj>
+    RandIter push_heap_n_helper(ExPolicy& policy, RandIter first,
+        RandIter last, std::size_t count, Comp& comp, Proj& proj)
+    {
+        auto const len = static_cast<std::size_t>(last - first);
+        HPX_ASSERT(count <= len);
+
+        if (count == 0)
+        {
+            return last;
+        }
+
+        // rebuilding the heap is not more expensive than inserting more
+        // elements than the heap holds
+        if (count > len - count)
+        {
+            make_heap<RandIter>().call(policy, first, last, comp, proj);
+            return last;
+        }
+
+        // The inserted elements have no children, only their ancestors have
+        // to be sifted down. The ancestors on the same level are independent
+        // of each other.
+        for_each_heap_ancestor_level(len - count, len,
+            [&](std::size_t node_first, std::size_t node_last) {
+                heap_n_for_each(
+                    policy, node_last - node_first, [&](std::size_t i) {
+                        sift_down(first, comp, proj, last - first,
+                            first + (node_first + i));
+                    });
+            });
+
+        return last;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename RandIter>
+    struct push_heap_n : public algorithm<push_heap_n<RandIter>, RandIter>
+    {
+        constexpr push_heap_n() noexcept
+          : algorithm<push_heap_n, RandIter>("push_heap_n")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static Iter sequential(ExPolicy, Iter first, Iter last,
+            std::size_t count, Comp&& comp, Proj&& proj)
+        {
+            return push_heap_n_helper(
+                hpx::execution::seq, first, last, count, comp, proj);
+        }
+
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        static util::detail::algorithm_result_t<ExPolicy, Iter> parallel(
+            ExPolicy&& policy, Iter first, Iter last, std::size_t count,
+            Comp&& comp, Proj&& proj)
+        {
+            auto run = [exec_policy = policy(hpx::execution::non_task), first,
+                           last, count, comp = HPX_FORWARD(Comp, comp),
+                           proj = HPX_FORWARD(Proj, proj)]() mutable -> Iter {
+                try
+                {
+                    return push_heap_n_helper(
+                        exec_policy, first, last, count, comp, proj);
+                }
+                catch (hpx::exception_list const&)
+                {
+                    throw;
+                }
+                catch (...)
+                {
+                    util::detail::handle_local_exceptions<
+                        decltype(exec_policy)>::call(std::current_exception());
+                }
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return util::detail::algorithm_result<ExPolicy, Iter>::get(
+                    execution::async_execute(
+                        policy.executor(), HPX_MOVE(run)));
+            }
+            else
+            {
+                return util::detail::algorithm_result<ExPolicy, Iter>::get(
+                    run());
+            }
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    template <typename ExPolicy, typename RandIter,
+        typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+    // clang-format off
+        requires (
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<RandIter>
+        )
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    push_heap_n(ExPolicy&& policy, RandIter first, RandIter last,
+        std::size_t count, Comp comp = Comp(), Proj proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+            "Requires at least random access iterator.");
+
+        return hpx::parallel::detail::push_heap_n<RandIter>().call(
+            HPX_FORWARD(ExPolicy, policy), first, last, count, HPX_MOVE(comp),
+            HPX_MOVE(proj));
+    }
+
+    template <typename RandIter, typename Comp = hpx::parallel::detail::less,
+        typename Proj = hpx::identity>
+        requires(hpx::traits::is_iterator_v<RandIter>)
+    RandIter push_heap_n(RandIter first, RandIter last, std::size_t count,
+        Comp comp = Comp(), Proj proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+            "Requires at least random access iterator.");
+
+        return hpx::parallel::detail::push_heap_n<RandIter>().call(
+            hpx::execution::seq, first, last, count, HPX_MOVE(comp),
+            HPX_MOVE(proj));
+    }
+}    // namespace hpx::experimental
+
+#endif
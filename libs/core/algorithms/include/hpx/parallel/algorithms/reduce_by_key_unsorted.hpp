@@ -0,0 +1,448 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/reduce_by_key_unsorted.hpp
+/// \page hpx::experimental::reduce_by_key_unsorted
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+    /// Reduces all values with equal keys, regardless of where the keys are
+    /// located in [key_first, key_last). Unlike \a reduce_by_key, the keys do
+    /// not have to be sorted or grouped. The algorithm produces a single
+    /// output key and value for each set of equal keys, the value being the
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(func, v1, ..., vN), where v1, ..., vN
+    /// are the values of all elements with equal keys in the order in which
+    /// they appear in the input sequence. The number of keys supplied must
+    /// match the number of values.
+    ///
+    /// The keys are aggregated using hash tables: each task aggregates its
+    /// part of the input into separate tables for a number of partitions
+    /// selected by the hash values of the keys, afterwards the tables of
+    /// each partition are merged in parallel.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of the
+    ///         hash function \a hash and on average
+    ///         O(\a key_last - \a key_first) applications of \a func and
+    ///         \a key_equal.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a reduce_by_key_unsorted requires
+    ///                     \a Func to meet the requirements of
+    ///                     \a CopyConstructible.
+    /// \tparam Hash        The type of the function object used to hash the
+    ///                     keys (deduced). Assumed to be std::hash otherwise.
+    /// \tparam KeyEqual    The type of the function object used to compare
+    ///                     keys for equality (deduced). Assumed to be
+    ///                     std::equal_to otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the
+    ///                     values produced by the algorithm.
+    /// \param func         Specifies the function (or function object) used
+    ///                     to combine two values. It has to be associative,
+    ///                     it does not have to be commutative. The signature
+    ///                     of this function should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The type \a Ret must be implicitly convertible
+    ///                     to the value type of \a RanIter2.
+    /// \param hash         Specifies the function object used to hash the
+    ///                     keys. Equal keys must have equal hash values.
+    /// \param key_equal    Specifies the function object used to compare two
+    ///                     keys for equality.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \note   The order of the keys (and their values) written to the output
+    ///         ranges is unspecified.
+    ///
+    /// \returns  The \a reduce_by_key_unsorted algorithm returns a
+    ///           \a hpx::future<in_out_result<FwdIter1,FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1,FwdIter2> otherwise. The result
+    ///           refers to the end of the written key and value ranges.
+    ///
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Func = std::plus<>,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual = std::equal_to<>>
+    typename util::detail::algorithm_result<ExPolicy,
+        util::in_out_result<FwdIter1, FwdIter2>>::type
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Func func = Func(), Hash hash = Hash(),
+        KeyEqual key_equal = KeyEqual());
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // The minimal number of elements handled by a single task
+    inline constexpr std::size_t reduce_by_key_unsorted_min_chunk_size =
+        4096ul;
+
+    // Map a hash value onto [0, num_partitions). The hash value is scrambled
+    // first (Fibonacci hashing) and its upper bits are used, as the lower bits
+    // select the buckets inside of the hash tables.
+    constexpr std::size_t reduce_by_key_partition(
+        std::size_t hash, std::size_t num_partitions) noexcept
+    {
+        std::uint64_t const h =
+            static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+        return static_cast<std::size_t>(((h >> 32) * num_partitions) >> 32);
+    }
+
+    // Combine the given value with the value already stored for the given
+    // key, if any. The value stored in the table is the left operand.
+    template <typename Map, typename Key, typename Value, typename Func>
+    void reduce_by_key_aggregate(
+        Map& map, Key&& key, Value&& value, Func& func)
+    {
+        // try_emplace does not touch the value if the key is present already
+        auto [it, inserted] =
+            map.try_emplace(HPX_FORWARD(Key, key), HPX_FORWARD(Value, value));
+        if (!inserted)
+        {
+            it->second = HPX_INVOKE(
+                func, HPX_MOVE(it->second), HPX_FORWARD(Value, value));
+        }
+    }
+
+    // Append the contents of the table src to the table dst, src refers to
+    // values following the ones aggregated in dst in the input sequence.
+    template <typename Map, typename Func>
+    void reduce_by_key_merge(Map& dst, Map& src, Func& func)
+    {
+        // moves all nodes of src whose keys are not yet present in dst
+        dst.merge(src);
+        for (auto& [key, value] : src)
+        {
+            auto& dst_value = dst.find(key)->second;
+            dst_value = HPX_INVOKE(func, HPX_MOVE(dst_value), HPX_MOVE(value));
+        }
+        src.clear();
+    }
+
+    template <typename Map, typename FwdIter1, typename FwdIter2>
+    util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_copy_out(
+        Map& map, FwdIter1 keys_output, FwdIter2 values_output)
+    {
+        for (auto& [key, value] : map)
+        {
+            *keys_output++ = key;
+            *values_output++ = HPX_MOVE(value);
+        }
+        return {keys_output, values_output};
+    }
+
+    template <typename RanIter, typename RanIter2, typename Hash,
+        typename KeyEqual>
+    using reduce_by_key_map_t =
+        std::unordered_map<hpx::traits::iter_value_t<RanIter>,
+            hpx::traits::iter_value_t<RanIter2>, Hash, KeyEqual>;
+
+    template <typename RanIter, typename RanIter2, typename FwdIter1,
+        typename FwdIter2, typename Func, typename Hash, typename KeyEqual>
+    util::in_out_result<FwdIter1, FwdIter2> sequential_reduce_by_key_unsorted(
+        RanIter key_first, std::size_t count, RanIter2 values_first,
+        FwdIter1 keys_output, FwdIter2 values_output, Func& func, Hash& hash,
+        KeyEqual& key_equal)
+    {
+        reduce_by_key_map_t<RanIter, RanIter2, Hash, KeyEqual> map(
+            0, hash, key_equal);
+
+        for (std::size_t i = 0; i != count; ++i, ++key_first, ++values_first)
+        {
+            reduce_by_key_aggregate(map, *key_first, *values_first, func);
+        }
+
+        return reduce_by_key_copy_out(map, keys_output, values_output);
+    }
+
+    template <typename ExPolicy, typename Exec, typename F>
+    void reduce_by_key_bulk(Exec& exec, std::size_t num_tasks, F&& f)
+    {
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(num_tasks));
+
+        auto&& workitems =
+            execution::bulk_async_execute(exec, HPX_FORWARD(F, f), shape);
+
+        hpx::wait_all(workitems);
+        util::detail::handle_local_exceptions<ExPolicy>::call(workitems);
+    }
+
+    // Parallel hash aggregation. Every task aggregates its chunk of the input
+    // into one hash table per partition, the partition of a key being
+    // selected by its hash value. Afterwards, every task merges the tables of
+    // one partition (in the order of the chunks, thus only associativity is
+    // required from func) and writes the result to its part of the output.
+    template <typename ExPolicy, typename Exec, typename RanIter,
+        typename RanIter2, typename FwdIter1, typename FwdIter2, typename Func,
+        typename Hash, typename KeyEqual>
+    util::in_out_result<FwdIter1, FwdIter2> parallel_reduce_by_key_unsorted(
+        Exec& exec, std::size_t cores, RanIter key_first, std::size_t count,
+        RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+        Func& func, Hash& hash, KeyEqual& key_equal)
+    {
+        std::size_t const num_tasks = (std::max) (std::size_t(1),
+            (std::min) (cores, count / reduce_by_key_unsorted_min_chunk_size));
+        if (num_tasks == 1)
+        {
+            return sequential_reduce_by_key_unsorted(key_first, count,
+                values_first, keys_output, values_output, func, hash,
+                key_equal);
+        }
+
+        std::size_t const chunk_size = (count + num_tasks - 1) / num_tasks;
+        std::size_t const num_partitions = num_tasks;
+
+        using map_type = reduce_by_key_map_t<RanIter, RanIter2, Hash, KeyEqual>;
+
+        // tables[task * num_partitions + partition]
+        std::vector<map_type> tables;
+        tables.reserve(num_tasks * num_partitions);
+        for (std::size_t i = 0; i != num_tasks * num_partitions; ++i)
+        {
+            tables.emplace_back(0, hash, key_equal);
+        }
+
+        reduce_by_key_bulk<ExPolicy>(exec, num_tasks, [&](std::size_t task) {
+            map_type* local = &tables[task * num_partitions];
+
+            std::size_t const begin = task * chunk_size;
+            std::size_t const end = (std::min) (begin + chunk_size, count);
+
+            RanIter keys = key_first + begin;
+            RanIter2 values = values_first + begin;
+            for (std::size_t i = begin; i != end; ++i, ++keys, ++values)
+            {
+                auto&& key = *keys;
+                std::size_t const partition = reduce_by_key_partition(
+                    HPX_INVOKE(hash, key), num_partitions);
+                reduce_by_key_aggregate(local[partition],
+                    HPX_FORWARD(decltype(key), key), *values, func);
+            }
+        });
+
+        // merge the tables of each partition into the table of the first task
+        reduce_by_key_bulk<ExPolicy>(
+            exec, num_partitions, [&](std::size_t partition) {
+                map_type& dst = tables[partition];
+                for (std::size_t task = 1; task != num_tasks; ++task)
+                {
+                    reduce_by_key_merge(
+                        dst, tables[task * num_partitions + partition], func);
+                }
+            });
+
+        // every partition is written to a separate part of the output
+        std::vector<std::size_t> offsets(num_partitions + 1, 0);
+        for (std::size_t partition = 0; partition != num_partitions;
+            ++partition)
+        {
+            offsets[partition + 1] =
+                offsets[partition] + tables[partition].size();
+        }
+
+        reduce_by_key_bulk<ExPolicy>(
+            exec, num_partitions, [&](std::size_t partition) {
+                reduce_by_key_copy_out(tables[partition],
+                    std::next(keys_output, offsets[partition]),
+                    std::next(values_output, offsets[partition]));
+            });
+
+        std::size_t const total = offsets[num_partitions];
+        return {std::next(keys_output, total),
+            std::next(values_output, total)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // reduce_by_key_unsorted wrapper struct
+    template <typename FwdIter1, typename FwdIter2>
+    struct reduce_by_key_unsorted
+      : public algorithm<reduce_by_key_unsorted<FwdIter1, FwdIter2>,
+            util::in_out_result<FwdIter1, FwdIter2>>
+    {
+        constexpr reduce_by_key_unsorted() noexcept
+          : algorithm<reduce_by_key_unsorted,
+                util::in_out_result<FwdIter1, FwdIter2>>(
+                "reduce_by_key_unsorted")
+        {
+        }
+
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename Func, typename Hash, typename KeyEqual>
+        static util::in_out_result<FwdIter1, FwdIter2> sequential(ExPolicy&&,
+            RanIter key_first, RanIter key_last, RanIter2 values_first,
+            FwdIter1 keys_output, FwdIter2 values_output, Func&& func,
+            Hash&& hash, KeyEqual&& key_equal)
+        {
+            return sequential_reduce_by_key_unsorted(key_first,
+                static_cast<std::size_t>(std::distance(key_first, key_last)),
+                values_first, keys_output, values_output, func, hash,
+                key_equal);
+        }
+
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename Func, typename Hash, typename KeyEqual>
+        static util::detail::algorithm_result_t<ExPolicy,
+            util::in_out_result<FwdIter1, FwdIter2>>
+        parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+            Func&& func, Hash&& hash, KeyEqual&& key_equal)
+        {
+            using result_type = util::in_out_result<FwdIter1, FwdIter2>;
+
+            std::size_t const count =
+                static_cast<std::size_t>(std::distance(key_first, key_last));
+            std::size_t const cores =
+                hpx::execution::experimental::processing_units_count(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, count);
+
+            auto run = [exec = policy.executor(), cores, key_first, count,
+                           values_first, keys_output, values_output,
+                           func = HPX_FORWARD(Func, func),
+                           hash = HPX_FORWARD(Hash, hash),
+                           key_equal = HPX_FORWARD(KeyEqual, key_equal)]()
+                mutable -> result_type {
+                return parallel_reduce_by_key_unsorted<std::decay_t<ExPolicy>>(
+                    exec, cores, key_first, count, values_first, keys_output,
+                    values_output, func, hash, key_equal);
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return util::detail::algorithm_result<ExPolicy, result_type>::
+                    get(execution::async_execute(
+                        policy.executor(), HPX_MOVE(run)));
+            }
+            else
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(run());
+            }
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2, typename Func = std::plus<>,
+        typename Hash = std::hash<hpx::traits::iter_value_t<RanIter>>,
+        typename KeyEqual = std::equal_to<>>
+    // clang-format off
+        requires (
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<RanIter> &&
+            hpx::traits::is_iterator_v<RanIter2> &&
+            hpx::traits::is_iterator_v<FwdIter1> &&
+            hpx::traits::is_iterator_v<FwdIter2>
+        )
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>>
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Func func = Func(), Hash hash = Hash(),
+        KeyEqual key_equal = KeyEqual())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RanIter> &&
+                hpx::traits::is_random_access_iterator_v<RanIter2> &&
+                hpx::traits::is_forward_iterator_v<FwdIter1> &&
+                hpx::traits::is_forward_iterator_v<FwdIter2>,
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return hpx::parallel::detail::reduce_by_key_unsorted<FwdIter1,
+            FwdIter2>()
+            .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                values_first, keys_output, values_output, HPX_MOVE(func),
+                HPX_MOVE(hash), HPX_MOVE(key_equal));
+    }
+}    // namespace hpx::experimental
+
+#endif
@@ -371,7 +371,6 @@ namespace hpx {
 
 #include <algorithm>
 #include <cstddef>
-#include <cstring>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -397,11 +396,6 @@ namespace hpx::parallel {
             static constexpr T sequential(ExPolicy&& policy, InIterB first,
                 InIterE last, T_&& init, Reduce&& r)
             {
-                // TODO: abstract initializing memory
-                hpx::parallel::detail::rfa::RFA_bins<T_> bins;
-                bins.initialize_bins();
-                std::memcpy(hpx::parallel::detail::rfa::hpx_rfa_bin_host_buffer,
-                    &bins, sizeof(bins));
                 return hpx::parallel::detail::sequential_reduce_deterministic<
                     ExPolicy>(HPX_FORWARD(ExPolicy, policy), first, last,
                     HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r));
@@ -420,17 +414,10 @@ namespace hpx::parallel {
                         HPX_FORWARD(T_, init));
                 }
 
-                // TODO: abstract initializing memory
-                hpx::parallel::detail::rfa::RFA_bins<T_> bins;
-                bins.initialize_bins();
-                std::memcpy(hpx::parallel::detail::rfa::hpx_rfa_bin_host_buffer,
-                    &bins, sizeof(bins));
-
                 auto f1 = [policy](FwdIterB part_begin, std::size_t part_size)
                     -> hpx::parallel::detail::rfa::
                         reproducible_floating_accumulator<T_> {
                             T_ val = *part_begin;
-                            // Assumed that hpx_rfa_bin_host_buffer is initiallized
                             return hpx::parallel::detail::
                                 sequential_reduce_deterministic_rfa<ExPolicy>(
                                     HPX_FORWARD(ExPolicy, policy), ++part_begin,
@@ -444,7 +431,6 @@ namespace hpx::parallel {
                     call(HPX_FORWARD(ExPolicy, policy), first,
                         detail::distance(first, last), HPX_MOVE(f1),
                         hpx::unwrapping([policy, init](auto&& results) -> T_ {
-                            // Assumed that hpx_rfa_bin_host_buffer is initiallized
                             hpx::parallel::detail::rfa::
                                 reproducible_floating_accumulator<T_>
                                     rfa;
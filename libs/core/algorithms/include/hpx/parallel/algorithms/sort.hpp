@@ -158,12 +158,15 @@ namespace hpx {
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -174,6 +177,7 @@ namespace hpx {
 #include <exception>
 #include <iterator>
 #include <list>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -186,18 +190,80 @@ namespace hpx::parallel {
         /// \cond NOINTERNAL
         inline constexpr std::size_t sort_limit_per_task = 65536ul;
 
+        // Ranges smaller than this are partitioned sequentially
+        inline constexpr std::size_t sort_parallel_partition_limit = 1048576ul;
+
+        // Sorts the leaves of the recursion. The datapar execution policies
+        // sort arithmetic keys using sorting networks on vector packs (see
+        // datapar/sort.hpp).
+        template <typename ExPolicy>
+        struct sequential_sort_t final
+          : hpx::functional::detail::tag_fallback<sequential_sort_t<ExPolicy>>
+        {
+        private:
+            template <typename RandomIt, typename Comp>
+            friend constexpr void tag_fallback_invoke(
+                sequential_sort_t, RandomIt first, RandomIt last, Comp&& comp)
+            {
+                std::sort(first, last, comp);
+            }
+        };
+
+        template <typename ExPolicy>
+        inline constexpr sequential_sort_t<ExPolicy> sequential_sort =
+            sequential_sort_t<ExPolicy>{};
+
+        // Partition [first, last) around the pivot stored at *first using the
+        // parallel block partitioning of hpx::partition. Returns the range of
+        // elements equal to the pivot, which is excluded from the recursion.
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        std::pair<RandomIt, RandomIt> sort_parallel_partition(
+            ExPolicy& policy, RandomIt first, RandomIt last, Comp& comp)
+        {
+            using reference =
+                typename std::iterator_traits<RandomIt>::reference;
+
+            // the pivot is not moved while partitioning [first + 1, last)
+            reference val = *first;
+
+            RandomIt c_first = partition_helper::call(
+                policy, first + 1, last,
+                [&](auto const& x) -> bool { return comp(x, val); },
+                hpx::identity_v);
+            RandomIt c_last = c_first;
+
+            // A small left partition hints at many elements being equal to the
+            // pivot, separate those to guarantee progress for the recursion.
+            if (c_first - first < (last - first) / 8)
+            {
+                c_last = partition_helper::call(
+                    policy, c_first, last,
+                    [&](auto const& x) -> bool { return !comp(val, x); },
+                    hpx::identity_v);
+            }
+
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+            std::ranges::iter_swap(first, c_first - 1);
+#else
+            std::iter_swap(first, c_first - 1);
+#endif
+            return {c_first - 1, c_last};
+        }
+
         // \brief this function is the work assigned to each thread in the
         //        parallel process
         template <typename ExPolicy, typename RandomIt, typename Comp>
         hpx::future<RandomIt> sort_thread(ExPolicy&& policy, RandomIt first,
-            RandomIt last, Comp comp, std::size_t chunk_size)
+            RandomIt last, Comp comp, std::size_t chunk_size,
+            std::size_t partition_limit)
         {
             std::ptrdiff_t const N = last - first;
             if (static_cast<std::size_t>(N) <= chunk_size)
             {
                 return execution::async_execute(policy.executor(),
                     [first, last, comp = HPX_MOVE(comp)]() -> RandomIt {
-                        std::sort(first, last, comp);
+                        sequential_sort<std::decay_t<ExPolicy>>(
+                            first, last, comp);
                         return last;
                     });
             }
@@ -211,27 +277,22 @@ namespace hpx::parallel {
             // pivot selections
             pivot9(first, last, comp);
 
-            using reference =
-                typename std::iterator_traits<RandomIt>::reference;
-
-            reference val = *first;
-            RandomIt c_first = first + 1, c_last = last - 1;
-
-            while (comp(*c_first, val))
+            RandomIt c_first, c_last;
+            if (static_cast<std::size_t>(N) >= partition_limit)
             {
-                ++c_first;
+                // the top levels of the recursion partition in parallel
+                std::tie(c_last, c_first) =
+                    sort_parallel_partition(policy, first, last, comp);
             }
-            while (comp(val, *c_last))
+            else
             {
-                --c_last;
-            }
-            while (c_first < c_last)
-            {
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                std::ranges::iter_swap(c_first++, c_last--);
-#else
-                std::iter_swap(c_first++, c_last--);
-#endif
+                using reference =
+                    typename std::iterator_traits<RandomIt>::reference;
+
+                reference val = *first;
+                c_first = first + 1;
+                c_last = last - 1;
+
                 while (comp(*c_first, val))
                 {
                     ++c_first;
@@ -240,22 +301,38 @@ namespace hpx::parallel {
                 {
                     --c_last;
                 }
-            }
+                while (c_first < c_last)
+                {
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                    std::ranges::iter_swap(c_first++, c_last--);
+#else
+                    std::iter_swap(c_first++, c_last--);
+#endif
+                    while (comp(*c_first, val))
+                    {
+                        ++c_first;
+                    }
+                    while (comp(val, *c_last))
+                    {
+                        --c_last;
+                    }
+                }
 
 #if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-            std::ranges::iter_swap(first, c_last);
+                std::ranges::iter_swap(first, c_last);
 #else
-            std::iter_swap(first, c_last);
+                std::iter_swap(first, c_last);
 #endif
+            }
 
             // spawn tasks for each sub section
             hpx::future<RandomIt> left = execution::async_execute(
                 policy.executor(), &sort_thread<ExPolicy, RandomIt, Comp>,
-                policy, first, c_last, comp, chunk_size);
+                policy, first, c_last, comp, chunk_size, partition_limit);
 
             hpx::future<RandomIt> right = execution::async_execute(
                 policy.executor(), &sort_thread<ExPolicy, RandomIt, Comp>,
-                policy, c_first, last, comp, chunk_size);
+                policy, c_first, last, comp, chunk_size, partition_limit);
 
             return hpx::dataflow(
                 [last](hpx::future<RandomIt>&& leftf,
@@ -313,7 +390,7 @@ namespace hpx::parallel {
 
             if (count < chunk_size)
             {
-                std::sort(first, last, comp);
+                sequential_sort<std::decay_t<ExPolicy>>(first, last, comp);
                 return hpx::make_ready_future(last);
             }
 
@@ -323,10 +400,16 @@ namespace hpx::parallel {
                 return hpx::make_ready_future(last);
             }
 
+            // partition in parallel as long as there are fewer sub-ranges
+            // than cores, i.e. for the top O(log(cores)) levels
+            std::size_t const partition_limit = cores > 1 ?
+                (std::max) (count / cores, sort_parallel_partition_limit) :
+                count + 1;
+
             return execution::async_execute(policy.executor(),
                 &sort_thread<std::decay_t<ExPolicy>, RandomIt, Comp>,
                 HPX_FORWARD(ExPolicy, policy), first, last,
-                HPX_FORWARD(Comp, comp), chunk_size);
+                HPX_FORWARD(Comp, comp), chunk_size, partition_limit);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -345,7 +428,7 @@ namespace hpx::parallel {
                 ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                std::sort(first, last_iter,
+                sequential_sort<ExPolicy>(first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
                 return last_iter;
             }
@@ -362,6 +445,20 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic keys compared using less or greater are
+                    // sorted using a radix sort
+                    if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                    {
+                        if (static_cast<std::size_t>(last - first) >=
+                            radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async<Comp>(
+                                    HPX_FORWARD(ExPolicy, policy), first, last,
+                                    proj));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
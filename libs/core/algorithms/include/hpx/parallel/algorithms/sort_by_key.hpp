@@ -99,6 +99,7 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -125,6 +126,13 @@ namespace hpx::parallel {
                 return hpx::get<0>(HPX_FORWARD(Tuple, t));
             }
         };
+
+        // sort_by_key sorts by the keys only, arithmetic keys can be sorted
+        // using a radix sort
+        template <>
+        struct is_radix_sort_projection<extract_key> : std::true_type
+        {
+        };
         /// \endcond
     }    // namespace detail
 }    // namespace hpx::parallel
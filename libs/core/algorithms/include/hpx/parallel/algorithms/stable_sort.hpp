@@ -163,6 +163,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -220,6 +221,28 @@ namespace hpx::parallel {
                 std::size_t count =
                     detail::advance_and_get_distance(last_iter, last);
 
+                // arithmetic keys compared using less or greater are sorted
+                // using a (stable) radix sort
+                if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                {
+                    if (count >= radix_sort_limit)
+                    {
+                        try
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async<Compare>(
+                                    HPX_FORWARD(ExPolicy, policy), first,
+                                    last_iter, proj));
+                        }
+                        catch (...)
+                        {
+                            return algorithm_result::get(
+                                detail::handle_exception<ExPolicy,
+                                    RandomIt>::call(std::current_exception()));
+                        }
+                    }
+                }
+
                 // figure out the chunk size to use
                 std::size_t cores =
                     hpx::execution::experimental::processing_units_count(
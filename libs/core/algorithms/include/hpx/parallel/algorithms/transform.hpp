@@ -288,6 +288,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/non_temporal_stores.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/transform_loop.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
@@ -453,6 +454,41 @@ namespace hpx::parallel {
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Used instead of transform_iteration and transform_binary_iteration
+        // if the results are written using streaming stores. F is invoked
+        // with the input iterators (see transform_projected and
+        // transform_binary_projected).
+        template <typename F>
+        struct transform_stream_iteration
+        {
+            F f_;
+
+            template <typename Iter>
+            void operator()(Iter part_begin, std::size_t part_size, std::size_t)
+            {
+                auto iters = part_begin.get_iterator_tuple();
+                if constexpr (hpx::tuple_size_v<decltype(iters)> == 2)
+                {
+                    auto it = hpx::get<0>(iters);
+                    util::stream_generate_n(hpx::get<1>(iters), part_size,
+                        [&]() { return HPX_INVOKE(f_, it++); });
+                }
+                else
+                {
+                    auto it1 = hpx::get<0>(iters);
+                    auto it2 = hpx::get<1>(iters);
+                    util::stream_generate_n(
+                        hpx::get<2>(iters), part_size, [&]() {
+                            auto&& result = HPX_INVOKE(f_, it1, it2);
+                            ++it1;
+                            ++it2;
+                            return result;
+                        });
+                }
+            }
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct transform : public algorithm<transform<IterPair>, IterPair>
@@ -509,15 +545,33 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = transform_iteration<ExPolicy, F, Proj>(
-                    HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
-
-                return util::detail::get_in_out_result(
-                    util::foreach_partitioner<ExPolicy>::call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        hpx::util::zip_iterator(first, dest),
-                        detail::distance(first, last), HPX_MOVE(f1),
-                        hpx::identity_v));
+                if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                  FwdIter2>)
+                {
+                    using projected_type = transform_projected<F, Proj>;
+
+                    return util::detail::get_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first, dest),
+                            detail::distance(first, last),
+                            transform_stream_iteration<projected_type>{
+                                projected_type(HPX_FORWARD(F, f),
+                                    HPX_FORWARD(Proj, proj))},
+                            hpx::identity_v));
+                }
+                else
+                {
+                    auto f1 = transform_iteration<ExPolicy, F, Proj>(
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+
+                    return util::detail::get_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first, dest),
+                            detail::distance(first, last), HPX_MOVE(f1),
+                            hpx::identity_v));
+                }
             }
         };
         /// \endcond
@@ -739,16 +793,37 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
-                    HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
-                    HPX_FORWARD(Proj2, proj2));
-
-                return util::detail::get_in_in_out_result(
-                    util::foreach_partitioner<ExPolicy>::call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        hpx::util::zip_iterator(first1, first2, dest),
-                        detail::distance(first1, last1), HPX_MOVE(f1),
-                        hpx::identity_v));
+                if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                  FwdIter3>)
+                {
+                    using projected_type =
+                        transform_binary_projected<F, Proj1, Proj2>;
+
+                    return util::detail::get_in_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first1, first2, dest),
+                            detail::distance(first1, last1),
+                            transform_stream_iteration<projected_type>{
+                                projected_type(HPX_FORWARD(F, f),
+                                    HPX_FORWARD(Proj1, proj1),
+                                    HPX_FORWARD(Proj2, proj2))},
+                            hpx::identity_v));
+                }
+                else
+                {
+                    auto f1 =
+                        transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
+                            HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+                            HPX_FORWARD(Proj2, proj2));
+
+                    return util::detail::get_in_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first1, first2, dest),
+                            detail::distance(first1, last1), HPX_MOVE(f1),
+                            hpx::identity_v));
+                }
             }
         };
         /// \endcond
@@ -819,20 +894,40 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
-                    HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
-                    HPX_FORWARD(Proj2, proj2));
-
-                // different versions of clang-format do different things
-                // clang-format off
-                return util::detail::get_in_in_out_result(
-                    util::foreach_partitioner<ExPolicy>::call(
-                        HPX_FORWARD(ExPolicy, policy),
-                        hpx::util::zip_iterator(first1, first2, dest),
-                        (std::min) (detail::distance(first1, last1),
-                            detail::distance(first2, last2)),
-                        HPX_MOVE(f1), hpx::identity_v));
-                // clang-format on
+                std::size_t const count = (std::min) (
+                    detail::distance(first1, last1),
+                    detail::distance(first2, last2));
+
+                if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                  FwdIter3>)
+                {
+                    using projected_type =
+                        transform_binary_projected<F, Proj1, Proj2>;
+
+                    return util::detail::get_in_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first1, first2, dest),
+                            count,
+                            transform_stream_iteration<projected_type>{
+                                projected_type(HPX_FORWARD(F, f),
+                                    HPX_FORWARD(Proj1, proj1),
+                                    HPX_FORWARD(Proj2, proj2))},
+                            hpx::identity_v));
+                }
+                else
+                {
+                    auto f1 =
+                        transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
+                            HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
+                            HPX_FORWARD(Proj2, proj2));
+
+                    return util::detail::get_in_in_out_result(
+                        util::foreach_partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::util::zip_iterator(first1, first2, dest),
+                            count, HPX_MOVE(f1), hpx::identity_v));
+                }
             }
         };
         /// \endcond
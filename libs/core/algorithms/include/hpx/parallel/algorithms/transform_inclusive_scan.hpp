@@ -380,6 +380,17 @@ namespace hpx::parallel {
             return init;
         }
 
+        template <typename InIter, typename Conv, typename T, typename Op>
+        static constexpr T sequential_transform_reduce_n(
+            InIter first, std::size_t count, Conv&& conv, T init, Op&& op)
+        {
+            for (/**/; count-- != 0; ++first)
+            {
+                init = HPX_INVOKE(op, init, HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct transform_inclusive_scan
@@ -444,43 +455,85 @@ namespace hpx::parallel {
 
                 using hpx::get;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                // step 4 use this return value
+                auto f4 = [last_iter, final_dest](std::vector<T>&&,
+                              std::vector<hpx::future<void>>&& data)
+                    -> result_type {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    util::detail::clear_container(data);
+                    return result_type{last_iter, final_dest};
                 };
 
-                return util::scan_partitioner<ExPolicy, result_type, T>::call(
-                    HPX_FORWARD(ExPolicy, policy), zip_iterator(first, dest),
-                    count, init,
-                    // step 1 performs first part of scan algorithm
-                    [op, conv](zip_iterator part_begin,
-                        std::size_t part_size) mutable -> T {
-                        T part_init = HPX_INVOKE(conv, get<0>(*part_begin));
-                        get<1>(*part_begin++) = part_init;
-
-                        auto iters = part_begin.get_iterator_tuple();
-                        return sequential_transform_inclusive_scan_n(
-                            get<0>(iters), part_size - 1, get<1>(iters), conv,
-                            part_init, op);
-                    },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    op,
-                    // step 3 runs final accumulation on each partition
-                    HPX_MOVE(f3),
-                    // step 4 use this return value
-                    [last_iter, final_dest](std::vector<T>&&,
-                        std::vector<hpx::future<void>>&& data) -> result_type {
-                        // make sure iterators embedded in function object that is
-                        // attached to futures are invalidated
-                        util::detail::clear_container(data);
-                        return result_type{last_iter, final_dest};
-                    });
+                if constexpr (util::uses_single_pass_scan_v<ExPolicy>)
+                {
+                    // The first step only reduces each partition, the third
+                    // step scans it starting off the accumulated value. The
+                    // single-pass scan runs both steps on the same (cached)
+                    // partition, which touches the destination only once.
+                    return util::scan_partitioner<ExPolicy, result_type, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 reduces each partition
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size) mutable -> T {
+                                FwdIter1 src =
+                                    get<0>(part_begin.get_iterator_tuple());
+                                T part_init = HPX_INVOKE(conv, *src);
+                                return sequential_transform_reduce_n(
+                                    ++src, part_size - 1, conv, part_init, op);
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 scans each partition
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size, T val) mutable -> void {
+                                auto iters = part_begin.get_iterator_tuple();
+                                sequential_transform_inclusive_scan_n(
+                                    get<0>(iters), part_size, get<1>(iters),
+                                    conv, val, op);
+                            },
+                            HPX_MOVE(f4));
+                }
+                else
+                {
+                    auto f3 = [op](zip_iterator part_begin,
+                                  std::size_t part_size,
+                                  T val) mutable -> void {
+                        FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
+
+                        util::loop_n<std::decay_t<ExPolicy>>(dst, part_size,
+                            [&op, &val](FwdIter2 it) -> void {
+                                *it = HPX_INVOKE(op, val, *it);
+                            });
+                    };
+
+                    return util::scan_partitioner<ExPolicy, result_type, T>::
+                        call(
+                            HPX_FORWARD(ExPolicy, policy),
+                            zip_iterator(first, dest), count, init,
+                            // step 1 performs first part of scan algorithm
+                            [op, conv](zip_iterator part_begin,
+                                std::size_t part_size) mutable -> T {
+                                T part_init =
+                                    HPX_INVOKE(conv, get<0>(*part_begin));
+                                get<1>(*part_begin++) = part_init;
+
+                                auto iters = part_begin.get_iterator_tuple();
+                                return sequential_transform_inclusive_scan_n(
+                                    get<0>(iters), part_size - 1,
+                                    get<1>(iters), conv, part_init, op);
+                            },
+                            // step 2 propagates the partition results from
+                            // left to right
+                            op,
+                            // step 3 runs final accumulation on each partition
+                            HPX_MOVE(f3),
+                            // step 4 use this return value
+                            HPX_MOVE(f4));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -431,6 +431,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -462,10 +463,23 @@ namespace hpx::parallel {
             static constexpr T sequential(ExPolicy&& policy, Iter first,
                 Sent last, T_&& init, Reduce&& r, Convert&& conv)
             {
-                return detail::sequential_reduce<ExPolicy>(
-                    HPX_FORWARD(ExPolicy, policy), first, last,
-                    HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r),
-                    HPX_FORWARD(Convert, conv));
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T,
+                                  Reduce>)
+                {
+                    deterministic_accumulator<T> acc;
+                    acc += init;
+                    deterministic_accumulate_n(acc, first,
+                        static_cast<std::size_t>(detail::distance(first, last)),
+                        conv);
+                    return acc.conv();
+                }
+                else
+                {
+                    return detail::sequential_reduce<ExPolicy>(
+                        HPX_FORWARD(ExPolicy, policy), first, last,
+                        HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r),
+                        HPX_FORWARD(Convert, conv));
+                }
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -486,23 +500,49 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [r, conv](
-                              Iter part_begin, std::size_t part_size) mutable {
-                    auto val = HPX_INVOKE(conv, *part_begin);
-                    return detail::sequential_reduce<ExPolicy>(
-                        ++part_begin, --part_size, HPX_MOVE(val), r, conv);
-                };
-
-                return util::partitioner<ExPolicy, T>::call(
-                    HPX_FORWARD(ExPolicy, policy), first,
-                    detail::distance(first, last), HPX_MOVE(f1),
-                    hpx::unwrapping([init = HPX_FORWARD(T_, init),
-                                        r = HPX_FORWARD(Reduce, r)](
-                                        auto&& results) mutable -> T {
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T,
+                                  Reduce>)
+                {
+                    // every partition deposits its values into an accumulator
+                    // of its own, the accumulators are combined afterwards
+                    using accumulator = deterministic_accumulator<T>;
+
+                    auto f1 = [conv](Iter part_begin,
+                                  std::size_t part_size) mutable {
+                        accumulator acc;
+                        deterministic_accumulate_n(
+                            acc, part_begin, part_size, conv);
+                        return acc;
+                    };
+
+                    return util::partitioner<ExPolicy, T, accumulator>::call(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), HPX_MOVE(f1),
+                        hpx::unwrapping([init = HPX_FORWARD(T_, init)](
+                                            auto&& results) -> T {
+                            return deterministic_sum<T>(init, results);
+                        }));
+                }
+                else
+                {
+                    auto f1 = [r, conv](Iter part_begin,
+                                  std::size_t part_size) mutable {
+                        auto val = HPX_INVOKE(conv, *part_begin);
                         return detail::sequential_reduce<ExPolicy>(
-                            hpx::util::begin(results), hpx::util::size(results),
-                            init, r);
-                    }));
+                            ++part_begin, --part_size, HPX_MOVE(val), r, conv);
+                    };
+
+                    return util::partitioner<ExPolicy, T>::call(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), HPX_MOVE(f1),
+                        hpx::unwrapping([init = HPX_FORWARD(T_, init),
+                                            r = HPX_FORWARD(Reduce, r)](
+                                            auto&& results) mutable -> T {
+                            return detail::sequential_reduce<ExPolicy>(
+                                hpx::util::begin(results),
+                                hpx::util::size(results), init, r);
+                        }));
+                }
             }
         };
     }    // namespace detail
@@ -525,9 +565,28 @@ namespace hpx::parallel {
             static constexpr T sequential(ExPolicy&& /* policy */, Iter first1,
                 Sent last1, Iter2 first2, T_ init, Op1&& op1, Op2&& op2)
             {
-                return detail::sequential_reduce<ExPolicy>(first1, last1,
-                    first2, HPX_FORWARD(T_, init), HPX_FORWARD(Op1, op1),
-                    HPX_FORWARD(Op2, op2));
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T, Op1>)
+                {
+                    using zip_iterator = hpx::util::zip_iterator<Iter, Iter2>;
+
+                    deterministic_accumulator<T> acc;
+                    acc += init;
+                    deterministic_accumulate_n(acc,
+                        zip_iterator(first1, first2),
+                        static_cast<std::size_t>(
+                            detail::distance(first1, last1)),
+                        [&op2](auto&& t) {
+                            return HPX_INVOKE(
+                                op2, hpx::get<0>(t), hpx::get<1>(t));
+                        });
+                    return acc.conv();
+                }
+                else
+                {
+                    return detail::sequential_reduce<ExPolicy>(first1, last1,
+                        first2, HPX_FORWARD(T_, init), HPX_FORWARD(Op1, op1),
+                        HPX_FORWARD(Op2, op2));
+                }
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -553,38 +612,68 @@ namespace hpx::parallel {
 
                 difference_type count = detail::distance(first1, last1);
 
-                auto f1 = [op1, op2 = HPX_FORWARD(Op2, op2)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) mutable -> T {
-                    auto iters = part_begin.get_iterator_tuple();
-                    Iter it1 = hpx::get<0>(iters);
-                    Iter2 it2 = hpx::get<1>(iters);
-
-                    Iter last = it1;
-                    std::advance(last, part_size);
-
-                    auto&& r = HPX_INVOKE(op2, *it1, *it2);
-                    ++it1;
-                    ++it2;
-
-                    return detail::sequential_reduce<ExPolicy>(it1, last, it2,
-                        HPX_MOVE(r), HPX_FORWARD(Op1, op1),
-                        HPX_FORWARD(Op2, op2));
-                };
-
-                return util::partitioner<ExPolicy, T>::call(
-                    HPX_FORWARD(ExPolicy, policy), zip_iterator(first1, first2),
-                    count, HPX_MOVE(f1),
-                    [init = HPX_FORWARD(T_, init), op1 = HPX_FORWARD(Op1, op1)](
-                        auto&& results) mutable -> T {
-                        T ret = HPX_MOVE(init);
-                        for (auto&& result : results)
-                        {
-                            ret = HPX_INVOKE(
-                                op1, HPX_MOVE(ret), hpx::unwrap(result));
-                        }
-                        return ret;
-                    });
+                if constexpr (uses_deterministic_reduction_v<ExPolicy, T, Op1>)
+                {
+                    // every partition deposits its values into an accumulator
+                    // of its own, the accumulators are combined afterwards
+                    using accumulator = deterministic_accumulator<T>;
+
+                    auto f1 = [op2 = HPX_FORWARD(Op2, op2)](
+                                  zip_iterator part_begin,
+                                  std::size_t part_size) mutable {
+                        accumulator acc;
+                        deterministic_accumulate_n(acc, part_begin, part_size,
+                            [&op2](auto&& t) {
+                                return HPX_INVOKE(
+                                    op2, hpx::get<0>(t), hpx::get<1>(t));
+                            });
+                        return acc;
+                    };
+
+                    return util::partitioner<ExPolicy, T, accumulator>::call(
+                        HPX_FORWARD(ExPolicy, policy),
+                        zip_iterator(first1, first2), count, HPX_MOVE(f1),
+                        hpx::unwrapping([init = HPX_FORWARD(T_, init)](
+                                            auto&& results) -> T {
+                            return deterministic_sum<T>(init, results);
+                        }));
+                }
+                else
+                {
+                    auto f1 = [op1, op2 = HPX_FORWARD(Op2, op2)](
+                                  zip_iterator part_begin,
+                                  std::size_t part_size) mutable -> T {
+                        auto iters = part_begin.get_iterator_tuple();
+                        Iter it1 = hpx::get<0>(iters);
+                        Iter2 it2 = hpx::get<1>(iters);
+
+                        Iter last = it1;
+                        std::advance(last, part_size);
+
+                        auto&& r = HPX_INVOKE(op2, *it1, *it2);
+                        ++it1;
+                        ++it2;
+
+                        return detail::sequential_reduce<ExPolicy>(it1, last,
+                            it2, HPX_MOVE(r), HPX_FORWARD(Op1, op1),
+                            HPX_FORWARD(Op2, op2));
+                    };
+
+                    return util::partitioner<ExPolicy, T>::call(
+                        HPX_FORWARD(ExPolicy, policy),
+                        zip_iterator(first1, first2), count, HPX_MOVE(f1),
+                        [init = HPX_FORWARD(T_, init),
+                            op1 = HPX_FORWARD(Op1, op1)](
+                            auto&& results) mutable -> T {
+                            T ret = HPX_MOVE(init);
+                            for (auto&& result : results)
+                            {
+                                ret = HPX_INVOKE(
+                                    op1, HPX_MOVE(ret), hpx::unwrap(result));
+                            }
+                            return ret;
+                        });
+                }
             }
         };
     }    // namespace detail
@@ -206,6 +206,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/non_temporal_stores.hpp>
 #include <hpx/parallel/util/partitioner_with_cleanup.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/transfer.hpp>
@@ -254,11 +255,22 @@ namespace hpx::parallel {
                         using hpx::get;
                         auto iters = t.get_iterator_tuple();
                         FwdIter2 dest = get<1>(iters);
-                        return std::make_pair(dest,
-                            util::get_second_element(
-                                hpx::parallel::util::uninit_copy_n(
-                                    HPX_FORWARD(ExPolicy, policy),
-                                    get<0>(iters), part_size, dest)));
+                        if constexpr (util::uses_non_temporal_copy_v<ExPolicy,
+                                          Iter, FwdIter2>)
+                        {
+                            return std::make_pair(dest,
+                                util::stream_copy_n(
+                                    get<0>(iters), part_size, dest)
+                                    .out);
+                        }
+                        else
+                        {
+                            return std::make_pair(dest,
+                                util::get_second_element(
+                                    hpx::parallel::util::uninit_copy_n(
+                                        HPX_FORWARD(ExPolicy, policy),
+                                        get<0>(iters), part_size, dest)));
+                        }
                     },
                     // finalize, called once if no error occurred
                     [dest, first, count](auto&& data) mutable
@@ -177,6 +177,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/non_temporal_stores.hpp>
 #include <hpx/parallel/util/partitioner_with_cleanup.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -244,10 +245,21 @@ namespace hpx::parallel {
                     HPX_FORWARD(ExPolicy, policy), first, count,
                     [value, policy](Iter it, std::size_t part_size) mutable
                         -> partition_result_type {
-                        return std::make_pair(it,
-                            sequential_uninitialized_fill_n(
-                                HPX_FORWARD(ExPolicy, policy), it, part_size,
-                                value));
+                        if constexpr (util::uses_non_temporal_stores_v<ExPolicy,
+                                          Iter>)
+                        {
+                            using value_type = hpx::traits::iter_value_t<Iter>;
+                            return std::make_pair(it,
+                                util::stream_fill_n(
+                                    it, part_size, value_type(value)));
+                        }
+                        else
+                        {
+                            return std::make_pair(it,
+                                sequential_uninitialized_fill_n(
+                                    HPX_FORWARD(ExPolicy, policy), it,
+                                    part_size, value));
+                        }
                     },
                     // finalize, called once if no error occurred
                     [first, count](auto&& data) mutable -> Iter {
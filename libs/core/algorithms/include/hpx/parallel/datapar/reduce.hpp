@@ -10,9 +10,14 @@
 
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
 #include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke_result.hpp>
 #include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
@@ -21,11 +26,108 @@
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
 namespace hpx { namespace parallel { namespace detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Full vector packs are combined element-wise into a vector accumulator
+    // which is reduced horizontally only when a scalar is combined and at the
+    // end. This requires the reduction operation to be applicable to vector
+    // packs and to be commutative (the lanes are combined out of order),
+    // otherwise every pack is reduced horizontally on its own. The lanes of
+    // packs reduced for an ordered_reduce_op are combined one by one, the
+    // horizontal reduction of the SIMD backends may reorder them as well.
+    template <typename VR, typename T, typename Reduce>
+    struct datapar_reduce_accumulator
+    {
+        static constexpr bool vertical = std::conjunction_v<
+            std::bool_constant<
+                !is_ordered_reduce_op_v<std::remove_const_t<Reduce>>>,
+            hpx::parallel::traits::is_vector_pack<VR>,
+            hpx::is_invocable_r<VR, Reduce&, VR const&, VR const&>>;
+
+        template <typename U>
+        HPX_HOST_DEVICE HPX_FORCEINLINE void operator()(U&& val)
+        {
+            if constexpr (vertical && std::is_same_v<std::decay_t<U>, VR>)
+            {
+                if (has_acc_)
+                {
+                    acc_ = HPX_INVOKE(r_, acc_, val);
+                }
+                else
+                {
+                    acc_ = HPX_FORWARD(U, val);
+                    has_acc_ = true;
+                }
+            }
+            else if constexpr (is_ordered_reduce_op_v<
+                                   std::remove_const_t<Reduce>> &&
+                hpx::parallel::traits::is_vector_pack_v<std::decay_t<U>>)
+            {
+                using pack_type = std::decay_t<U>;
+                pack_type pack = val;
+                for (std::size_t i = 0;
+                    i != hpx::parallel::traits::vector_pack_size_v<pack_type>;
+                    ++i)
+                {
+                    init_ = HPX_INVOKE(
+                        r_, init_, hpx::parallel::traits::get(pack, i));
+                }
+            }
+            else
+            {
+                // the scalar elements following the accumulated packs must
+                // be combined after those
+                flush();
+
+                T partial_res = hpx::parallel::traits::reduce(r_, val);
+                init_ = HPX_INVOKE(r_, init_, partial_res);
+            }
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE T get()
+        {
+            flush();
+            return init_;
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE void flush()
+        {
+            if constexpr (vertical)
+            {
+                if (has_acc_)
+                {
+                    T partial_res = hpx::parallel::traits::reduce(r_, acc_);
+                    init_ = HPX_INVOKE(r_, init_, partial_res);
+                    has_acc_ = false;
+                }
+            }
+        }
+
+        T init_;
+        Reduce& r_;
+        std::conditional_t<vertical, VR, bool> acc_{};
+        bool has_acc_ = false;
+    };
+
+    template <typename Iter>
+    using datapar_reduce_pack_t = hpx::parallel::traits::vector_pack_type_t<
+        typename std::iterator_traits<Iter>::value_type>;
+
+    template <typename Iter, typename Convert>
+    using datapar_reduce_converted_pack_t =
+        std::decay_t<hpx::util::invoke_result_t<Convert&,
+            datapar_reduce_pack_t<Iter> const&>>;
+
+    template <typename Iter1, typename Iter2, typename Convert>
+    using datapar_reduce_converted_pack2_t =
+        std::decay_t<hpx::util::invoke_result_t<Convert&,
+            datapar_reduce_pack_t<Iter1>&, datapar_reduce_pack_t<Iter2>&>>;
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename ExPolicy>
     struct datapar_reduce
@@ -35,24 +137,28 @@ namespace hpx { namespace parallel { namespace detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(
             ExPolicy&&, InIterB first, InIterE last, T init, Reduce&& r)
         {
+            using accumulator_type =
+                datapar_reduce_accumulator<datapar_reduce_pack_t<InIterB>, T,
+                    std::remove_reference_t<Reduce>>;
+
+            accumulator_type acc{init, r};
             util::loop_ind<ExPolicy>(
-                first, last, [&init, &r](auto const& val) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, val);
-                    init = r(init, partial_res);
-                });
-            return init;
+                first, last, [&acc](auto const& val) { acc(val); });
+            return acc.get();
         }
 
         template <typename T, typename FwdIterB, typename Reduce>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(
             FwdIterB part_begin, std::size_t part_size, T init, Reduce r)
         {
+            using accumulator_type =
+                datapar_reduce_accumulator<datapar_reduce_pack_t<FwdIterB>, T,
+                    Reduce>;
+
+            accumulator_type acc{init, r};
             util::loop_n_ind<ExPolicy>(
-                part_begin, part_size, [&init, &r](auto const& val) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, val);
-                    init = r(init, partial_res);
-                });
-            return init;
+                part_begin, part_size, [&acc](auto const& val) { acc(val); });
+            return acc.get();
         }
 
         template <typename Iter, typename Sent, typename T, typename Reduce,
@@ -60,24 +166,27 @@ namespace hpx { namespace parallel { namespace detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(ExPolicy&&, Iter first,
             Sent last, T init, Reduce&& r, Convert&& conv)
         {
-            util::loop_ind<ExPolicy>(
-                first, last, [&init, &r, &conv](auto const& v) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, conv(v));
-                    init = r(init, partial_res);
-                });
-            return init;
+            using accumulator_type = datapar_reduce_accumulator<
+                datapar_reduce_converted_pack_t<Iter, std::decay_t<Convert>>,
+                T, std::remove_reference_t<Reduce>>;
+
+            accumulator_type acc{init, r};
+            util::loop_ind<ExPolicy>(first, last,
+                [&acc, &conv](auto const& v) { acc(HPX_INVOKE(conv, v)); });
+            return acc.get();
         }
 
         template <typename T, typename Iter, typename Reduce, typename Convert>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter part_begin,
             std::size_t part_size, T init, Reduce r, Convert conv)
         {
+            using accumulator_type = datapar_reduce_accumulator<
+                datapar_reduce_converted_pack_t<Iter, Convert>, T, Reduce>;
+
+            accumulator_type acc{init, r};
             util::loop_n_ind<ExPolicy>(part_begin, part_size,
-                [&init, &r, &conv](auto const& v) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, conv(v));
-                    init = r(init, partial_res);
-                });
-            return init;
+                [&acc, &conv](auto const& v) { acc(HPX_INVOKE(conv, v)); });
+            return acc.get();
         }
 
         template <typename Iter1, typename Sent, typename Iter2, typename T,
@@ -85,13 +194,17 @@ namespace hpx { namespace parallel { namespace detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter1 first1, Sent last1,
             Iter2 first2, T init, Reduce&& r, Convert&& conv)
         {
-            util::loop2<ExPolicy>(
-                first1, last1, first2, [&init, &r, &conv](auto it1, auto it2) {
-                    auto partial_res = hpx::parallel::traits::reduce(
-                        r, HPX_INVOKE(conv, it1, it2));
-                    init = r(init, partial_res);
+            using accumulator_type = datapar_reduce_accumulator<
+                datapar_reduce_converted_pack2_t<Iter1, Iter2,
+                    std::decay_t<Convert>>,
+                T, std::remove_reference_t<Reduce>>;
+
+            accumulator_type acc{init, r};
+            util::loop2<ExPolicy>(first1, last1, first2,
+                [&acc, &conv](auto& v1, auto& v2) {
+                    acc(HPX_INVOKE(conv, v1, v2));
                 });
-            return init;
+            return acc.get();
         }
     };
 
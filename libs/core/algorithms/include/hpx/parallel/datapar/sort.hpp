@@ -0,0 +1,199 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Direction of the sort implied by the comparison function passed to the
+    // leaves of hpx::sort: 1 for ascending, -1 for descending, and 0 if the
+    // keys are not compared directly.
+    template <typename Key, typename Comp>
+    struct datapar_sort_direction : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename Key, typename Comp, typename Proj>
+    struct datapar_sort_direction<Key, util::compare_projected<Comp, Proj>>
+      : std::integral_constant<int,
+            is_radix_sort_projection<std::decay_t<Proj>>::value ?
+                radix_sort_direction<std::decay_t<Comp>, Key>::value :
+                0>
+    {
+    };
+
+    // Leaves the lane-wise minimum in a and the maximum in b (the other way
+    // around if descending).
+    template <bool Descending, typename V>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void datapar_compare_exchange(V& a, V& b)
+    {
+        auto const msk = [&] {
+            if constexpr (Descending)
+                return a < b;
+            else
+                return b < a;
+        }();
+
+        V const first = traits::choose(msk, b, a);
+        b = traits::choose(msk, a, b);
+        a = first;
+    }
+
+    // Bitonic sorting network sorting the columns of N vector packs, i.e.
+    // the elements with the same lane index, without moving elements between
+    // lanes.
+    template <bool Descending, std::size_t N, typename V>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void datapar_bitonic_sort_columns(
+        V (&v)[N])
+    {
+        static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+        for (std::size_t k = 2; k <= N; k <<= 1)
+        {
+            for (std::size_t j = k >> 1; j != 0; j >>= 1)
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    std::size_t const l = i ^ j;
+                    if (l > i)
+                    {
+                        if ((i & k) == 0)
+                            datapar_compare_exchange<Descending>(v[i], v[l]);
+                        else
+                            datapar_compare_exchange<Descending>(v[l], v[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tiles of the range are loaded into a couple of vector packs the columns
+    // of which are sorted by an in-register bitonic network. The columns are
+    // written back as sorted runs which are merged afterwards.
+    template <bool Descending, typename Iter>
+    void datapar_sort(Iter first, Iter last)
+    {
+        using value_type = hpx::traits::iter_value_t<Iter>;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        constexpr std::size_t size = traits::vector_pack_size_v<V>;
+        constexpr std::size_t rows = 4 * size;
+        constexpr std::size_t tile = rows * size;
+
+        auto comp = [](value_type const& lhs, value_type const& rhs) {
+            if constexpr (Descending)
+                return rhs < lhs;
+            else
+                return lhs < rhs;
+        };
+
+        std::size_t const count = last - first;
+        if (count < 2 * tile)
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        Iter it = first;
+        for (std::size_t t = 0; t != count / tile; ++t)
+        {
+            V v[rows];
+            for (std::size_t r = 0; r != rows; ++r)
+            {
+                Iter row = it + r * size;
+                v[r] = traits::vector_pack_load<V, value_type>::unaligned(row);
+            }
+
+            datapar_bitonic_sort_columns<Descending>(v);
+
+            // transpose, column c becomes the run [c * rows, (c + 1) * rows)
+            for (std::size_t c = 0; c != size; ++c)
+            {
+                for (std::size_t r = 0; r != rows; ++r)
+                {
+                    it[c * rows + r] = traits::get(v[r], c);
+                }
+            }
+            it += tile;
+        }
+
+        // the remaining elements form a single sorted run
+        std::sort(it, last, comp);
+
+        // merge the runs bottom-up, alternating between the range and a buffer
+        std::vector<value_type> buffer(count);
+        bool in_buffer = false;
+        for (std::size_t width = rows; width < count; width *= 2)
+        {
+            auto merge_runs = [&](auto src, auto dest) {
+                for (std::size_t lo = 0; lo < count; lo += 2 * width)
+                {
+                    std::size_t const mid = (std::min) (lo + width, count);
+                    std::size_t const hi = (std::min) (lo + 2 * width, count);
+                    std::merge(src + lo, src + mid, src + mid, src + hi,
+                        dest + lo, comp);
+                }
+            };
+
+            if (in_buffer)
+                merge_runs(buffer.begin(), first);
+            else
+                merge_runs(first, buffer.begin());
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+        {
+            std::move(buffer.begin(), buffer.end(), first);
+        }
+    }
+
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    void tag_invoke(sequential_sort_t<ExPolicy>, RandomIt first, RandomIt last,
+        Comp&& comp)
+    {
+        using value_type = hpx::traits::iter_value_t<RandomIt>;
+        constexpr int direction =
+            datapar_sort_direction<value_type, std::decay_t<Comp>>::value;
+
+        if constexpr (direction != 0 && is_radix_sort_key_v<value_type> &&
+            util::detail::iterator_datapar_compatible_v<RandomIt> &&
+            traits::is_vector_pack_v<traits::vector_pack_type_t<value_type>>)
+        {
+            datapar_sort<(direction < 0)>(first, last);
+        }
+        else
+        {
+            std::sort(first, last, comp);
+        }
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/pointer_category.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/parallel/util/transfer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+#if defined(HPX_HAVE_MM_STREAM)
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace hpx::parallel::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    inline constexpr bool has_non_temporal_stores_v =
+        hpx::execution::experimental::extract_has_non_temporal_stores_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type>;
+
+    // Streaming stores are used if the executor parameters of the policy ask
+    // for them and the destination is a contiguous range of trivially
+    // copyable elements.
+    template <typename ExPolicy, typename OutIter>
+    inline constexpr bool uses_non_temporal_stores_v =
+#if defined(HPX_HAVE_MM_STREAM) && !defined(HPX_COMPUTE_DEVICE_CODE)
+        has_non_temporal_stores_v<ExPolicy> &&
+        hpx::traits::is_contiguous_iterator_v<OutIter> &&
+        std::is_trivially_copyable_v<hpx::traits::iter_value_t<OutIter>>;
+#else
+        false;
+#endif
+
+    // Copying additionally requires the source elements to be bitwise
+    // copyable to the destination.
+    template <typename ExPolicy, typename InIter, typename OutIter>
+    inline constexpr bool uses_non_temporal_copy_v =
+        uses_non_temporal_stores_v<ExPolicy, OutIter> &&
+        std::is_same_v<detail::pointer_category_t<InIter, OutIter>,
+            hpx::traits::trivially_copyable_pointer_tag>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // width of the streaming stores, the destination of each store has
+        // to be aligned accordingly
+        inline constexpr std::size_t non_temporal_store_size = 16;
+
+        // the values produced by stream_generate_n are collected in a local
+        // buffer of (at least) this size before being streamed out
+        inline constexpr std::size_t non_temporal_buffer_size = 512;
+
+        HPX_FORCEINLINE std::size_t non_temporal_misalignment(
+            void const* p) noexcept
+        {
+            return static_cast<std::size_t>(
+                reinterpret_cast<std::uintptr_t>(p) % non_temporal_store_size);
+        }
+
+        // Write the given number of consecutive blocks of 16 bytes from src
+        // to the 16 byte aligned dest, bypassing the caches.
+        HPX_FORCEINLINE void stream_blocks(
+            char* dest, char const* src, std::size_t blocks) noexcept
+        {
+#if defined(HPX_HAVE_MM_STREAM)
+            for (/**/; blocks != 0; --blocks)
+            {
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dest),
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(src)));
+                dest += non_temporal_store_size;
+                src += non_temporal_store_size;
+            }
+#else
+            std::memcpy(dest, src, blocks * non_temporal_store_size);
+#endif
+        }
+
+        // Streaming stores are weakly ordered, make them globally visible
+        // before the calling chunk reports completion.
+        HPX_FORCEINLINE void stream_fence() noexcept
+        {
+#if defined(HPX_HAVE_MM_STREAM)
+            _mm_sfence();
+#endif
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy count elements from first to dest. The bytes up to the first
+    // aligned destination address and the trailing bytes are copied using
+    // regular stores, everything in between is streamed.
+    template <typename InIter, typename OutIter>
+    in_out_result<InIter, OutIter> stream_copy_n(
+        InIter first, std::size_t count, OutIter dest) noexcept
+    {
+        if (count == 0)
+        {
+            return {first, dest};
+        }
+
+        using data_type = hpx::traits::iter_value_t<InIter>;
+        constexpr std::size_t size = detail::non_temporal_store_size;
+
+        char const* src = detail::to_const_ptr(first);
+        char* dst = detail::to_ptr(dest);
+        std::size_t bytes = count * sizeof(data_type);
+
+        std::size_t const head = (std::min) (
+            (size - detail::non_temporal_misalignment(dst)) % size, bytes);
+        std::memmove(dst, src, head);
+        src += head;
+        dst += head;
+        bytes -= head;
+
+        std::size_t const blocks = bytes / size;
+        detail::stream_blocks(dst, src, blocks);
+
+        std::size_t const streamed = blocks * size;
+        std::memmove(dst + streamed, src + streamed, bytes - streamed);
+
+        detail::stream_fence();
+
+        std::advance(first, count);
+        std::advance(dest, count);
+        return {first, dest};
+    }
+
+    // Assign the values returned by count consecutive invocations of gen to
+    // the elements starting at dest. The values are collected in a small
+    // aligned buffer which is then streamed to the destination.
+    template <typename OutIter, typename Gen>
+    OutIter stream_generate_n(OutIter dest, std::size_t count, Gen&& gen)
+    {
+        if (count == 0)
+        {
+            return dest;
+        }
+
+        using value_type = hpx::traits::iter_value_t<OutIter>;
+        constexpr std::size_t size = detail::non_temporal_store_size;
+
+        // a buffer holds a whole number of elements and of streaming stores
+        constexpr std::size_t unit = size / std::gcd(sizeof(value_type), size);
+        constexpr std::size_t buffer_count = unit *
+            (std::max) (std::size_t(1),
+                detail::non_temporal_buffer_size / (unit * sizeof(value_type)));
+        constexpr std::size_t buffer_bytes = buffer_count * sizeof(value_type);
+
+        auto store = [&gen](char* p) {
+            value_type const value = gen();
+            std::memcpy(p, &value, sizeof(value_type));
+        };
+
+        char* dst = detail::to_ptr(dest);
+        std::size_t n = count;
+
+        // peel off elements until the destination is aligned, this is not
+        // possible for all element sizes and addresses
+        for (std::size_t peeled = 0; n != 0 && peeled != size &&
+            detail::non_temporal_misalignment(dst) != 0;
+            ++peeled, --n)
+        {
+            store(dst);
+            dst += sizeof(value_type);
+        }
+
+        if constexpr (buffer_bytes <= 8 * detail::non_temporal_buffer_size)
+        {
+            if (detail::non_temporal_misalignment(dst) == 0)
+            {
+                alignas(size) char buffer[buffer_bytes];
+                for (/**/; n >= buffer_count; n -= buffer_count)
+                {
+                    for (std::size_t i = 0; i != buffer_count; ++i)
+                    {
+                        store(buffer + i * sizeof(value_type));
+                    }
+                    detail::stream_blocks(dst, buffer, buffer_bytes / size);
+                    dst += buffer_bytes;
+                }
+            }
+        }
+
+        for (/**/; n != 0; --n)
+        {
+            store(dst);
+            dst += sizeof(value_type);
+        }
+
+        detail::stream_fence();
+
+        std::advance(dest, count);
+        return dest;
+    }
+
+    // Assign value to the count elements starting at dest.
+    template <typename OutIter>
+    OutIter stream_fill_n(OutIter dest, std::size_t count,
+        hpx::traits::iter_value_t<OutIter> const& value)
+    {
+        return stream_generate_n(dest, count, [&value]() { return value; });
+    }
+}    // namespace hpx::parallel::util
@@ -12,8 +12,12 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/execution/execution.hpp>
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -25,9 +29,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <list>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -37,6 +44,28 @@ namespace hpx::parallel::util {
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The state of a tile of a single-pass scan
+        enum class scan_tile_status : std::uint8_t
+        {
+            invalid = 0,             // nothing was published yet
+            aggregate = 1,           // the aggregate of the tile is available
+            inclusive_prefix = 2,    // the inclusive prefix is available
+            failed = 3               // the tile could not be processed
+        };
+
+        // Every tile of a single-pass scan publishes the reduction of its
+        // elements (aggregate) and later the reduction of all elements up to
+        // and including its own (inclusive prefix). The status tells which of
+        // the two may be read by the tiles following it.
+        template <typename T>
+        struct scan_tile_descriptor
+        {
+            std::atomic<scan_tile_status> status{scan_tile_status::invalid};
+            T aggregate{};
+            T inclusive_prefix{};
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -56,7 +85,34 @@ namespace hpx::parallel::util {
 
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
-            static R call([[maybe_unused]] ExPolicy_ policy,
+            static R call(ExPolicy_ policy, FwdIter first, std::size_t count,
+                T&& init, F1&& f1, F2&& f2, F3&& f3, F4&& f4)
+            {
+                // The single-pass scan does not have to collect the results
+                // of f3, it is used for void results only.
+                if constexpr (hpx::execution::experimental::
+                                  extract_has_single_pass_scan_v<
+                                      parameters_type> &&
+                    std::is_void_v<Result2>)
+                {
+                    return call_single_pass(HPX_MOVE(policy), first, count,
+                        HPX_FORWARD(T, init), HPX_FORWARD(F1, f1),
+                        HPX_FORWARD(F2, f2), HPX_FORWARD(F3, f3),
+                        HPX_FORWARD(F4, f4));
+                }
+                else
+                {
+                    return call_two_pass(HPX_MOVE(policy), first, count,
+                        HPX_FORWARD(T, init), HPX_FORWARD(F1, f1),
+                        HPX_FORWARD(F2, f2), HPX_FORWARD(F3, f3),
+                        HPX_FORWARD(F4, f4));
+                }
+            }
+
+        private:
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call_two_pass([[maybe_unused]] ExPolicy_ policy,
                 [[maybe_unused]] FwdIter first,
                 [[maybe_unused]] std::size_t count, [[maybe_unused]] T&& init,
                 [[maybe_unused]] F1&& f1, [[maybe_unused]] F2&& f2,
@@ -168,7 +224,228 @@ namespace hpx::parallel::util {
 #endif
             }
 
-        private:
+            ///////////////////////////////////////////////////////////////////
+            // Determine the exclusive prefix of the given tile by combining
+            // the aggregates of the tiles preceding it until a tile with a
+            // known inclusive prefix is found. Returns false if one of the
+            // preceding tiles has failed.
+            template <typename Descriptors, typename F2>
+            static bool look_back(Descriptors const& descriptors,
+                std::size_t tile, F2& f2, Result1& prefix)
+            {
+                bool has_value = false;
+                while (tile-- != 0)
+                {
+                    auto const& pred = descriptors[tile];
+
+                    scan_tile_status status = scan_tile_status::invalid;
+                    hpx::util::yield_while(
+                        [&] {
+                            status =
+                                pred.status.load(std::memory_order_acquire);
+                            return status == scan_tile_status::invalid;
+                        },
+                        "scan_partitioner::look_back");
+
+                    if (status == scan_tile_status::failed)
+                        return false;
+
+                    Result1 const& value =
+                        status == scan_tile_status::inclusive_prefix ?
+                        pred.inclusive_prefix :
+                        pred.aggregate;
+
+                    prefix = has_value ? HPX_INVOKE(f2, value, prefix) : value;
+                    has_value = true;
+
+                    if (status == scan_tile_status::inclusive_prefix)
+                        return true;
+                }
+
+                // the first tile always publishes its inclusive prefix
+                HPX_ASSERT(false);
+                return false;
+            }
+
+            // The single-pass scan splits the input into tiles that are
+            // handed out in order to one task per core. Each tile is reduced
+            // (f1), its exclusive prefix is determined using decoupled
+            // look-back, and the tile is scanned (f3) right away while its
+            // data is still cached.
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call_single_pass([[maybe_unused]] ExPolicy_ policy,
+                [[maybe_unused]] FwdIter first,
+                [[maybe_unused]] std::size_t count, [[maybe_unused]] T&& init,
+                [[maybe_unused]] F1&& f1, [[maybe_unused]] F2&& f2,
+                [[maybe_unused]] F3&& f3, [[maybe_unused]] F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                using descriptor_type = hpx::util::cache_aligned_data_derived<
+                    scan_tile_descriptor<Result1>>;
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                std::vector<hpx::future<Result2>> finalitems;
+                std::vector<Result1> f2results;
+                std::list<std::exception_ptr> errors;
+
+                std::vector<hpx::tuple<FwdIter, std::size_t>> tiles;
+                std::unique_ptr<descriptor_type[]> descriptors;
+                std::atomic<std::size_t> next_tile(0);
+                std::size_t offset = 0;
+
+                try
+                {
+                    // pre-initialize first intermediate result
+                    workitems.push_back(
+                        make_ready_future(HPX_FORWARD(T, init)));
+
+                    HPX_ASSERT(count > 0);
+                    FwdIter first_ = first;
+                    std::size_t const count_ = count;
+
+                    using has_variable_chunk_size = typename hpx::execution::
+                        experimental::extract_has_variable_chunk_size<
+                            parameters_type>::type;
+
+                    auto shape = detail::get_bulk_iteration_shape(
+                        has_variable_chunk_size(), policy, workitems, f1, first,
+                        count, 1);
+
+                    tiles.reserve(hpx::util::size(shape));
+                    for (auto const& elem : shape)
+                    {
+                        tiles.emplace_back(
+                            hpx::get<0>(elem), hpx::get<1>(elem));
+                    }
+
+                    // If the size of count was enough to warrant testing for a
+                    // chunk, the first chunk was reduced already, start f3 for
+                    // it.
+                    offset = workitems.size() - 1;
+                    f2results.resize(tiles.size() + offset + 1);
+                    f2results[0] = workitems[0].get();
+
+                    if (offset != 0)
+                    {
+                        HPX_ASSERT(count_ > count);
+
+                        finalitems.push_back(
+                            execution::async_execute(policy.executor(), f3,
+                                first_, count_ - count, f2results[0]));
+
+                        f2results[1] = HPX_INVOKE(
+                            f2, f2results[0], workitems[1].get());
+                    }
+
+                    std::size_t const num_tiles = tiles.size();
+                    descriptors.reset(new descriptor_type[num_tiles]);
+
+                    auto tile_worker = [&]() -> void {
+                        for (std::size_t i = next_tile++; i < num_tiles;
+                            i = next_tile++)
+                        {
+                            auto& desc = descriptors[i];
+                            FwdIter part_begin = hpx::get<0>(tiles[i]);
+                            std::size_t const part_size = hpx::get<1>(tiles[i]);
+
+                            try
+                            {
+                                Result1 aggregate =
+                                    HPX_INVOKE(f1, part_begin, part_size);
+
+                                Result1 prefix = f2results[offset];
+                                if (i != 0)
+                                {
+                                    desc.aggregate = aggregate;
+                                    desc.status.store(
+                                        scan_tile_status::aggregate,
+                                        std::memory_order_release);
+
+                                    if (!look_back(
+                                            descriptors.get(), i, f2, prefix))
+                                    {
+                                        desc.status.store(
+                                            scan_tile_status::failed,
+                                            std::memory_order_release);
+                                        continue;
+                                    }
+                                }
+
+                                desc.inclusive_prefix =
+                                    HPX_INVOKE(f2, prefix, aggregate);
+                                desc.status.store(
+                                    scan_tile_status::inclusive_prefix,
+                                    std::memory_order_release);
+
+                                HPX_INVOKE(f3, part_begin, part_size,
+                                    HPX_MOVE(prefix));
+                            }
+                            catch (...)
+                            {
+                                if (desc.status.load(
+                                        std::memory_order_relaxed) !=
+                                    scan_tile_status::inclusive_prefix)
+                                {
+                                    desc.status.store(scan_tile_status::failed,
+                                        std::memory_order_release);
+                                }
+                                throw;
+                            }
+                        }
+                    };
+
+                    // schedule one task per core, each of which processes
+                    // tiles until none are left
+                    std::size_t const cores =
+                        hpx::execution::experimental::processing_units_count(
+                            policy.parameters(), policy.executor(),
+                            hpx::chrono::null_duration, count_);
+                    std::size_t const num_tasks =
+                        (std::min) ((std::max) (cores, std::size_t(1)),
+                            num_tiles);
+
+                    finalitems.reserve(finalitems.size() + num_tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                    {
+                        finalitems.push_back(execution::async_execute(
+                            policy.executor(), tile_worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    // the tasks refer to the tiles and their descriptors
+                    hpx::wait_all_nothrow(finalitems);
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // wait for all tasks before collecting the prefixes
+                hpx::wait_all_nothrow(finalitems);
+
+                if (descriptors)
+                {
+                    for (std::size_t i = 0; i != tiles.size(); ++i)
+                    {
+                        f2results[offset + i + 1] =
+                            descriptors[i].inclusive_prefix;
+                    }
+                }
+
+                return reduce(HPX_MOVE(f2results), HPX_MOVE(finalitems),
+                    HPX_MOVE(errors), HPX_FORWARD(F4, f4));
+#endif
+            }
+
             template <typename F>
             static R reduce([[maybe_unused]] std::vector<Result1>&& workitems,
                 [[maybe_unused]] std::vector<hpx::future<Result2>>&& finalitems,
@@ -241,4 +518,13 @@ namespace hpx::parallel::util {
             Result2>
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The scan_partitioner uses the single-pass scan (decoupled look-back) if
+    // the executor parameters of the execution policy ask for it (see
+    // hpx::execution::experimental::single_pass_scan).
+    template <typename ExPolicy>
+    inline constexpr bool uses_single_pass_scan_v =
+        hpx::execution::experimental::extract_has_single_pass_scan_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type>;
 }    // namespace hpx::parallel::util
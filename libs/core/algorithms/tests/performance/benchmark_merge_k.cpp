@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the single pass merge_k with log2(k) rounds of pairwise merges of
+// the same runs.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename F>
+double run_benchmark(int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::chrono::high_resolution_timer t;
+        f();
+        elapsed += t.elapsed();
+    }
+    return elapsed / test_count;
+}
+
+// merge neighboring runs of src into dest until a single run is left, the
+// bounds of the runs are given by offsets
+void merge_pairwise(std::vector<std::uint64_t>& src,
+    std::vector<std::uint64_t>& dest, std::vector<std::size_t> offsets)
+{
+    while (offsets.size() > 2)
+    {
+        std::vector<std::size_t> next;
+        next.push_back(0);
+
+        std::size_t i = 0;
+        for (/**/; i + 2 < offsets.size(); i += 2)
+        {
+            hpx::merge(hpx::execution::par, src.begin() + offsets[i],
+                src.begin() + offsets[i + 1], src.begin() + offsets[i + 1],
+                src.begin() + offsets[i + 2], dest.begin() + offsets[i]);
+            next.push_back(offsets[i + 2]);
+        }
+        if (i + 1 < offsets.size())
+        {
+            hpx::copy(hpx::execution::par, src.begin() + offsets[i],
+                src.begin() + offsets[i + 1], dest.begin() + offsets[i]);
+            next.push_back(offsets[i + 1]);
+        }
+
+        std::swap(src, dest);
+        offsets = std::move(next);
+    }
+    std::swap(src, dest);
+}
+
+void run_benchmarks(std::size_t size, std::size_t num_runs, int test_count)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist;
+
+    std::vector<std::uint64_t> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+    std::vector<std::size_t> offsets(num_runs + 1);
+    std::vector<hpx::util::iterator_range<std::uint64_t*>> runs;
+    for (std::size_t run = 0; run != num_runs; ++run)
+    {
+        offsets[run] = run * size / num_runs;
+        offsets[run + 1] = (run + 1) * size / num_runs;
+        std::sort(data.begin() + offsets[run], data.begin() + offsets[run + 1]);
+        runs.emplace_back(
+            data.data() + offsets[run], data.data() + offsets[run + 1]);
+    }
+
+    std::vector<std::uint64_t> dest_k(size);
+    double const time_k = run_benchmark(test_count, [&]() {
+        hpx::experimental::merge_k(
+            hpx::execution::par, runs.begin(), runs.end(), dest_k.begin());
+    });
+
+    std::vector<std::uint64_t> dest_pairwise;
+    double const time_pairwise = run_benchmark(test_count, [&]() {
+        std::vector<std::uint64_t> src = data;
+        dest_pairwise.resize(size);
+        merge_pairwise(src, dest_pairwise, offsets);
+    });
+
+    HPX_TEST(dest_k == dest_pairwise);
+
+    std::cout << "-------------- " << num_runs << " runs --------------\n"
+              << "pairwise hpx::merge : " << time_pairwise << "(sec)\n"
+              << "merge_k             : " << time_k << "(sec)\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    auto const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------\n"
+              << "seed        : " << seed << "\n"
+              << "vector_size : " << size << "\n"
+              << "test_count  : " << test_count << "\n"
+              << "os threads  : " << hpx::get_num_worker_threads() << "\n"
+              << "----------------------------------------------\n\n";
+
+    for (std::size_t num_runs : {4, 16, 64, 256})
+    {
+        run_benchmarks(size, num_runs, test_count);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of elements to merge (default: 10000000)")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
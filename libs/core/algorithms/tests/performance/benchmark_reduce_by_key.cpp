@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the hash based reduce_by_key_unsorted with sorting the keys and
+// values followed by reduce_by_key.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key_unsorted.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename F>
+double run_benchmark(int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::chrono::high_resolution_timer t;
+        f();
+        elapsed += t.elapsed();
+    }
+    return elapsed / test_count;
+}
+
+void run_benchmarks(std::size_t size, std::size_t num_keys, int test_count)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, num_keys - 1);
+
+    std::vector<std::uint64_t> keys(size);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    std::vector<std::uint64_t> const values(size, 1);
+
+    std::vector<std::uint64_t> keys_out(size);
+    std::vector<std::uint64_t> values_out(size);
+
+    std::size_t num_sorted = 0;
+    double const time_sorted = run_benchmark(test_count, [&]() {
+        std::vector<std::uint64_t> k = keys;
+        std::vector<std::uint64_t> v = values;
+        hpx::experimental::sort_by_key(
+            hpx::execution::par, k.begin(), k.end(), v.begin());
+
+        auto result = hpx::experimental::reduce_by_key(hpx::execution::par,
+            k.begin(), k.end(), v.begin(), keys_out.begin(),
+            values_out.begin());
+        num_sorted = std::distance(keys_out.begin(), result.in);
+    });
+
+    std::size_t num_unsorted = 0;
+    double const time_unsorted = run_benchmark(test_count, [&]() {
+        auto result =
+            hpx::experimental::reduce_by_key_unsorted(hpx::execution::par,
+                keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+                values_out.begin());
+        num_unsorted = std::distance(keys_out.begin(), result.in);
+    });
+
+    HPX_TEST_EQ(num_sorted, num_unsorted);
+
+    std::cout << "-------------- " << num_keys << " keys --------------\n"
+              << "sort_by_key + reduce_by_key : " << time_sorted << "(sec)\n"
+              << "reduce_by_key_unsorted      : " << time_unsorted
+              << "(sec)\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    auto const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------\n"
+              << "seed        : " << seed << "\n"
+              << "vector_size : " << size << "\n"
+              << "test_count  : " << test_count << "\n"
+              << "os threads  : " << hpx::get_num_worker_threads() << "\n"
+              << "----------------------------------------------\n\n";
+
+    for (std::size_t num_keys : {std::size_t(16), std::size_t(4096),
+             std::size_t(1) << 20})
+    {
+        run_benchmarks(size, num_keys, test_count);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of key/value pairs to reduce (default: 10000000)")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
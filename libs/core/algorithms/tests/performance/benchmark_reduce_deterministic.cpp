@@ -13,9 +13,11 @@
 #include <hpx/execution.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/parallel/algorithms/reduce_deterministic.hpp>
 
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -57,6 +59,15 @@ void bench_reduce(const PolicyT& policy,
             (std::end(non_deterministic_shuffled)), val_det, op);
 }
 
+template <typename PolicyT, typename IteratorT, typename InitVal>
+void bench_transform_reduce(const PolicyT& policy,
+    const IteratorT& deterministic_shuffled, const InitVal& val_det)
+{
+    [[maybe_unused]] auto r = hpx::transform_reduce(policy,
+        std::begin(deterministic_shuffled), std::end(deterministic_shuffled),
+        val_det, std::plus<>(), [](InitVal v) { return v; });
+}
+
 //////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -131,6 +142,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
                             deterministic_shuffled, val_det, op);
                     });
             }
+            {
+                hpx::util::perftests_report(
+                    "fl transform_reduce", "par", test_count, [&]() {
+                        bench_transform_reduce(hpx::execution::par,
+                            deterministic_shuffled, val_det);
+                    });
+            }
+            {
+                hpx::util::perftests_report("fl transform_reduce "
+                                            "deterministic_reduction",
+                    "par", test_count, [&]() {
+                        bench_transform_reduce(
+                            hpx::execution::par.with(hpx::execution::
+                                    experimental::deterministic_reduction()),
+                            deterministic_shuffled, val_det);
+                    });
+            }
         }
         {
             using FloatTypeDeterministic = double;
@@ -187,6 +215,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
                             deterministic_shuffled, val_det, op);
                     });
             }
+            {
+                hpx::util::perftests_report(
+                    "dbl transform_reduce", "par", test_count, [&]() {
+                        bench_transform_reduce(hpx::execution::par,
+                            deterministic_shuffled, val_det);
+                    });
+            }
+            {
+                hpx::util::perftests_report("dbl transform_reduce "
+                                            "deterministic_reduction",
+                    "par", test_count, [&]() {
+                        bench_transform_reduce(
+                            hpx::execution::par.with(hpx::execution::
+                                    experimental::deterministic_reduction()),
+                            deterministic_shuffled, val_det);
+                    });
+            }
         }
 
         hpx::util::perftests_print_times();
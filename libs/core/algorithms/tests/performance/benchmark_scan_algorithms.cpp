@@ -5,6 +5,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/numeric.hpp>
@@ -31,7 +32,69 @@ enum class ALGORITHM
     UNIQUE_COPY
 };
 
-void measureScanAlgorithms()
+template <typename ExPolicy>
+void runScanAlgorithm(ALGORITHM alg, ExPolicy&& policy,
+    std::vector<int> const& arr, std::vector<int>& res)
+{
+    switch (alg)
+    {
+    case ALGORITHM::INCLUSIVE_SCAN:
+        hpx::inclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), std::plus<int>(), 0);
+        break;
+    case ALGORITHM::EXCLUSIVE_SCAN:
+        hpx::exclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), 10, std::plus<int>{});
+        break;
+    case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
+        hpx::transform_exclusive_scan(policy, arr.begin(), arr.end(),
+            res.begin(), 10, std::plus<int>{}, [](int x) { return x * 10; });
+        break;
+    case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
+        hpx::transform_inclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), std::plus<int>{},
+            [](int x) { return x * 10; }, 10);
+        break;
+    case ALGORITHM::COPY_IF:
+        hpx::copy_if(policy, arr.begin(), arr.end(), res.begin(),
+            [](int x) { return (x % 2) != 0; });
+        break;
+    case ALGORITHM::UNIQUE_COPY:
+        hpx::unique_copy(policy, arr.begin(), arr.end(), res.begin(),
+            std::equal_to<int>{});
+        break;
+    };
+}
+
+// measure the given parallel execution policy
+template <typename ExPolicy>
+double measureParallel(
+    ALGORITHM alg, ExPolicy&& policy, std::vector<int> const& arr, int count)
+{
+    double time = 0;
+    for (int i = 0; i < count + 5; i++)
+    {
+        std::vector<int> res(arr.size());
+        auto t = std::chrono::high_resolution_clock::now();
+
+        runScanAlgorithm(alg, policy, arr, res);
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        // don't consider first 5 iterations
+        if (i < 5)
+        {
+            continue;
+        }
+
+        time +=
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - t)
+                .count();
+    }
+    return time / count;
+}
+
+void measureScanAlgorithms(std::size_t till)
 {
 #if defined(OUTPUT_TO_CSV)
     std::map<ALGORITHM, std::string> filenames = {
@@ -50,11 +113,10 @@ void measureScanAlgorithms()
         alg <= (int) ALGORITHM::UNIQUE_COPY; alg++)
     {
         std::size_t start = 32;
-        std::size_t till = 1 << 10;
 
         const auto NUM_ITERATIONS = 5;
 
-        std::vector<std::array<double, 3>> data;
+        std::vector<std::array<double, 4>> data;
 
         for (std::size_t s = start; s <= till; s *= 2)
         {
@@ -62,7 +124,6 @@ void measureScanAlgorithms()
             std::iota(std::begin(arr), std::end(arr), 1);
 
             double seqTime = 0;
-            double parTime = 0;
 
             for (int i = 0; i < NUM_ITERATIONS + 5; i++)
             {
@@ -113,64 +174,26 @@ void measureScanAlgorithms()
                 seqTime += time_span1.count();
             }
 
-            for (int i = 0; i < NUM_ITERATIONS + 5; i++)
-            {
-                std::vector<int> res1(s);
-                auto t2 = std::chrono::high_resolution_clock::now();
-                switch ((ALGORITHM) alg)
-                {
-                case ALGORITHM::INCLUSIVE_SCAN:
-                    hpx::inclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::plus<int>(), 0);
-                    break;
-                case ALGORITHM::EXCLUSIVE_SCAN:
-                    hpx::exclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), 10, std::plus<int>{});
-                    break;
-                case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
-                    hpx::transform_exclusive_scan(hpx::execution::par,
-                        arr.begin(), arr.end(), res1.begin(), 10,
-                        std::plus<int>{}, [](int x) { return x * 10; });
-                    break;
-                case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
-                    hpx::transform_inclusive_scan(
-                        hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), std::plus<int>{},
-                        [](int x) { return x * 10; }, 10);
-                    break;
-                case ALGORITHM::COPY_IF:
-                    hpx::copy_if(hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), [](int x) { return (x % 2) != 0; });
-                    break;
-                case ALGORITHM::UNIQUE_COPY:
-                    hpx::unique_copy(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::equal_to<int>{});
-                    break;
-                };
-                auto end2 = std::chrono::high_resolution_clock::now();
-
-                // don't consider first 5 iterations
-                if (NUM_ITERATIONS < 5)
-                {
-                    continue;
-                }
+            // the three-phase scan (reduce, combine, scan)
+            double const parTime = measureParallel(
+                (ALGORITHM) alg, hpx::execution::par, arr, NUM_ITERATIONS);
 
-                std::chrono::duration<double> time_span2 =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        end2 - t2);
-
-                parTime += time_span2.count();
-            }
+            // the single-pass scan using decoupled look-back
+            double const singlePassTime = measureParallel((ALGORITHM) alg,
+                hpx::execution::par.with(
+                    hpx::execution::experimental::single_pass_scan()),
+                arr, NUM_ITERATIONS);
 
             seqTime /= NUM_ITERATIONS;
-            parTime /= NUM_ITERATIONS;
 
 #if defined(OUTPUT_TO_CSV)
-            data.push_back(std::array<double, 3>{(double) s, seqTime, parTime});
+            data.push_back(std::array<double, 4>{
+                (double) s, seqTime, parTime, singlePassTime});
 #else
             std::cout << "N : " << s << '\n';
             std::cout << "SEQ: " << seqTime << '\n';
-            std::cout << "PAR: " << parTime << "\n\n";
+            std::cout << "PAR: " << parTime << '\n';
+            std::cout << "SPS: " << singlePassTime << "\n\n";
 #endif
         }
 
@@ -178,25 +201,34 @@ void measureScanAlgorithms()
         std::ofstream outputFile(filenames[(ALGORITHM) alg]);
         for (auto& d : data)
         {
-            outputFile << d[0] << "," << d[1] << "," << d[2] << ","
+            outputFile << d[0] << "," << d[1] << "," << d[2] << "," << d[3]
                        << ",\n";
         }
 #endif
     }
 }
 
-int hpx_main(hpx::program_options::variables_map&)
+int hpx_main(hpx::program_options::variables_map& vm)
 {
-    measureScanAlgorithms();
+    measureScanAlgorithms(vm["max_size"].as<std::size_t>());
 
     return hpx::local::finalize();
 }
 
 int main(int argc, char* argv[])
 {
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("max_size",
+        value<std::size_t>()->default_value(1 << 10),
+        "largest number of elements to scan (default: 1024)");
+
     std::vector<std::string> cfg;
     cfg.push_back("hpx.os_threads=all");
     hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
     init_args.cfg = cfg;
 
     // Initialize and run HPX.
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the parallel set operations (set_union, set_intersection,
+// set_difference, and set_symmetric_difference) with their sequential
+// counterparts from the standard library.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename F>
+double run_benchmark(int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::chrono::high_resolution_timer t;
+        f();
+        elapsed += t.elapsed();
+    }
+    return elapsed / test_count;
+}
+
+using iterator = std::vector<std::uint64_t>::iterator;
+
+template <typename StdOp, typename HpxOp>
+void benchmark_set_operation(char const* name, int test_count,
+    std::vector<std::uint64_t>& src1, std::vector<std::uint64_t>& src2,
+    StdOp&& std_op, HpxOp&& hpx_op)
+{
+    std::vector<std::uint64_t> dest_std(src1.size() + src2.size());
+    std::vector<std::uint64_t> dest_hpx(src1.size() + src2.size());
+
+    iterator last_std = dest_std.begin();
+    double const time_std = run_benchmark(test_count, [&]() {
+        last_std = std_op(src1.begin(), src1.end(), src2.begin(), src2.end(),
+            dest_std.begin());
+    });
+
+    iterator last_seq = dest_hpx.begin();
+    double const time_seq = run_benchmark(test_count, [&]() {
+        last_seq = hpx_op(hpx::execution::seq, src1.begin(), src1.end(),
+            src2.begin(), src2.end(), dest_hpx.begin());
+    });
+
+    iterator last_par = dest_hpx.begin();
+    double const time_par = run_benchmark(test_count, [&]() {
+        last_par = hpx_op(hpx::execution::par, src1.begin(), src1.end(),
+            src2.begin(), src2.end(), dest_hpx.begin());
+    });
+
+    HPX_TEST(last_seq - dest_hpx.begin() == last_std - dest_std.begin());
+    HPX_TEST(last_par - dest_hpx.begin() == last_std - dest_std.begin());
+    HPX_TEST(std::equal(dest_hpx.begin(), last_par, dest_std.begin()));
+
+    std::cout << "-------------- " << name << " --------------\n"
+              << "std    : " << time_std << "(sec)\n"
+              << "seq    : " << time_seq << "(sec)\n"
+              << "par    : " << time_par << "(sec)\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    auto const size = vm["vector_size"].as<std::size_t>();
+    auto const range = vm["value_range"].as<std::uint64_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------\n"
+              << "seed        : " << seed << "\n"
+              << "vector_size : " << size << "\n"
+              << "value_range : " << range << "\n"
+              << "test_count  : " << test_count << "\n"
+              << "os threads  : " << hpx::get_num_worker_threads() << "\n"
+              << "----------------------------------------------\n\n";
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, range - 1);
+
+    std::vector<std::uint64_t> src1(size);
+    std::vector<std::uint64_t> src2(size);
+    std::generate(src1.begin(), src1.end(), [&]() { return dist(gen); });
+    std::generate(src2.begin(), src2.end(), [&]() { return dist(gen); });
+    hpx::sort(hpx::execution::par, src1.begin(), src1.end());
+    hpx::sort(hpx::execution::par, src2.begin(), src2.end());
+
+    // clang-format off
+    benchmark_set_operation("set_union", test_count, src1, src2,
+        [](auto... args) { return std::set_union(args...); },
+        [](auto&& policy, auto... args) {
+            return hpx::set_union(policy, args...);
+        });
+    benchmark_set_operation("set_intersection", test_count, src1, src2,
+        [](auto... args) { return std::set_intersection(args...); },
+        [](auto&& policy, auto... args) {
+            return hpx::set_intersection(policy, args...);
+        });
+    benchmark_set_operation("set_difference", test_count, src1, src2,
+        [](auto... args) { return std::set_difference(args...); },
+        [](auto&& policy, auto... args) {
+            return hpx::set_difference(policy, args...);
+        });
+    benchmark_set_operation("set_symmetric_difference", test_count, src1, src2,
+        [](auto... args) { return std::set_symmetric_difference(args...); },
+        [](auto&& policy, auto... args) {
+            return hpx::set_symmetric_difference(policy, args...);
+        });
+    // clang-format on
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of elements in each of the input sets "
+            "(default: 10000000)")
+        ("value_range", value<std::uint64_t>()->default_value(20000000),
+            "the elements are drawn from [0, value_range), small values "
+            "create many equivalent elements (default: 20000000)")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the radix sort used by hpx::sort for arithmetic keys with the
+// comparison based parallel sort and with std::sort.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1.0e9), T(1.0e9));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    return data;
+}
+
+template <typename T, typename F>
+double run_benchmark(std::vector<T> const& data, int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<T> v = data;
+
+        hpx::chrono::high_resolution_timer t;
+        f(v);
+        elapsed += t.elapsed();
+
+        HPX_TEST(std::is_sorted(v.begin(), v.end()));
+    }
+    return elapsed / test_count;
+}
+
+template <typename T>
+void run_benchmarks(
+    std::string const& type_name, std::size_t size, int test_count)
+{
+    std::vector<T> const data = make_data<T>(size);
+
+    double const time_std = run_benchmark(data, test_count,
+        [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+
+    // the radix sort is used for arithmetic keys compared with std::less
+    double const time_radix =
+        run_benchmark(data, test_count, [](std::vector<T>& v) {
+            hpx::sort(hpx::execution::par, v.begin(), v.end());
+        });
+
+    // an arbitrary comparison function selects the comparison based sort
+    double const time_comparison =
+        run_benchmark(data, test_count, [](std::vector<T>& v) {
+            hpx::sort(hpx::execution::par, v.begin(), v.end(),
+                [](T lhs, T rhs) { return lhs < rhs; });
+        });
+
+    std::cout << "-------------- " << type_name << " (" << size
+              << " elements) --------------\n"
+              << "std::sort                   : " << time_std << "(sec)\n"
+              << "hpx::sort (radix)           : " << time_radix << "(sec)\n"
+              << "hpx::sort (comparison)      : " << time_comparison
+              << "(sec)\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    auto const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------\n"
+              << "seed        : " << seed << "\n"
+              << "vector_size : " << size << "\n"
+              << "test_count  : " << test_count << "\n"
+              << "os threads  : " << hpx::get_num_worker_threads() << "\n"
+              << "----------------------------------------------\n\n";
+
+    run_benchmarks<std::uint64_t>("std::uint64_t", size, test_count);
+    run_benchmarks<int>("int", size, test_count);
+    run_benchmarks<double>("double", size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of elements to sort (default: 10000000)")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
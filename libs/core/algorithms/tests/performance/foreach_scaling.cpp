@@ -81,6 +81,23 @@ std::uint64_t averageout_parallel_foreach(
     return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
 }
 
+template <typename Executor>
+std::uint64_t averageout_cache_aware_foreach(
+    std::size_t vector_size, Executor&& exec)
+{
+    std::vector<std::size_t> data_representation(vector_size);
+    std::iota(
+        std::begin(data_representation), std::end(data_representation), gen());
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    // average out 100 executions to avoid varying results
+    for (auto i = 0; i < test_count; i++)
+        measure_cache_aware_foreach(data_representation, exec);
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
 template <typename Executor>
 std::uint64_t averageout_task_foreach(std::size_t vector_size, Executor&& exec)
 {
@@ -217,14 +234,16 @@ int hpx_main(hpx::program_options::variables_map& vm)
     delay = vm["work_delay"].as<int>();
     test_count = vm["test_count"].as<int>();
     chunk_size = vm["chunk_size"].as<int>();
+    cache_level = vm["cache_level"].as<int>();
     num_overlapping_loops = vm["overlapping_loops"].as<int>();
     disable_stealing = vm.count("disable_stealing");
     fast_idle_mode = vm.count("fast_idle_mode");
 
     bool enable_all = vm.count("enable_all");
-    if (!vm.count("parallel_foreach") && !vm.count("task_foreach") &&
-        !vm.count("sequential_foreach") && !vm.count("parallel_forloop") &&
-        !vm.count("task_forloop") && !vm.count("sequential_forloop"))
+    if (!vm.count("parallel_foreach") && !vm.count("cache_aware_foreach") &&
+        !vm.count("task_foreach") && !vm.count("sequential_foreach") &&
+        !vm.count("parallel_forloop") && !vm.count("task_forloop") &&
+        !vm.count("sequential_forloop"))
     {
         enable_all = true;
     }
@@ -257,6 +276,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
         // results
         std::uint64_t par_time_foreach = 0;
+        std::uint64_t cache_aware_time_foreach = 0;
         std::uint64_t task_time_foreach = 0;
         std::uint64_t seq_time_foreach = 0;
 
@@ -277,6 +297,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 par_time_foreach =
                     averageout_parallel_foreach(vector_size, par);
             }
+            if (enable_all || vm.count("cache_aware_foreach"))
+            {
+                cache_aware_time_foreach =
+                    averageout_cache_aware_foreach(vector_size, par);
+            }
             if (enable_all || vm.count("task_foreach"))
             {
                 task_time_foreach = averageout_task_foreach(vector_size, par);
@@ -309,6 +334,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 par_time_foreach =
                     averageout_parallel_foreach(vector_size, par);
             }
+            if (enable_all || vm.count("cache_aware_foreach"))
+            {
+                cache_aware_time_foreach =
+                    averageout_cache_aware_foreach(vector_size, par);
+            }
             if (enable_all || vm.count("task_foreach"))
             {
                 task_time_foreach = averageout_task_foreach(vector_size, par);
@@ -343,6 +373,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 par_time_foreach =
                     averageout_parallel_foreach(vector_size, par);
             }
+            if (enable_all || vm.count("cache_aware_foreach"))
+            {
+                cache_aware_time_foreach =
+                    averageout_cache_aware_foreach(vector_size, par);
+            }
             if (enable_all || vm.count("task_foreach"))
             {
                 task_time_foreach = averageout_task_foreach(vector_size, par);
@@ -380,6 +415,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 par_time_foreach =
                     averageout_parallel_foreach(vector_size, par);
             }
+            if (enable_all || vm.count("cache_aware_foreach"))
+            {
+                cache_aware_time_foreach =
+                    averageout_cache_aware_foreach(vector_size, par);
+            }
             if (enable_all || vm.count("sequential_foreach"))
             {
                 seq_time_foreach = averageout_sequential_foreach(vector_size);
@@ -421,6 +461,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
             std::cout << "," << static_cast<double>(seq_time_foreach) / 1e9
                       << "," << static_cast<double>(par_time_foreach) / 1e9
                       << "," << static_cast<double>(task_time_foreach) / 1e9
+                      << ","
+                      << static_cast<double>(cache_aware_time_foreach) / 1e9
                       << "\n"
                       << std::flush;
         }
@@ -460,6 +502,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       << std::setw(8)
                       << static_cast<double>(par_time_foreach) / 1e9 << "\n"
                       << std::left
+                      << "Average cache-aware execution time: " << std::right
+                      << std::setw(8)
+                      << static_cast<double>(cache_aware_time_foreach) / 1e9
+                      << "\n"
+                      << std::left
                       << "Average task execution time       : " << std::right
                       << std::setw(8)
                       << static_cast<double>(task_time_foreach) / 1e9 << "\n"
@@ -477,6 +524,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
                              static_cast<double>(par_time_foreach))
                       << "\n"
                       << std::left
+                      << "Cache-aware Scale                 : " << std::right
+                      << std::setw(8)
+                      << (static_cast<double>(seq_time_foreach) /
+                             static_cast<double>(cache_aware_time_foreach))
+                      << "\n"
+                      << std::left
                       << "Task Scale                        : " << std::right
                       << std::setw(8)
                       << (static_cast<double>(seq_time_foreach) /
@@ -538,6 +591,9 @@ int main(int argc, char* argv[])
             "number of tests to be averaged")
         ("chunk_size", value<int>()->default_value(0),
             "number of iterations to combine while parallelization")
+        ("cache_level", value<int>()->default_value(2),
+            "cache level the data of each chunk should fit for "
+            "cache_aware_foreach")
         ("overlapping_loops", value<int>()->default_value(0),
             "number of overlapping task loops")
         ("csv_output", "print results in csv format")
@@ -549,6 +605,8 @@ int main(int argc, char* argv[])
 
         ("enable_all", "enable all benchmarks")
         ("parallel_foreach", "enable parallel_foreach")
+        ("cache_aware_foreach",
+            "enable parallel_foreach using cache_aware_chunk_size")
         ("task_foreach", "enable task_foreach")
         ("sequential_foreach", "enable sequential_foreach")
         ("parallel_forloop", "enable parallel_forloop")
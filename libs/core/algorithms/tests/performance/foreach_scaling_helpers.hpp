@@ -27,6 +27,7 @@
 inline int delay = 1000;
 inline int test_count = 100;
 inline int chunk_size = 0;
+inline int cache_level = 2;
 inline int num_overlapping_loops = 0;
 inline bool disable_stealing = false;
 inline bool fast_idle_mode = false;
@@ -168,6 +169,23 @@ void measure_parallel_foreach(
     }
 }
 
+template <typename Executor>
+void measure_cache_aware_foreach(
+    std::vector<std::size_t> const& data_representation, Executor&& exec)
+{
+    using iterator = std::vector<std::size_t>::const_iterator;
+
+    // create executor parameters object sizing the chunks such that the data
+    // touched by each of them fits the given cache level
+    auto cacs =
+        hpx::execution::experimental::make_cache_aware_chunk_size<iterator>(
+            cache_level);
+
+    // invoke parallel for_each
+    hpx::ranges::for_each(hpx::execution::par.with(cacs).on(exec),
+        data_representation, [](std::size_t) { worker_timed(delay); });
+}
+
 template <typename Executor>
 hpx::future<void> measure_task_foreach(
     std::shared_ptr<std::vector<std::size_t>> data_representation,
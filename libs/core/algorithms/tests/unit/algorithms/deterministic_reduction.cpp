@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that floating point sums computed using the deterministic_reduction
+// executor parameters are bit-identical independently of the chunking and of
+// the order of the input values.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr std::size_t test_size = 100007;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// values spanning many orders of magnitude with mixed signs make the result of
+// a naive summation depend on the order of the additions
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+
+    std::vector<T> data(size);
+    std::generate(data.begin(), data.end(), [&]() {
+        return static_cast<T>(std::ldexp(mantissa(gen), exponent(gen)));
+    });
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_transform_reduce(ExPolicy&& policy, std::vector<T> const& data,
+    std::vector<T> const& shuffled, T expected)
+{
+    auto conv = [](T val) { return 2 * val; };
+
+    T result = hpx::transform_reduce(
+        policy, data.begin(), data.end(), T(1), std::plus<>(), conv);
+    HPX_TEST_EQ(result, expected);
+
+    result = hpx::transform_reduce(
+        policy, shuffled.begin(), shuffled.end(), T(1), std::plus<>(), conv);
+    HPX_TEST_EQ(result, expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_transform_reduce_binary(ExPolicy&& policy, std::vector<T> const& lhs,
+    std::vector<T> const& rhs, T expected)
+{
+    T result = hpx::transform_reduce(policy, lhs.begin(), lhs.end(),
+        rhs.begin(), T(0), std::plus<>(), std::multiplies<>());
+    HPX_TEST_EQ(result, expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_inclusive_scan(ExPolicy&& policy, std::vector<T> const& data,
+    std::vector<T> const& expected)
+{
+    std::vector<T> result(data.size());
+    hpx::inclusive_scan(policy, data.begin(), data.end(), result.begin(),
+        std::plus<>(), T(1));
+    HPX_TEST(result == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_for_loop_reduction(
+    ExPolicy&& policy, std::vector<T> const& data, T expected)
+{
+    // the for_loop accumulates the same values as transform_reduce
+    T sum = T(1);
+    hpx::experimental::for_loop(policy, std::size_t(0), data.size(),
+        hpx::experimental::reduction_plus(sum),
+        [&](std::size_t i, T& val) { val += 2 * data[i]; });
+    HPX_TEST_EQ(sum, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_deterministic_reduction(ExPolicy&& policy,
+    std::vector<T> const& data, std::vector<T> const& shuffled,
+    std::vector<T> const& other, T expected_sum, T expected_dot,
+    std::vector<T> const& expected_scan)
+{
+    test_transform_reduce(policy, data, shuffled, expected_sum);
+    test_transform_reduce_binary(policy, data, other, expected_dot);
+    test_inclusive_scan(policy, data, expected_scan);
+    test_for_loop_reduction(policy, data, expected_sum);
+}
+
+template <typename T>
+void test_deterministic_reduction()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::deterministic_reduction;
+    using hpx::execution::experimental::static_chunk_size;
+
+    std::vector<T> const data = make_data<T>(test_size);
+    std::vector<T> const other = make_data<T>(test_size);
+
+    std::vector<T> shuffled = data;
+    std::shuffle(shuffled.begin(), shuffled.end(), gen);
+
+    // the sequential results serve as reference
+    auto const ref = seq.with(deterministic_reduction());
+
+    T const expected_sum = hpx::transform_reduce(ref, data.begin(), data.end(),
+        T(1), std::plus<>(), [](T val) { return 2 * val; });
+    T const expected_dot = hpx::transform_reduce(ref, data.begin(), data.end(),
+        other.begin(), T(0), std::plus<>(), std::multiplies<>());
+
+    std::vector<T> expected_scan(test_size);
+    hpx::inclusive_scan(ref, data.begin(), data.end(), expected_scan.begin(),
+        std::plus<>(), T(1));
+
+    // the result is close to the exact sum
+    long double exact = 1;
+    for (T val : data)
+    {
+        exact += 2 * static_cast<long double>(val);
+    }
+    HPX_TEST_LT(std::abs(static_cast<long double>(expected_sum) - exact),
+        1e-6L * std::abs(exact) + 1e-3L);
+
+    test_deterministic_reduction(ref, data, shuffled, other, expected_sum,
+        expected_dot, expected_scan);
+    test_deterministic_reduction(par.with(deterministic_reduction()), data,
+        shuffled, other, expected_sum, expected_dot, expected_scan);
+    test_deterministic_reduction(par_unseq.with(deterministic_reduction()),
+        data, shuffled, other, expected_sum, expected_dot, expected_scan);
+
+    // the chunking does not influence the results
+    for (std::size_t chunk_size : {1, 17, 1000, 65536})
+    {
+        test_deterministic_reduction(
+            par.with(static_chunk_size(chunk_size), deterministic_reduction()),
+            data, shuffled, other, expected_sum, expected_dot, expected_scan);
+    }
+
+    // asynchronous execution
+    {
+        auto f = hpx::transform_reduce(
+            par(task).with(deterministic_reduction()), shuffled.begin(),
+            shuffled.end(), T(1), std::plus<>(), [](T val) { return 2 * val; });
+        HPX_TEST_EQ(f.get(), expected_sum);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_deterministic_reduction<double>();
+    test_deterministic_reduction<float>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -554,6 +554,50 @@ void test_inplace_merge_etc(
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+struct tagged_value
+{
+    int value;
+    int tag;
+};
+
+// Large enough to merge through a temporary buffer; most elements are
+// equivalent, the relative order of those has to be preserved.
+template <typename ExPolicy>
+void test_inplace_merge_skewed(ExPolicy&& policy)
+{
+    std::size_t const left_size = 300007;
+    std::size_t const right_size = 123457;
+
+    std::vector<tagged_value> res(left_size + right_size);
+    for (std::size_t i = 0; i != left_size; ++i)
+    {
+        int const value = i < left_size / 2 ? 0 : static_cast<int>(i);
+        res[i] = tagged_value{value, static_cast<int>(i)};
+    }
+    for (std::size_t i = 0; i != right_size; ++i)
+    {
+        res[left_size + i] = tagged_value{0, -static_cast<int>(i) - 1};
+    }
+    std::vector<tagged_value> sol = res;
+
+    auto comp = [](tagged_value const& lhs, tagged_value const& rhs) {
+        return lhs.value < rhs.value;
+    };
+
+    hpx::inplace_merge(policy, std::begin(res), std::begin(res) + left_size,
+        std::end(res), comp);
+    std::inplace_merge(std::begin(sol), std::begin(sol) + left_size,
+        std::end(sol), comp);
+
+    bool equality = std::equal(std::begin(res), std::end(res),
+        std::begin(sol), [](tagged_value const& lhs, tagged_value const& rhs) {
+            return lhs.value == rhs.value && lhs.tag == rhs.tag;
+        });
+
+    HPX_TEST(equality);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_inplace_merge()
@@ -648,6 +692,11 @@ void test_inplace_merge()
     test_inplace_merge_etc(par, IteratorTag(), user_defined_type(), rand_base);
     test_inplace_merge_etc(
         par_unseq, IteratorTag(), user_defined_type(), rand_base);
+
+    ////////// Test cases for heavily skewed inputs.
+    test_inplace_merge_skewed(seq);
+    test_inplace_merge_skewed(par);
+    test_inplace_merge_skewed(par_unseq);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,234 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the tag records the run and the position of an element inside its run,
+// which allows verifying the stability of the merge
+struct tagged_value
+{
+    int value;
+    std::size_t tag;
+};
+
+bool operator==(tagged_value const& lhs, tagged_value const& rhs)
+{
+    return lhs.value == rhs.value && lhs.tag == rhs.tag;
+}
+
+struct compare_value
+{
+    bool operator()(tagged_value const& lhs, tagged_value const& rhs) const
+    {
+        return lhs.value < rhs.value;
+    }
+};
+
+std::vector<std::vector<tagged_value>> make_runs(
+    std::size_t num_runs, std::size_t max_size, int max_value)
+{
+    std::uniform_int_distribution<std::size_t> size_dist(0, max_size);
+    std::uniform_int_distribution<int> value_dist(0, max_value);
+
+    std::vector<std::vector<tagged_value>> runs(num_runs);
+    for (std::size_t run = 0; run != num_runs; ++run)
+    {
+        // every third run is much shorter than the others
+        std::size_t const size =
+            run % 3 == 2 ? size_dist(gen) / 100 : size_dist(gen);
+
+        std::vector<int> values(size);
+        std::generate(
+            values.begin(), values.end(), [&]() { return value_dist(gen); });
+        std::sort(values.begin(), values.end());
+
+        runs[run].reserve(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            runs[run].push_back(tagged_value{values[i], run * max_size + i});
+        }
+    }
+    return runs;
+}
+
+// concatenating all runs followed by a stable sort produces the expected
+// order of equivalent elements
+std::vector<tagged_value> make_expected(
+    std::vector<std::vector<tagged_value>> const& runs)
+{
+    std::vector<tagged_value> expected;
+    for (auto const& run : runs)
+    {
+        expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::stable_sort(expected.begin(), expected.end(), compare_value());
+    return expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge_k(ExPolicy&& policy, std::size_t num_runs,
+    std::size_t max_size, int max_value)
+{
+    auto const runs = make_runs(num_runs, max_size, max_value);
+    auto const expected = make_expected(runs);
+
+    std::vector<tagged_value> dest(expected.size());
+    auto result = hpx::experimental::merge_k(
+        policy, runs.begin(), runs.end(), dest.begin(), compare_value());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+template <typename ExPolicy>
+void test_merge_k_async(ExPolicy&& policy, std::size_t num_runs,
+    std::size_t max_size, int max_value)
+{
+    auto const runs = make_runs(num_runs, max_size, max_value);
+    auto const expected = make_expected(runs);
+
+    std::vector<tagged_value> dest(expected.size());
+    auto f = hpx::experimental::merge_k(
+        policy, runs.begin(), runs.end(), dest.begin(), compare_value());
+
+    HPX_TEST(f.get() == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+void test_merge_k_seq(std::size_t num_runs, std::size_t max_size, int max_value)
+{
+    auto const runs = make_runs(num_runs, max_size, max_value);
+    auto const expected = make_expected(runs);
+
+    std::vector<tagged_value> dest;
+    hpx::experimental::merge_k(runs.begin(), runs.end(),
+        std::back_inserter(dest), compare_value());
+
+    HPX_TEST(dest == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// runs referring to parts of a single sequence, using a projection and a
+// user supplied comparison
+template <typename ExPolicy>
+void test_merge_k_ranges(ExPolicy&& policy)
+{
+    std::size_t const size = 200003;
+    std::size_t const num_runs = 11;
+
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<int> src(size);
+    std::generate(src.begin(), src.end(), [&]() { return dist(gen); });
+
+    using iterator = std::vector<int>::iterator;
+    std::vector<hpx::util::iterator_range<iterator>> runs;
+    for (std::size_t run = 0; run != num_runs; ++run)
+    {
+        iterator first = src.begin() + run * size / num_runs;
+        iterator last = src.begin() + (run + 1) * size / num_runs;
+        std::sort(first, last, std::greater<>());
+        runs.push_back(hpx::util::iterator_range<iterator>(first, last));
+    }
+
+    std::vector<int> dest(size);
+    auto result = hpx::experimental::merge_k(policy, runs.begin(), runs.end(),
+        dest.begin(), std::less<>(), [](int v) { return -v; });
+
+    std::sort(src.begin(), src.end(), std::greater<>());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(dest == src);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge_k(ExPolicy&& policy)
+{
+    // few distinct values (many equivalent elements) and mostly distinct
+    // values, for various numbers of runs
+    for (std::size_t num_runs : {0, 1, 2, 3, 7, 64})
+    {
+        test_merge_k(policy, num_runs, 50000, 10);
+        test_merge_k(policy, num_runs, 50000, 1000000);
+    }
+
+    // all elements equivalent
+    test_merge_k(policy, 5, 100000, 0);
+
+    test_merge_k_ranges(policy);
+}
+
+void test_merge_k()
+{
+    using namespace hpx::execution;
+
+    test_merge_k(seq);
+    test_merge_k(par);
+    test_merge_k(par_unseq);
+
+    test_merge_k_async(seq(task), 7, 50000, 1000);
+    test_merge_k_async(par(task), 7, 50000, 1000);
+
+    test_merge_k_seq(0, 1000, 100);
+    test_merge_k_seq(7, 50000, 1000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_merge_k();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -600,6 +600,57 @@ void test_merge_etc(
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+struct tagged_value
+{
+    int value;
+    int tag;
+};
+
+// Most elements of both sequences are equivalent which makes the merge path
+// very unbalanced. The result has to be identical to the one of std::merge,
+// including the relative order of equivalent elements.
+template <typename ExPolicy>
+void test_merge_skewed(ExPolicy&& policy)
+{
+    std::size_t const size1 = 300007;
+    std::size_t const size2 = 123457;
+
+    std::vector<tagged_value> src1(size1), src2(size2);
+    for (std::size_t i = 0; i != size1; ++i)
+    {
+        int const value = i < size1 / 2 ? 0 : static_cast<int>(i);
+        src1[i] = tagged_value{value, static_cast<int>(i)};
+    }
+    for (std::size_t i = 0; i != size2; ++i)
+    {
+        src2[i] = tagged_value{0, -static_cast<int>(i) - 1};
+    }
+
+    auto comp = [](tagged_value const& lhs, tagged_value const& rhs) {
+        return lhs.value < rhs.value;
+    };
+
+    std::vector<tagged_value> dest_res(size1 + size2);
+    std::vector<tagged_value> dest_sol(size1 + size2);
+
+    auto result = hpx::merge(policy, std::begin(src1), std::end(src1),
+        std::begin(src2), std::end(src2), std::begin(dest_res), comp);
+    auto solution = std::merge(std::begin(src1), std::end(src1),
+        std::begin(src2), std::end(src2), std::begin(dest_sol), comp);
+
+    HPX_TEST(result == std::end(dest_res));
+    HPX_TEST(solution == std::end(dest_sol));
+
+    bool equality = std::equal(std::begin(dest_res), std::end(dest_res),
+        std::begin(dest_sol), [](tagged_value const& lhs,
+                                  tagged_value const& rhs) {
+            return lhs.value == rhs.value && lhs.tag == rhs.tag;
+        });
+
+    HPX_TEST(equality);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_merge()
@@ -693,6 +744,11 @@ void test_merge()
     test_merge_etc(seq, IteratorTag(), user_defined_type(), rand_base);
     test_merge_etc(par, IteratorTag(), user_defined_type(), rand_base);
     test_merge_etc(par_unseq, IteratorTag(), user_defined_type(), rand_base);
+
+    ////////// Test cases for heavily skewed inputs.
+    test_merge_skewed(seq);
+    test_merge_skewed(par);
+    test_merge_skewed(par_unseq);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,251 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the algorithms writing their results using streaming stores
+// (enabled by the non_temporal_stores executor parameters) produce the same
+// results as their regular counterparts for all alignments of the
+// destination.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/memory.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr std::size_t test_size = 10007;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// element type whose size is not a power of two
+struct triple
+{
+    std::int32_t a, b, c;
+
+    friend bool operator==(triple const& lhs, triple const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c;
+    }
+};
+
+template <typename T>
+T make_value(std::size_t i)
+{
+    if constexpr (std::is_same_v<T, triple>)
+    {
+        auto const v = static_cast<std::int32_t>(i);
+        return triple{v, -v, v * 3};
+    }
+    else
+    {
+        return static_cast<T>(i % 101);
+    }
+}
+
+template <typename T>
+T twice(T const& v)
+{
+    if constexpr (std::is_same_v<T, triple>)
+    {
+        return triple{2 * v.a, 2 * v.b, 2 * v.c};
+    }
+    else
+    {
+        return static_cast<T>(2 * v);
+    }
+}
+
+template <typename T>
+T sum(T const& lhs, T const& rhs)
+{
+    if constexpr (std::is_same_v<T, triple>)
+    {
+        return triple{lhs.a + rhs.a, lhs.b + rhs.b, lhs.c + rhs.c};
+    }
+    else
+    {
+        return static_cast<T>(lhs + rhs);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_non_temporal_stores(ExPolicy const& policy, std::size_t offset)
+{
+    std::size_t const count = test_size - offset;
+
+    std::vector<T> src(test_size);
+    std::vector<T> other(test_size);
+    for (std::size_t i = 0; i != test_size; ++i)
+    {
+        src[i] = make_value<T>(i + gen() % 7);
+        other[i] = make_value<T>(i * 3);
+    }
+
+    // the destination starts at a different offset than the source
+    std::vector<T> dest(test_size + 1);
+    std::vector<T> expected(test_size + 1);
+    auto const first = dest.begin() + offset + 1;
+    auto const expected_first = expected.begin() + offset + 1;
+
+    // fill, fill_n
+    T const value = make_value<T>(42);
+    hpx::fill(policy, first, dest.end(), value);
+    std::fill(expected_first, expected.end(), value);
+    HPX_TEST(dest == expected);
+
+    HPX_TEST(hpx::fill_n(policy, first, count / 2, make_value<T>(17)) ==
+        first + count / 2);
+    std::fill_n(expected_first, count / 2, make_value<T>(17));
+    HPX_TEST(dest == expected);
+
+    // copy, copy_n
+    auto const src_first = src.begin() + offset;
+    HPX_TEST(hpx::copy(policy, src_first, src.end(), first) == dest.end());
+    std::copy(src_first, src.end(), expected_first);
+    HPX_TEST(dest == expected);
+
+    std::fill(dest.begin(), dest.end(), T{});
+    hpx::copy_n(policy, src_first, count, first);
+    HPX_TEST(dest == expected);
+
+    // transform
+    HPX_TEST(hpx::transform(policy, src_first, src.end(), first,
+                 [](T const& v) { return twice(v); }) == dest.end());
+    std::transform(src_first, src.end(), expected_first,
+        [](T const& v) { return twice(v); });
+    HPX_TEST(dest == expected);
+
+    hpx::transform(policy, src_first, src.end(), other.begin(), first,
+        [](T const& lhs, T const& rhs) { return sum(lhs, rhs); });
+    std::transform(src_first, src.end(), other.begin(), expected_first,
+        [](T const& lhs, T const& rhs) { return sum(lhs, rhs); });
+    HPX_TEST(dest == expected);
+
+    auto const result = hpx::ranges::transform(policy, src_first, src.end(),
+        other.begin(), other.end(), first,
+        [](T const& lhs, T const& rhs) { return sum(rhs, lhs); });
+    HPX_TEST(result.out == dest.end());
+    HPX_TEST(dest == expected);
+
+    // uninitialized_copy, uninitialized_copy_n, uninitialized_fill,
+    // uninitialized_fill_n
+    std::allocator<T> alloc;
+    T* buffer = alloc.allocate(test_size + 1);
+    T* const buffer_first = buffer + offset + 1;
+
+    HPX_TEST(hpx::uninitialized_copy(policy, src_first, src.end(),
+                 buffer_first) == buffer + test_size + 1);
+    HPX_TEST(std::equal(src_first, src.end(), buffer_first));
+
+    hpx::uninitialized_copy_n(policy, other.begin(), count, buffer_first);
+    HPX_TEST(std::equal(other.begin(), other.begin() + count, buffer_first));
+
+    hpx::uninitialized_fill(
+        policy, buffer_first, buffer + test_size + 1, value);
+    HPX_TEST(std::all_of(buffer_first, buffer + test_size + 1,
+        [&](T const& v) { return v == value; }));
+
+    hpx::uninitialized_fill_n(policy, buffer_first, count, make_value<T>(3));
+    HPX_TEST(std::all_of(buffer_first, buffer_first + count,
+        [](T const& v) { return v == make_value<T>(3); }));
+
+    alloc.deallocate(buffer, test_size + 1);
+}
+
+template <typename T>
+void test_non_temporal_stores()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::non_temporal_stores;
+    using hpx::execution::experimental::static_chunk_size;
+
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        test_non_temporal_stores<T>(par.with(non_temporal_stores()), offset);
+        test_non_temporal_stores<T>(
+            par_unseq.with(non_temporal_stores()), offset);
+    }
+
+    // chunks start at arbitrary alignments
+    for (std::size_t chunk_size : {1, 3, 17, 1000})
+    {
+        test_non_temporal_stores<T>(
+            par.with(static_chunk_size(chunk_size), non_temporal_stores()), 5);
+    }
+}
+
+void test_non_temporal_stores_async()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::non_temporal_stores;
+
+    std::vector<double> src(test_size);
+    std::iota(src.begin(), src.end(), 0.0);
+
+    std::vector<double> dest(test_size);
+    auto policy = par(task).with(non_temporal_stores());
+
+    HPX_TEST(hpx::copy(policy, src.begin(), src.end(), dest.begin()).get() ==
+        dest.end());
+    HPX_TEST(src == dest);
+
+    hpx::fill(policy, dest.begin(), dest.end(), 1.0).get();
+    HPX_TEST(std::all_of(
+        dest.begin(), dest.end(), [](double v) { return v == 1.0; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_non_temporal_stores<char>();
+    test_non_temporal_stores<double>();
+    test_non_temporal_stores<triple>();
+    test_non_temporal_stores_async();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
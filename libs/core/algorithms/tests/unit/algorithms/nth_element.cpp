@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <random>
@@ -141,6 +142,58 @@ void nth_element_test()
     test_nth_element<std::random_access_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// inputs large enough to be split by sampled splitters, with few distinct
+// values, all elements equal, and already sorted data
+template <typename ExPolicy>
+void test_nth_element_large(ExPolicy policy, std::size_t num_values)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::size_t const size = 1000003;
+    std::uniform_int_distribution<std::size_t> dist(0, num_values - 1);
+
+    std::vector<std::size_t> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dist(gen); });
+
+    for (int i = 0; i != 2; ++i)
+    {
+        std::vector<std::size_t> d = c;
+        for (std::size_t nth : {std::size_t(0), size / 100, size / 2,
+                 size - size / 100, size - 1})
+        {
+            std::vector<std::size_t> e = d;
+            hpx::nth_element(policy, std::begin(e), std::begin(e) + nth,
+                std::end(e), std::greater<>());
+
+            std::nth_element(std::begin(d), std::begin(d) + nth, std::end(d),
+                std::greater<>());
+
+            HPX_TEST_EQ(e[nth], d[nth]);
+            HPX_TEST(std::all_of(std::begin(e), std::begin(e) + nth,
+                [&](std::size_t v) { return v >= e[nth]; }));
+            HPX_TEST(std::all_of(std::begin(e) + nth + 1, std::end(e),
+                [&](std::size_t v) { return v <= e[nth]; }));
+        }
+
+        // repeat with sorted input
+        std::sort(std::begin(c), std::end(c));
+    }
+}
+
+void nth_element_large_test()
+{
+    using namespace hpx::execution;
+    for (std::size_t num_values : {std::size_t(1), std::size_t(10),
+             std::size_t(1000), std::size_t(1) << 40})
+    {
+        test_nth_element_large(seq, num_values);
+        test_nth_element_large(par, num_values);
+        test_nth_element_large(par_unseq, num_values);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_nth_element_exception(ExPolicy policy, IteratorTag)
@@ -355,6 +408,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     gen.seed(seed);
 
     nth_element_test();
+    nth_element_large_test();
     nth_element_exception_test();
     nth_element_bad_alloc_test();
     return hpx::local::finalize();
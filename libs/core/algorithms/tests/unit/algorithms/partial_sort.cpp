@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <random>
 #include <string>
@@ -41,7 +42,7 @@ void test_partial_sort(IteratorTag)
     }
     std::shuffle(A.begin(), A.end(), gen);
 
-    for (std::uint64_t i = 1; i < SIZE; ++i)
+    for (std::uint64_t i = 1; i <= SIZE; ++i)
     {
         B = A;
         hpx::partial_sort(B.begin(), B.begin() + static_cast<std::ptrdiff_t>(i),
@@ -69,7 +70,7 @@ void test_partial_sort(ExPolicy policy, IteratorTag)
     }
     std::shuffle(A.begin(), A.end(), gen);
 
-    for (std::uint64_t i = 1; i < SIZE; ++i)
+    for (std::uint64_t i = 1; i <= SIZE; ++i)
     {
         B = A;
         hpx::partial_sort(policy, B.begin(),
@@ -97,7 +98,7 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
     std::shuffle(A.begin(), A.end(), gen);
 
-    for (std::uint64_t i = 1; i < SIZE; ++i)
+    for (std::uint64_t i = 1; i <= SIZE; ++i)
     {
         B = A;
         auto result = hpx::partial_sort(p, B.begin(),
@@ -130,6 +131,43 @@ void partial_sort_test()
     test_partial_sort<std::forward_iterator_tag>();
 }
 
+// inputs large enough to be split by sampled splitters, with and without
+// many equivalent elements
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy policy, std::uint64_t num_values)
+{
+    std::size_t const size = 1000003;
+    std::uniform_int_distribution<std::uint64_t> dist(0, num_values - 1);
+
+    std::vector<std::uint64_t> A(size);
+    std::generate(A.begin(), A.end(), [&]() { return dist(gen); });
+
+    std::vector<std::uint64_t> sorted = A;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::size_t middle : {std::size_t(1), size / 1000, size / 2,
+             size - 1, size})
+    {
+        std::vector<std::uint64_t> B = A;
+        hpx::partial_sort(policy, B.begin(),
+            B.begin() + static_cast<std::ptrdiff_t>(middle), B.end());
+
+        HPX_TEST(std::equal(B.begin(),
+            B.begin() + static_cast<std::ptrdiff_t>(middle), sorted.begin()));
+    }
+}
+
+void partial_sort_large_test()
+{
+    using namespace hpx::execution;
+    for (std::uint64_t num_values : {1, 10, 1000000})
+    {
+        test_partial_sort_large(seq, num_values);
+        test_partial_sort_large(par, num_values);
+        test_partial_sort_large(par_unseq, num_values);
+    }
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     if (vm.count("seed"))
@@ -139,6 +177,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     gen.seed(seed);
 
     partial_sort_test();
+    partial_sort_large_test();
 
     return hpx::local::finalize();
 }
@@ -0,0 +1,220 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/pop_heap_n.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// remove count elements from a heap of size elements, the result has to
+// match calling std::pop_heap count times
+template <typename ExPolicy>
+void test_pop_heap_n(ExPolicy&& policy, std::size_t size, std::size_t count,
+    int max_value)
+{
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    std::make_heap(c.begin(), c.end());
+
+    std::vector<int> expected = c;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        std::pop_heap(expected.begin(), expected.end() - i);
+    }
+
+    auto result =
+        hpx::experimental::pop_heap_n(policy, c.begin(), c.end(), count);
+
+    HPX_TEST(result == c.end());
+    HPX_TEST(std::is_heap(c.begin(), c.end() - count));
+    HPX_TEST(std::equal(c.end() - count, c.end(), expected.end() - count));
+
+    std::sort(c.begin(), c.end() - count);
+    std::sort(expected.begin(), expected.end() - count);
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_pop_heap_n_async(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+    std::size_t const count = 12345;
+
+    std::uniform_int_distribution<int> dist(0, 1000000);
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    std::make_heap(c.begin(), c.end(), std::greater<>());
+
+    std::vector<int> smallest = c;
+    std::sort(smallest.begin(), smallest.end());
+    smallest.resize(count);
+
+    auto f = hpx::experimental::pop_heap_n(
+        policy, c.begin(), c.end(), count, std::greater<>());
+
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::is_heap(c.begin(), c.end() - count, std::greater<>()));
+    HPX_TEST(std::equal(smallest.rbegin(), smallest.rend(), c.end() - count));
+}
+
+// a projection selecting the member used for the comparison
+template <typename ExPolicy>
+void test_pop_heap_n_proj(ExPolicy&& policy)
+{
+    struct item
+    {
+        int key;
+        int value;
+    };
+
+    std::size_t const size = 50007;
+    std::size_t const count = 1000;
+
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<item> c(size);
+    std::generate(
+        c.begin(), c.end(), [&]() { return item{dist(gen), dist(gen)}; });
+
+    auto less = [](item const& lhs, item const& rhs) {
+        return lhs.key < rhs.key;
+    };
+    std::make_heap(c.begin(), c.end(), less);
+
+    hpx::experimental::pop_heap_n(policy, c.begin(), c.end(), count,
+        std::less<>(), [](item const& i) { return i.key; });
+
+    HPX_TEST(std::is_heap(c.begin(), c.end() - count, less));
+    HPX_TEST(std::is_sorted(c.end() - count, c.end(), less));
+    HPX_TEST(!less(*(c.end() - count), c.front()));
+}
+
+template <typename ExPolicy>
+void test_pop_heap_n_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    std::iota(c.begin(), c.end(), 0);
+    std::make_heap(c.begin(), c.end());
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::pop_heap_n(policy, c.begin(), c.end(), 1000,
+            [](int lhs, int rhs) -> bool {
+                if (lhs == rhs)
+                    return false;
+                throw std::runtime_error("test");
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_pop_heap_n(ExPolicy&& policy)
+{
+    // removing no elements, a few elements, and all elements, from heaps
+    // with few distinct and with mostly distinct values
+    for (std::size_t size : {1, 2, 3, 17, 1000, 100003})
+    {
+        for (std::size_t count : {std::size_t(0), std::size_t(1),
+                 size / 1000, size / 3, size - 1, size})
+        {
+            test_pop_heap_n(policy, size, count, 1000000);
+            test_pop_heap_n(policy, size, count, 10);
+        }
+    }
+
+    test_pop_heap_n_proj(policy);
+}
+
+void pop_heap_n_test()
+{
+    using namespace hpx::execution;
+
+    test_pop_heap_n(seq);
+    test_pop_heap_n(par);
+    test_pop_heap_n(par_unseq);
+
+    test_pop_heap_n_async(seq(task));
+    test_pop_heap_n_async(par(task));
+
+    test_pop_heap_n_exception(seq);
+    test_pop_heap_n_exception(par);
+
+    // the overload without execution policy
+    std::vector<int> c = {8, 7, 5, 3, 4, 1, 2};
+    std::make_heap(c.begin(), c.end());
+    hpx::experimental::pop_heap_n(c.begin(), c.end(), 3);
+    HPX_TEST(std::is_heap(c.begin(), c.end() - 3));
+    HPX_TEST((std::vector<int>(c.end() - 3, c.end()) ==
+        std::vector<int>{5, 7, 8}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    pop_heap_n_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,205 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/push_heap_n.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// insert count random elements into a heap of size - count elements
+template <typename ExPolicy>
+void test_push_heap_n(ExPolicy&& policy, std::size_t size, std::size_t count,
+    int max_value)
+{
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    std::make_heap(c.begin(), c.end() - count);
+
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto result =
+        hpx::experimental::push_heap_n(policy, c.begin(), c.end(), count);
+
+    HPX_TEST(result == c.end());
+    HPX_TEST(std::is_heap(c.begin(), c.end()));
+
+    std::sort(c.begin(), c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_push_heap_n_async(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+    std::size_t const count = 12345;
+
+    std::uniform_int_distribution<int> dist(0, 1000000);
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    std::make_heap(c.begin(), c.end() - count, std::greater<>());
+
+    auto f = hpx::experimental::push_heap_n(
+        policy, c.begin(), c.end(), count, std::greater<>());
+
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::is_heap(c.begin(), c.end(), std::greater<>()));
+}
+
+// a projection selecting the member used for the comparison
+template <typename ExPolicy>
+void test_push_heap_n_proj(ExPolicy&& policy)
+{
+    struct item
+    {
+        int key;
+        int value;
+    };
+
+    std::size_t const size = 50007;
+    std::size_t const count = 7;
+
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<item> c(size);
+    std::generate(
+        c.begin(), c.end(), [&]() { return item{dist(gen), dist(gen)}; });
+
+    auto less = [](item const& lhs, item const& rhs) {
+        return lhs.key < rhs.key;
+    };
+    std::make_heap(c.begin(), c.end() - count, less);
+
+    hpx::experimental::push_heap_n(policy, c.begin(), c.end(), count,
+        std::less<>(), [](item const& i) { return i.key; });
+
+    HPX_TEST(std::is_heap(c.begin(), c.end(), less));
+}
+
+template <typename ExPolicy>
+void test_push_heap_n_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    std::iota(c.begin(), c.end(), 0);
+    std::make_heap(c.begin(), c.end() - 1000);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::push_heap_n(policy, c.begin(), c.end(), 1000,
+            [](int lhs, int rhs) -> bool {
+                if (lhs == rhs)
+                    return false;
+                throw std::runtime_error("test");
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_push_heap_n(ExPolicy&& policy)
+{
+    // inserting into an empty heap, a few elements, many elements spanning
+    // two levels, and more elements than the heap holds
+    for (std::size_t size : {1, 2, 3, 17, 1000, 100003})
+    {
+        for (std::size_t count : {std::size_t(0), std::size_t(1),
+                 size / 1000, size / 3, size / 2, size - size / 3, size})
+        {
+            test_push_heap_n(policy, size, count, 1000000);
+            test_push_heap_n(policy, size, count, 10);
+        }
+    }
+
+    test_push_heap_n_proj(policy);
+}
+
+void push_heap_n_test()
+{
+    using namespace hpx::execution;
+
+    test_push_heap_n(seq);
+    test_push_heap_n(par);
+    test_push_heap_n(par_unseq);
+
+    test_push_heap_n_async(seq(task));
+    test_push_heap_n_async(par(task));
+
+    test_push_heap_n_exception(seq);
+    test_push_heap_n_exception(par);
+
+    // the overload without execution policy
+    std::vector<int> c = {5, 3, 4, 1, 2, 8, 7};
+    std::make_heap(c.begin(), c.end() - 2);
+    hpx::experimental::push_heap_n(c.begin(), c.end(), 2);
+    HPX_TEST(std::is_heap(c.begin(), c.end()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    push_heap_n_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
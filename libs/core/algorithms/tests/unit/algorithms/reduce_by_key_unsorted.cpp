@@ -0,0 +1,274 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce_by_key_unsorted.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t test_size = 100007;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value>
+std::map<Key, Value> make_map(std::vector<Key> const& keys,
+    std::vector<Value> const& values, std::size_t count)
+{
+    std::map<Key, Value> result;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        result.emplace(keys[i], values[i]);
+    }
+    HPX_TEST_EQ(result.size(), count);
+    return result;
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted(ExPolicy&& policy, std::size_t num_keys)
+{
+    std::uniform_int_distribution<int> key_dist(
+        0, static_cast<int>(num_keys) - 1);
+    std::uniform_int_distribution<int> value_dist(0, 99);
+
+    std::vector<int> keys(test_size);
+    std::vector<int> values(test_size);
+    std::generate(keys.begin(), keys.end(), [&]() { return key_dist(gen); });
+    std::generate(
+        values.begin(), values.end(), [&]() { return value_dist(gen); });
+
+    std::map<int, int> expected;
+    for (std::size_t i = 0; i != test_size; ++i)
+    {
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> keys_out(test_size);
+    std::vector<int> values_out(test_size);
+
+    auto result = hpx::experimental::reduce_by_key_unsorted(policy,
+        keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+        values_out.begin());
+
+    std::size_t const count =
+        static_cast<std::size_t>(std::distance(keys_out.begin(), result.in));
+    HPX_TEST_EQ(count, expected.size());
+    HPX_TEST_EQ(count,
+        static_cast<std::size_t>(
+            std::distance(values_out.begin(), result.out)));
+    HPX_TEST(make_map(keys_out, values_out, count) == expected);
+}
+
+// string concatenation is associative but not commutative, the values of
+// each key have to be combined in the order of the input sequence
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_noncommutative(ExPolicy&& policy)
+{
+    std::uniform_int_distribution<int> key_dist(0, 99);
+    std::uniform_int_distribution<int> char_dist('a', 'z');
+
+    std::vector<int> keys(test_size);
+    std::vector<std::string> values(test_size);
+    std::generate(keys.begin(), keys.end(), [&]() { return key_dist(gen); });
+    std::generate(values.begin(), values.end(),
+        [&]() { return std::string(1, static_cast<char>(char_dist(gen))); });
+
+    std::map<int, std::string> expected;
+    for (std::size_t i = 0; i != test_size; ++i)
+    {
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> keys_out(test_size);
+    std::vector<std::string> values_out(test_size);
+
+    auto result = hpx::experimental::reduce_by_key_unsorted(policy,
+        keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+        values_out.begin(), std::plus<std::string>());
+
+    std::size_t const count =
+        static_cast<std::size_t>(std::distance(keys_out.begin(), result.in));
+    HPX_TEST_EQ(count, expected.size());
+    HPX_TEST(make_map(keys_out, values_out, count) == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// user supplied hash and equality functions, keys are compared ignoring case
+struct case_insensitive_hash
+{
+    std::size_t operator()(std::string const& s) const
+    {
+        std::string lower(s);
+        std::transform(lower.begin(), lower.end(), lower.begin(),
+            [](unsigned char c) { return std::tolower(c); });
+        return std::hash<std::string>()(lower);
+    }
+};
+
+struct case_insensitive_equal
+{
+    bool operator()(std::string const& lhs, std::string const& rhs) const
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            [](unsigned char l, unsigned char r) {
+                return std::tolower(l) == std::tolower(r);
+            });
+    }
+};
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_hash(ExPolicy&& policy)
+{
+    std::vector<std::string> const names = {"error", "ERROR", "Warning",
+        "warning", "WARNING", "info", "Info", "debug"};
+    std::uniform_int_distribution<std::size_t> dist(0, names.size() - 1);
+
+    std::vector<std::string> keys(test_size);
+    std::generate(keys.begin(), keys.end(), [&]() { return names[dist(gen)]; });
+    std::vector<std::size_t> values(test_size, 1);
+
+    std::vector<std::string> keys_out(test_size);
+    std::vector<std::size_t> values_out(test_size);
+
+    auto result = hpx::experimental::reduce_by_key_unsorted(policy,
+        keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+        values_out.begin(), std::plus<>(), case_insensitive_hash(),
+        case_insensitive_equal());
+
+    std::size_t const count =
+        static_cast<std::size_t>(std::distance(keys_out.begin(), result.in));
+    HPX_TEST_EQ(count, std::size_t(4));
+
+    std::map<std::string, std::size_t> counts;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        std::string key = keys_out[i];
+        std::transform(key.begin(), key.end(), key.begin(),
+            [](unsigned char c) { return std::tolower(c); });
+        counts[key] += values_out[i];
+    }
+
+    HPX_TEST_EQ(counts.size(), std::size_t(4));
+    HPX_TEST_EQ(counts["error"] + counts["warning"] + counts["info"] +
+            counts["debug"],
+        test_size);
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_empty(ExPolicy&& policy)
+{
+    std::vector<int> keys;
+    std::vector<int> values;
+    std::vector<int> keys_out(1);
+    std::vector<int> values_out(1);
+
+    auto result = hpx::experimental::reduce_by_key_unsorted(policy,
+        keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+        values_out.begin());
+
+    HPX_TEST(result.in == keys_out.begin());
+    HPX_TEST(result.out == values_out.begin());
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted(ExPolicy&& policy)
+{
+    // few distinct keys (large groups) and many distinct keys
+    test_reduce_by_key_unsorted(policy, 10);
+    test_reduce_by_key_unsorted(policy, 10000);
+    test_reduce_by_key_unsorted(policy, test_size);
+
+    test_reduce_by_key_unsorted_noncommutative(policy);
+    test_reduce_by_key_unsorted_hash(policy);
+    test_reduce_by_key_unsorted_empty(policy);
+}
+
+void test_reduce_by_key_unsorted()
+{
+    using namespace hpx::execution;
+
+    test_reduce_by_key_unsorted(seq);
+    test_reduce_by_key_unsorted(par);
+    test_reduce_by_key_unsorted(par_unseq);
+
+    // asynchronous execution
+    {
+        std::vector<int> keys(test_size);
+        std::vector<int> values(test_size, 1);
+        for (std::size_t i = 0; i != test_size; ++i)
+        {
+            keys[i] = static_cast<int>(i % 7);
+        }
+
+        std::vector<int> keys_out(test_size);
+        std::vector<int> values_out(test_size);
+
+        auto f = hpx::experimental::reduce_by_key_unsorted(par(task),
+            keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+            values_out.begin());
+        auto result = f.get();
+
+        HPX_TEST_EQ(std::distance(keys_out.begin(), result.in), 7);
+        int sum = 0;
+        for (auto it = values_out.begin(); it != result.out; ++it)
+        {
+            sum += *it;
+        }
+        HPX_TEST_EQ(sum, static_cast<int>(test_size));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_reduce_by_key_unsorted();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the scan based algorithms when using the single-pass scan (decoupled
+// look-back) selected by the single_pass_scan executor parameters.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr std::size_t test_size = 100007;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the composition of affine functions is associative but not commutative
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+
+    friend bool operator==(affine const& lhs, affine const& rhs) noexcept
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const noexcept
+    {
+        return affine{lhs.a * rhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<int> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_single_pass_scan(ExPolicy&& policy)
+{
+    std::vector<int> const data = make_data(test_size);
+    std::vector<int> result(test_size);
+    std::vector<int> expected(test_size);
+
+    // inclusive_scan
+    hpx::inclusive_scan(
+        policy, data.begin(), data.end(), result.begin(), std::plus<>(), 42);
+    std::inclusive_scan(
+        data.begin(), data.end(), expected.begin(), std::plus<>(), 42);
+    HPX_TEST(result == expected);
+
+    // exclusive_scan
+    hpx::exclusive_scan(
+        policy, data.begin(), data.end(), result.begin(), 42, std::plus<>());
+    std::exclusive_scan(
+        data.begin(), data.end(), expected.begin(), 42, std::plus<>());
+    HPX_TEST(result == expected);
+
+    // transform_inclusive_scan
+    auto conv = [](int x) { return 2 * x + 1; };
+    hpx::transform_inclusive_scan(policy, data.begin(), data.end(),
+        result.begin(), std::plus<>(), conv, 42);
+    std::transform_inclusive_scan(
+        data.begin(), data.end(), expected.begin(), std::plus<>(), conv, 42);
+    HPX_TEST(result == expected);
+
+    // transform_exclusive_scan
+    hpx::transform_exclusive_scan(policy, data.begin(), data.end(),
+        result.begin(), 42, std::plus<>(), conv);
+    std::transform_exclusive_scan(
+        data.begin(), data.end(), expected.begin(), 42, std::plus<>(), conv);
+    HPX_TEST(result == expected);
+
+    // copy_if
+    auto pred = [](int x) { return x % 3 == 0; };
+    auto r1 = hpx::copy_if(
+        policy, data.begin(), data.end(), result.begin(), pred);
+    auto e1 = std::copy_if(data.begin(), data.end(), expected.begin(), pred);
+    HPX_TEST_EQ(std::distance(result.begin(), r1),
+        std::distance(expected.begin(), e1));
+    HPX_TEST(std::equal(result.begin(), r1, expected.begin()));
+
+    // remove_copy
+    auto r2 =
+        hpx::remove_copy(policy, data.begin(), data.end(), result.begin(), 7);
+    auto e2 = std::remove_copy(data.begin(), data.end(), expected.begin(), 7);
+    HPX_TEST_EQ(std::distance(result.begin(), r2),
+        std::distance(expected.begin(), e2));
+    HPX_TEST(std::equal(result.begin(), r2, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_single_pass_scan_noncommutative(ExPolicy&& policy)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, 1000);
+
+    std::vector<affine> data(test_size);
+    std::generate(data.begin(), data.end(),
+        [&]() { return affine{dist(gen), dist(gen)}; });
+
+    std::vector<affine> result(test_size);
+    std::vector<affine> expected(test_size);
+
+    hpx::inclusive_scan(
+        policy, data.begin(), data.end(), result.begin(), compose(), affine());
+    std::inclusive_scan(
+        data.begin(), data.end(), expected.begin(), compose(), affine());
+    HPX_TEST(result == expected);
+}
+
+template <typename ExPolicy>
+void test_single_pass_scan_exception(ExPolicy&& policy)
+{
+    std::vector<int> data = make_data(test_size);
+    std::vector<int> result(test_size);
+
+    // the operation throws for a single element only
+    data[test_size / 2] = -1;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::inclusive_scan(policy, data.begin(), data.end(), result.begin(),
+            [](int lhs, int rhs) {
+                if (rhs == -1)
+                    throw std::runtime_error("test");
+                return lhs + rhs;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_single_pass_scan()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::single_pass_scan;
+
+    // default tile size
+    test_single_pass_scan(par.with(single_pass_scan()));
+    test_single_pass_scan(par_unseq.with(single_pass_scan()));
+    test_single_pass_scan(seq.with(single_pass_scan()));
+
+    // many small tiles
+    test_single_pass_scan(par.with(single_pass_scan(17)));
+    test_single_pass_scan_noncommutative(par.with(single_pass_scan(13)));
+    test_single_pass_scan_noncommutative(par.with(single_pass_scan()));
+
+    // asynchronous execution
+    {
+        std::vector<int> const data = make_data(test_size);
+        std::vector<int> result(test_size);
+        std::vector<int> expected(test_size);
+
+        auto f = hpx::inclusive_scan(par(task).with(single_pass_scan(100)),
+            data.begin(), data.end(), result.begin());
+        f.get();
+
+        std::inclusive_scan(data.begin(), data.end(), expected.begin());
+        HPX_TEST(result == expected);
+    }
+
+    test_single_pass_scan_exception(par.with(single_pass_scan(101)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_single_pass_scan();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -8,6 +8,7 @@
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
@@ -526,6 +527,43 @@ void set_symmetric_difference_bad_alloc_test()
     test_set_symmetric_difference_bad_alloc<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// many equivalent elements in both sequences, groups of those are split
+// between the parallel pieces of work
+template <typename ExPolicy>
+void test_set_symmetric_difference_duplicates(ExPolicy&& policy)
+{
+    std::vector<std::size_t> c1(100007);
+    std::vector<std::size_t> c2(54321);
+    auto gen = []() { return std::rand() % 10; };
+    std::generate(std::begin(c1), std::end(c1), gen);
+    std::generate(std::begin(c2), std::end(c2), gen);
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(c1.size() + c2.size());
+    std::vector<std::size_t> c4(c1.size() + c2.size());
+
+    auto result = hpx::set_symmetric_difference(policy, std::begin(c1),
+        std::end(c1), std::begin(c2), std::end(c2), std::begin(c3));
+    auto expected = std::set_symmetric_difference(std::begin(c1),
+        std::end(c1), std::begin(c2), std::end(c2), std::begin(c4));
+
+    HPX_TEST_EQ(std::distance(std::begin(c3), result),
+        std::distance(std::begin(c4), expected));
+    HPX_TEST(std::equal(std::begin(c3), result, std::begin(c4)));
+}
+
+void set_symmetric_difference_duplicates_test()
+{
+    using namespace hpx::execution;
+
+    test_set_symmetric_difference_duplicates(seq);
+    test_set_symmetric_difference_duplicates(par);
+    test_set_symmetric_difference_duplicates(par_unseq);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -540,6 +578,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     set_symmetric_difference_test2();
     set_symmetric_difference_exception_test();
     set_symmetric_difference_bad_alloc_test();
+    set_symmetric_difference_duplicates_test();
     return hpx::local::finalize();
 }
 
@@ -7,8 +7,10 @@
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -145,6 +147,107 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// user defined records are sorted using the quick sort, large ranges are
+// partitioned in parallel
+struct record
+{
+    int key;
+    std::size_t index;
+};
+
+template <typename ExPolicy>
+void test_sort3(ExPolicy&& policy, int num_keys,
+    std::size_t size = HPX_SORT_TEST_SIZE)
+{
+    std::vector<record> c(size);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = record{std::rand() % num_keys, i};
+    }
+
+    auto comp = [](record const& lhs, record const& rhs) {
+        return lhs.key < rhs.key;
+    };
+
+    hpx::sort(policy, c.begin(), c.end(), comp);
+
+    HPX_TEST(std::is_sorted(c.begin(), c.end(), comp));
+
+    // all records are still there
+    std::vector<bool> found(c.size(), false);
+    for (record const& r : c)
+    {
+        HPX_TEST(!found[r.index]);
+        found[r.index] = true;
+    }
+}
+
+void test_sort3()
+{
+    using namespace hpx::execution;
+
+    test_sort3(par, RAND_MAX);
+    test_sort3(par_unseq, RAND_MAX);
+
+    // many duplicate keys
+    test_sort3(par, 2);
+    test_sort3(par, 16);
+    test_sort3(par_unseq, 1000);
+
+    // large enough to be partitioned in parallel in every build type
+    test_sort3(par, 16,
+        2 * hpx::parallel::detail::sort_parallel_partition_limit + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the parallel partitioning step is tested directly as well, it is used only
+// for ranges which are too large for debug builds otherwise
+void test_sort_parallel_partition(int num_keys, int pivot_key)
+{
+    std::vector<record> c(HPX_SORT_TEST_SIZE);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = record{std::rand() % num_keys, i};
+    }
+    c[0].key = pivot_key;
+
+    auto comp = [](record const& lhs, record const& rhs) {
+        return lhs.key < rhs.key;
+    };
+
+    auto policy = hpx::execution::par;
+    auto [pivot, equal_last] = hpx::parallel::detail::sort_parallel_partition(
+        policy, c.begin(), c.end(), comp);
+
+    HPX_TEST(pivot->key == pivot_key);
+    HPX_TEST(pivot < equal_last);
+    HPX_TEST(std::all_of(c.begin(), pivot,
+        [&](record const& r) { return r.key < pivot_key; }));
+    HPX_TEST(std::all_of(pivot, equal_last,
+        [&](record const& r) { return r.key == pivot_key; }));
+    HPX_TEST(std::all_of(equal_last, c.end(),
+        [&](record const& r) { return r.key >= pivot_key; }));
+
+    // all records are still there
+    std::vector<bool> found(c.size(), false);
+    for (record const& r : c)
+    {
+        HPX_TEST(!found[r.index]);
+        found[r.index] = true;
+    }
+}
+
+void test_sort_parallel_partition()
+{
+    test_sort_parallel_partition(RAND_MAX, RAND_MAX / 2);
+    test_sort_parallel_partition(16, 8);
+
+    // small left partition, elements equal to the pivot are separated
+    test_sort_parallel_partition(2, 0);
+    test_sort_parallel_partition(1000, 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -157,6 +260,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
+    test_sort_parallel_partition();
     sort_benchmark();
 
     return hpx::local::finalize();
@@ -0,0 +1,233 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the radix sort used by hpx::sort, hpx::stable_sort, and
+// hpx::experimental::sort_by_key for large ranges of arithmetic keys.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// large enough to be handled by the radix sort
+constexpr std::size_t test_size = 3 * 65536 + 17;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1.0e6), T(1.0e6));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+        // special values
+        data[0] = std::numeric_limits<T>::lowest();
+        data[1] = (std::numeric_limits<T>::max)();
+        data[2] = T(-0.0);
+        data[3] = T(0.0);
+        data[4] = std::numeric_limits<T>::denorm_min();
+        data[5] = -std::numeric_limits<T>::denorm_min();
+        data[6] = std::numeric_limits<T>::infinity();
+        data[7] = -std::numeric_limits<T>::infinity();
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+        data[0] = (std::numeric_limits<T>::min)();
+        data[1] = (std::numeric_limits<T>::max)();
+        data[2] = T(0);
+    }
+    std::shuffle(data.begin(), data.end(), gen);
+    return data;
+}
+
+template <typename T, typename ExPolicy, typename Comp>
+void test_sort(ExPolicy&& policy, Comp comp)
+{
+    std::vector<T> data = make_data<T>(test_size);
+    std::vector<T> expected = data;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, data.begin(), data.end(), comp);
+    HPX_TEST(data == expected);
+
+    // keys spanning only the lowest byte
+    std::uniform_int_distribution<int> dist(0, 100);
+    std::generate(data.begin(), data.end(), [&]() { return T(dist(gen)); });
+    expected = data;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, data.begin(), data.end(), comp);
+    HPX_TEST(data == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_sort(ExPolicy&& policy)
+{
+    test_sort<T>(policy, hpx::parallel::detail::less());
+    test_sort<T>(policy, std::less<T>());
+    test_sort<T>(policy, std::greater<>());
+
+    // default comparison function
+    std::vector<T> data = make_data<T>(test_size);
+    hpx::sort(policy, data.begin(), data.end());
+    HPX_TEST(std::is_sorted(data.begin(), data.end()));
+
+    data = make_data<T>(test_size);
+    hpx::ranges::sort(policy, data);
+    HPX_TEST(std::is_sorted(data.begin(), data.end()));
+}
+
+template <typename T>
+void test_sort()
+{
+    using namespace hpx::execution;
+
+    test_sort<T>(par);
+    test_sort<T>(par_unseq);
+
+    std::vector<T> data = make_data<T>(test_size);
+    hpx::sort(par(task), data.begin(), data.end()).get();
+    HPX_TEST(std::is_sorted(data.begin(), data.end()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// -0.0 and 0.0 compare equal, stable_sort has to keep their relative order
+void test_stable_sort_signed_zero()
+{
+    std::vector<double> data(test_size);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = (i % 3 == 0) ? -0.0 : ((i % 3 == 1) ? 0.0 : -1.0);
+    }
+    std::vector<double> expected = data;
+    std::stable_sort(expected.begin(), expected.end());
+
+    hpx::stable_sort(hpx::execution::par, data.begin(), data.end());
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        HPX_TEST_EQ(data[i], expected[i]);
+        HPX_TEST_EQ(std::signbit(data[i]), std::signbit(expected[i]));
+    }
+}
+
+void test_stable_sort()
+{
+    std::uniform_int_distribution<std::int32_t> dist(-1000, 1000);
+
+    std::vector<std::int32_t> keys(test_size);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+
+    std::vector<std::int32_t> sorted_keys = keys;
+    hpx::stable_sort(hpx::execution::par, sorted_keys.begin(),
+        sorted_keys.end(), std::greater<std::int32_t>());
+
+    std::vector<std::int32_t> expected = keys;
+    std::stable_sort(
+        expected.begin(), expected.end(), std::greater<std::int32_t>());
+    HPX_TEST(sorted_keys == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key>
+void test_sort_by_key()
+{
+    std::vector<Key> keys = make_data<Key>(test_size);
+    std::vector<std::size_t> values(test_size);
+    std::iota(values.begin(), values.end(), std::size_t(0));
+
+    std::vector<Key> const orig_keys = keys;
+
+    hpx::experimental::sort_by_key(
+        hpx::execution::par, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != test_size; ++i)
+    {
+        // each value still refers to its key
+        HPX_TEST_EQ(orig_keys[values[i]], keys[i]);
+
+        // equal keys are kept in their original order
+        if (i != 0 && keys[i - 1] == keys[i])
+        {
+            HPX_TEST_LT(values[i - 1], values[i]);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        gen.seed(seed);
+    }
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_sort<std::int16_t>();
+    test_sort<std::uint16_t>();
+    test_sort<int>();
+    test_sort<unsigned int>();
+    test_sort<std::int64_t>();
+    test_sort<std::uint64_t>();
+    test_sort<float>();
+    test_sort<double>();
+
+    test_stable_sort_signed_zero();
+    test_stable_sort();
+
+    test_sort_by_key<int>();
+    test_sort_by_key<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen(std::random_device{}());
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_exclusive_scan(ExPolicy&& policy, T)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    // sizes which do not fill the last vector pack
+    for (std::size_t size : {std::size_t(1), std::size_t(17),
+             std::size_t(10007), std::size_t(1000003)})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = static_cast<T>(dis(gen));
+
+        // the operation is applied to scalars and to vector packs
+        auto op = [](auto const& v1, auto const& v2) { return v1 + v2; };
+
+        std::vector<T> d(size);
+        hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), T(1), op);
+
+        std::vector<T> expected(size);
+        hpx::parallel::detail::sequential_exclusive_scan(
+            c.begin(), c.end(), expected.begin(), T(1), op);
+        HPX_TEST(d == expected);
+    }
+}
+
+// The scan algorithms require the operation to be associative only. Taking
+// the left or the right operand is not commutative, any reordering of the
+// elements shows in the result.
+template <typename ExPolicy, typename T, typename Op>
+void test_exclusive_scan_noncommutative(ExPolicy&& policy, T, Op op)
+{
+    for (std::size_t size : {std::size_t(17), std::size_t(10007),
+             std::size_t(1000003)})
+    {
+        std::vector<T> c(size);
+        std::iota(c.begin(), c.end(), T(1));
+
+        std::vector<T> d(size);
+        hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), T(0), op);
+
+        std::vector<T> expected(size);
+        hpx::parallel::detail::sequential_exclusive_scan(
+            c.begin(), c.end(), expected.begin(), T(0), op);
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_exclusive_scan_noncommutative(ExPolicy&& policy, T)
+{
+    test_exclusive_scan_noncommutative(
+        policy, T(), [](auto const& v1, auto const&) { return v1; });
+    test_exclusive_scan_noncommutative(
+        policy, T(), [](auto const&, auto const& v2) { return v2; });
+}
+
+template <typename ExPolicy, typename T>
+void test_exclusive_scan_async(ExPolicy&& policy, T)
+{
+    std::vector<T> c(10007);
+    std::iota(c.begin(), c.end(), T(0));
+
+    auto op = [](auto const& v1, auto const& v2) { return v1 + v2; };
+
+    std::vector<T> d(c.size());
+    auto f = hpx::exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), T(0), op);
+    f.wait();
+
+    std::vector<T> expected(c.size());
+    hpx::parallel::detail::sequential_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), T(0), op);
+    HPX_TEST(d == expected);
+}
+
+template <typename T>
+void test_exclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_exclusive_scan(simd, T());
+    test_exclusive_scan(par_simd, T());
+
+    test_exclusive_scan_noncommutative(simd, T());
+    test_exclusive_scan_noncommutative(par_simd, T());
+
+    test_exclusive_scan_async(simd(task), T());
+    test_exclusive_scan_async(par_simd(task), T());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_exclusive_scan<int>();
+    test_exclusive_scan<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
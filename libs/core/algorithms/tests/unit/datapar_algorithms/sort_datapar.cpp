@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen(std::random_device{}());
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename Comp>
+void test_sort(ExPolicy&& policy, T, Comp comp)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+
+    // sizes which do not fill the last tile, small sizes are sorted without
+    // the sorting networks, large sizes are sorted using the radix sort
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(17),
+             std::size_t(1000), std::size_t(10007), std::size_t(65535),
+             std::size_t(100003)})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+            v = static_cast<T>(dis(gen));
+
+        std::vector<T> expected = c;
+        std::sort(expected.begin(), expected.end(), comp);
+
+        hpx::sort(policy, c.begin(), c.end(), comp);
+        HPX_TEST(c == expected);
+    }
+}
+
+template <typename T>
+void test_sort()
+{
+    using namespace hpx::execution;
+
+    test_sort(simd, T(), std::less<T>());
+    test_sort(par_simd, T(), std::less<T>());
+
+    test_sort(simd, T(), std::greater<T>());
+    test_sort(par_simd, T(), std::greater<T>());
+
+    // the comparison function is not known to compare the keys directly
+    test_sort(simd, T(), [](T lhs, T rhs) { return lhs < rhs; });
+    test_sort(par_simd, T(), [](T lhs, T rhs) { return lhs > rhs; });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort<int>();
+    test_sort<unsigned int>();
+    test_sort<float>();
+    test_sort<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
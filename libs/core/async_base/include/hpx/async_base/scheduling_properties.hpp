@@ -12,7 +12,10 @@
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace hpx::execution::experimental {
 
@@ -118,6 +121,54 @@ namespace hpx::execution::experimental {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Run the tasks created through the given target without a stack of their
+    // own, i.e. inline on the stack of the scheduling loop of the worker
+    // thread executing them. This avoids allocating a stack and switching
+    // contexts, which pays off for short leaf tasks that never block. Such
+    // tasks may yield (which turns into a no-op) but must not suspend, an
+    // attempt to do so throws hpx::error::invalid_status.
+    //
+    // This is implemented in terms of with_stacksize/get_stacksize for all
+    // targets supporting those (it is intentionally not a scheduling property
+    // on its own). With stackless == false the target's stack size is reset
+    // to default_ if it was set to nostack before.
+    inline constexpr struct with_stackless_t final
+      : hpx::functional::detail::tag_fallback<with_stackless_t>
+    {
+    private:
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr auto tag_fallback_invoke(
+            with_stackless_t, Target&& target, bool stackless = true)
+            -> decltype(with_stacksize(HPX_FORWARD(Target, target),
+                hpx::threads::thread_stacksize::nostack))
+        {
+            hpx::threads::thread_stacksize stacksize =
+                hpx::threads::thread_stacksize::nostack;
+            if (!stackless)
+            {
+                stacksize = get_stacksize(target);
+                if (stacksize == hpx::threads::thread_stacksize::nostack)
+                    stacksize = hpx::threads::thread_stacksize::default_;
+            }
+            return with_stacksize(HPX_FORWARD(Target, target), stacksize);
+        }
+    } with_stackless{};
+
+    inline constexpr struct get_stackless_t final
+      : hpx::functional::detail::tag_fallback<get_stackless_t>
+    {
+    private:
+        // tasks are stackless if they are run with thread_stacksize::nostack
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr bool tag_fallback_invoke(
+            get_stackless_t, Target&& target) noexcept
+        {
+            return get_stacksize(target) ==
+                hpx::threads::thread_stacksize::nostack;
+        }
+    } get_stackless{};
+
     ///////////////////////////////////////////////////////////////////////////
     inline constexpr struct with_hint_t final
       : detail::property_base<with_hint_t>
@@ -147,6 +198,39 @@ namespace hpx::execution::experimental {
     {
     };
 
+    // Attach a critical-path hint to the tasks created through the given
+    // target (see thread_schedule_hint::criticality).
+    //
+    // This is implemented in terms of with_hint/get_hint for all targets
+    // supporting those.
+    inline constexpr struct with_criticality_t final
+      : hpx::functional::detail::tag_fallback<with_criticality_t>
+    {
+    private:
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr auto tag_fallback_invoke(
+            with_criticality_t, Target&& target, std::uint16_t criticality)
+            -> decltype(with_hint(HPX_FORWARD(Target, target),
+                std::declval<hpx::threads::thread_schedule_hint>()))
+        {
+            hpx::threads::thread_schedule_hint hint = get_hint(target);
+            hint.criticality = criticality;
+            return with_hint(HPX_FORWARD(Target, target), hint);
+        }
+    } with_criticality{};
+
+    inline constexpr struct get_criticality_t final
+      : hpx::functional::detail::tag_fallback<get_criticality_t>
+    {
+    private:
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr std::uint16_t tag_fallback_invoke(
+            get_criticality_t, Target&& target) noexcept
+        {
+            return get_hint(target).criticality;
+        }
+    } get_criticality{};
+
     ///////////////////////////////////////////////////////////////////////////
     inline constexpr struct with_annotation_t final
       : detail::property_base<with_annotation_t>
@@ -176,6 +260,78 @@ namespace hpx::execution::experimental {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes the memory accessed by bulk work created through a target.
+    // The i-th out of n work items is assumed to access the memory around
+    // the address first + i * (last - first) / n. Targets supporting this
+    // property use the NUMA domains the pages of that memory are placed on
+    // to run each work item on a worker thread close to its data.
+    struct data_placement_hint
+    {
+        constexpr data_placement_hint() noexcept = default;
+
+        constexpr data_placement_hint(
+            void const* first, void const* last) noexcept
+          : first(first)
+          , last(last)
+        {
+        }
+
+        template <typename T>
+        constexpr data_placement_hint(
+            T const* first, std::size_t count) noexcept
+          : first(first)
+          , last(first + count)
+        {
+        }
+
+        // any contiguous range, e.g. a std::vector using a
+        // numa_binding_allocator
+        template <typename Range,
+            typename = decltype(std::data(std::declval<Range const&>()) +
+                std::size(std::declval<Range const&>()))>
+        explicit constexpr data_placement_hint(Range const& rng) noexcept
+          : data_placement_hint(std::data(rng), std::size(rng))
+        {
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return first == nullptr || first >= last;
+        }
+
+        void const* first = nullptr;
+        void const* last = nullptr;
+    };
+
+    inline constexpr struct with_data_placement_t final
+      : detail::property_base<with_data_placement_t>
+    {
+    } with_data_placement{};
+
+    template <>
+    struct is_scheduling_property<with_data_placement_t> : std::true_type
+    {
+    };
+
+    inline constexpr struct get_data_placement_t final
+      : hpx::functional::detail::tag_fallback<get_data_placement_t>
+    {
+    private:
+        // simply return an empty hint if get_data_placement is not supported
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr data_placement_hint
+        tag_fallback_invoke(get_data_placement_t, Target&&) noexcept
+        {
+            return {};
+        }
+    } get_data_placement{};
+
+    template <>
+    struct is_scheduling_property<get_data_placement_t> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     inline constexpr struct with_first_core_t final
       : detail::property_base<with_first_core_t>
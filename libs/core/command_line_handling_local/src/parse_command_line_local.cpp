@@ -559,6 +559,7 @@ namespace hpx::local::detail {
             ("hpx:queuing", value<argument_string>(),
                 "the queue scheduling policy to use, options are "
                 "'local', 'local-priority-fifo','local-priority-lifo', "
+                "'local-priority-chase-lev', 'local-priority-critical-path', "
                 "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
                 "'static-priority', 'local-workrequesting-fifo',"
                 "'local-workrequesting-lifo', and 'local-workrequesting-mc' "
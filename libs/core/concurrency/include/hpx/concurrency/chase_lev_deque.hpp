@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace hpx::lockfree {
+
+    /// \brief A bounded work-stealing deque (Chase and Lev, SPAA'05).
+    ///
+    /// The deque is owned by a single thread which is the only one allowed to
+    /// call \a push and \a pop. Those operate on the 'bottom' end of the
+    /// deque and do not need any atomic read-modify-write operations except
+    /// when racing for the last remaining element. Any number of other
+    /// threads may concurrently call \a steal, which removes elements from
+    /// the 'top' end using a single CAS.
+    ///
+    /// The memory orderings follow N.M. Le et al., "Correct and Efficient
+    /// Work-Stealing for Weak Memory Models", PPoPP'13.
+    ///
+    /// The ring buffer has a fixed capacity (rounded up to the next power of
+    /// two), \a push returns false if the deque is full. Callers are expected
+    /// to provide their own overflow storage.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "chase_lev_deque requires trivially copyable elements");
+
+        static constexpr std::int64_t round_up_to_power_of_two(
+            std::size_t size) noexcept
+        {
+            std::int64_t result = 2;
+            while (result < static_cast<std::int64_t>(size))
+                result <<= 1;
+            return result;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t capacity = 1024)
+          : capacity_(round_up_to_power_of_two(capacity))
+          , mask_(capacity_ - 1)
+          , buffer_(new std::atomic<T>[static_cast<std::size_t>(capacity_)])
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        // Add an element at the bottom end, may be called by the owner only.
+        // Returns false if the deque is full.
+        bool push(T val) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+
+            if (b - t >= capacity_)
+                return false;
+
+            buffer_[b & mask_].store(val, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Remove an element from the bottom end, may be called by the owner
+        // only.
+        bool pop(T& val) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = buffer_[b & mask_].load(std::memory_order_relaxed);
+            if (t != b)
+                return true;    // more than one element left
+
+            // last element, race against concurrent steals
+            bool const result = top_.data_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+
+        // Remove an element from the top end, may be called concurrently by
+        // any thread.
+        bool steal(T& val) noexcept
+        {
+            while (true)
+            {
+                std::int64_t t = top_.data_.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t const b =
+                    bottom_.data_.load(std::memory_order_acquire);
+
+                if (t >= b)
+                    return false;
+
+                T const item =
+                    buffer_[t & mask_].load(std::memory_order_relaxed);
+                if (top_.data_.compare_exchange_strong(t, t + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    val = item;
+                    return true;
+                }
+
+                // lost the race against another thief or the owner, retry
+                // with freshly loaded indices
+            }
+        }
+
+        bool empty() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        constexpr std::size_t capacity() const noexcept
+        {
+            return static_cast<std::size_t>(capacity_);
+        }
+
+    private:
+        // the owner and the thieves contend on different cache lines
+        hpx::util::cache_aligned_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_aligned_data<std::atomic<std::int64_t>> bottom_;
+
+        std::int64_t const capacity_;
+        std::int64_t const mask_;
+        std::unique_ptr<std::atomic<T>[]> buffer_;
+    };
+}    // namespace hpx::lockfree
@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/barrier.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+void test_basic()
+{
+    {
+        // A default constructed deque should be empty.
+        hpx::lockfree::chase_lev_deque<std::uint64_t> q;
+
+        std::uint64_t val = 0;
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop(val));
+        HPX_TEST(!q.steal(val));
+    }
+
+    {
+        // The capacity is rounded up to the next power of two and pushing to
+        // a full deque fails.
+        hpx::lockfree::chase_lev_deque<std::uint64_t> q(5);
+        HPX_TEST_EQ(q.capacity(), std::size_t(8));
+
+        for (std::uint64_t i = 0; i != 8; ++i)
+        {
+            HPX_TEST(q.push(i));
+        }
+        HPX_TEST(!q.push(8));
+        HPX_TEST_EQ(q.size(), std::size_t(8));
+
+        // The owner pops in LIFO order, thieves steal in FIFO order.
+        std::uint64_t val = 0;
+        HPX_TEST(q.pop(val));
+        HPX_TEST_EQ(val, std::uint64_t(7));
+        HPX_TEST(q.steal(val));
+        HPX_TEST_EQ(val, std::uint64_t(0));
+
+        // Freed slots can be reused after wrapping around.
+        HPX_TEST(q.push(42));
+        HPX_TEST(q.push(43));
+        HPX_TEST(!q.push(44));
+
+        HPX_TEST(q.pop(val));
+        HPX_TEST_EQ(val, std::uint64_t(43));
+        HPX_TEST(q.pop(val));
+        HPX_TEST_EQ(val, std::uint64_t(42));
+
+        for (std::uint64_t i = 1; i != 7; ++i)
+        {
+            HPX_TEST(q.steal(val));
+            HPX_TEST_EQ(val, i);
+        }
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop(val));
+        HPX_TEST(!q.steal(val));
+    }
+}
+
+void test_concurrent_thief(std::shared_ptr<hpx::barrier<>> b,
+    hpx::lockfree::chase_lev_deque<std::uint64_t>& q,
+    std::atomic<bool>& done, std::vector<std::uint64_t>& stolen)
+{
+    b->arrive_and_wait();
+
+    std::uint64_t val = 0;
+    while (!done.load(std::memory_order_acquire) || !q.empty())
+    {
+        if (q.steal(val))
+        {
+            stolen.push_back(val);
+        }
+    }
+}
+
+void test_concurrent()
+{
+    constexpr std::uint64_t num_items = 1000000;
+    hpx::lockfree::chase_lev_deque<std::uint64_t> q(256);
+
+    std::size_t const num_thieves = hpx::get_num_worker_threads() - 1;
+
+    // This test should be run on at least two worker threads.
+    HPX_TEST_LTE(std::size_t(1), num_thieves);
+
+    std::atomic<bool> done(false);
+    std::vector<std::vector<std::uint64_t>> stolen(num_thieves);
+    std::shared_ptr<hpx::barrier<>> b =
+        std::make_shared<hpx::barrier<>>(num_thieves + 1);
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(num_thieves);
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        fs.push_back(hpx::async(test_concurrent_thief, b, std::ref(q),
+            std::ref(done), std::ref(stolen[i])));
+    }
+
+    b->arrive_and_wait();
+
+    // The owner keeps pushing and occasionally pops its own items.
+    std::vector<std::uint64_t> popped;
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != num_items; ++i)
+    {
+        while (!q.push(i))
+        {
+            if (q.pop(val))
+            {
+                popped.push_back(val);
+            }
+        }
+
+        if (i % 3 == 0 && q.pop(val))
+        {
+            popped.push_back(val);
+        }
+    }
+
+    while (q.pop(val))
+    {
+        popped.push_back(val);
+    }
+    done.store(true, std::memory_order_release);
+
+    hpx::wait_all(fs);
+
+    HPX_TEST(q.empty());
+
+    // All items should have been removed from the deque exactly once.
+    std::vector<std::uint64_t> all = HPX_MOVE(popped);
+    for (auto const& s : stolen)
+    {
+        std::copy(s.begin(), s.end(), std::back_inserter(all));
+    }
+
+    HPX_TEST_EQ(all.size(), static_cast<std::size_t>(num_items));
+    std::sort(all.begin(), all.end());
+    for (std::uint64_t i = 0; i != all.size(); ++i)
+    {
+        HPX_TEST_EQ(all[i], i);
+    }
+}
+
+int hpx_main()
+{
+    test_basic();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init(hpx_main, argc, argv);
+    return hpx::util::report_errors();
+}
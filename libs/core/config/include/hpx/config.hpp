@@ -394,6 +394,13 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of recycled threads (per stack size) a thread queue keeps for
+// later reuse. Surplus threads are destroyed in batches (0: no limit).
+#if !defined(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+#  define HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
@@ -401,6 +408,13 @@
 #  define HPX_IDLE_BACKOFF_TIME_MAX 1000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Number of times an idle scheduler thread yields its core before it is parked
+// (used only if HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
+#if !defined(HPX_IDLE_BACKOFF_YIELD_COUNT)
+#  define HPX_IDLE_BACKOFF_YIELD_COUNT 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_WRAPPER_HEAP_STEP)
 #  define HPX_WRAPPER_HEAP_STEP 0xFFFFU
@@ -111,12 +111,13 @@ namespace hpx::threads::coroutines {
                 return static_cast<char*>(limit) + size;
             }
 
-            static void deallocate(void* vp, std::size_t size) noexcept
+            static void deallocate(void* vp, std::size_t size,
+                [[maybe_unused]] std::size_t resident) noexcept
             {
                 HPX_ASSERT(vp);
                 void* limit = static_cast<char*>(vp) - size;
 #if defined(HPX_USE_POSIX_STACK_UTILITIES)
-                posix::free_stack(limit, size);
+                posix::free_stack(limit, size, resident);
 #else
                 std::free(limit);
 #endif
@@ -159,7 +160,8 @@ namespace hpx::threads::coroutines {
                 return static_cast<char*>(limit) + size;
             }
 
-            void deallocate(void* vp, std::size_t size) const noexcept
+            void deallocate(
+                void* vp, std::size_t size, std::size_t) const noexcept
             {
                 __splitstack_releasecontext(segments_ctx_);
             }
@@ -229,7 +231,8 @@ namespace hpx::threads::coroutines {
             {
                 if (ctx_ && stack_pointer_)
                 {
-                    alloc_.deallocate(stack_pointer_, stack_size_);
+                    alloc_.deallocate(
+                        stack_pointer_, stack_size_, stack_resident_);
                 }
             }
 
@@ -262,7 +265,8 @@ namespace hpx::threads::coroutines {
 #if defined(HPX_USE_POSIX_STACK_UTILITIES)
                     void* limit =
                         static_cast<char*>(stack_pointer_) - stack_size_;
-                    if (posix::reset_stack(limit, stack_size_))
+                    if (posix::reset_stack(
+                            limit, stack_size_, stack_resident_))
                     {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                         increment_stack_unbind_count();
@@ -351,6 +355,7 @@ namespace hpx::threads::coroutines {
             stack_allocator alloc_;
             std::size_t stack_size_;
             void* stack_pointer_;
+            std::size_t stack_resident_ = 0;
         };
     }    // namespace detail::generic_context
 }    // namespace hpx::threads::coroutines
@@ -359,8 +359,8 @@ namespace hpx::threads::coroutines::detail::lx {
                 VALGRIND_STACK_DEREGISTER(
                     reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                posix::free_stack(
-                    m_stack, static_cast<std::size_t>(m_stack_size));
+                posix::free_stack(m_stack,
+                    static_cast<std::size_t>(m_stack_size), m_stack_resident);
             }
         }
 
@@ -376,8 +376,8 @@ namespace hpx::threads::coroutines::detail::lx {
                 return;
 
             HPX_ASSERT(m_stack);
-            if (posix::reset_stack(
-                    m_stack, static_cast<std::size_t>(m_stack_size)))
+            if (posix::reset_stack(m_stack,
+                    static_cast<std::size_t>(m_stack_size), m_stack_resident))
             {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                 increment_stack_unbind_count();
@@ -454,6 +454,16 @@ namespace hpx::threads::coroutines::detail::lx {
             return util::get_and_reset_value(
                 get_stack_recycle_counter(), reset);
         }
+
+        static std::uint64_t get_stack_page_fault_count(bool reset) noexcept
+        {
+            return posix::get_stack_page_fault_count(reset);
+        }
+
+        static std::uint64_t get_stack_resident_bytes(bool reset) noexcept
+        {
+            return posix::get_stack_resident_bytes(reset);
+        }
 #endif
 
         friend void swap_context(x86_linux_context_impl_base& from,
@@ -531,6 +541,7 @@ namespace hpx::threads::coroutines::detail::lx {
 
         std::ptrdiff_t m_stack_size;
         void* m_stack;
+        std::size_t m_stack_resident = 0;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
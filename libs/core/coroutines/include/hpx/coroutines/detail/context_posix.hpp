@@ -332,7 +332,7 @@ namespace hpx::threads::coroutines {
             ~ucontext_context_impl()
             {
                 if (m_stack)
-                    free_stack(m_stack, m_stack_size);
+                    free_stack(m_stack, m_stack_size, m_stack_resident);
             }
 
             // Return the size of the reserved stack address space.
@@ -359,8 +359,9 @@ namespace hpx::threads::coroutines {
 
                 if (m_stack)
                 {
-                    if (posix::reset_stack(
-                            m_stack, static_cast<std::size_t>(m_stack_size)))
+                    if (posix::reset_stack(m_stack,
+                            static_cast<std::size_t>(m_stack_size),
+                            m_stack_resident))
                     {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
                         increment_stack_unbind_count();
@@ -423,12 +424,24 @@ namespace hpx::threads::coroutines {
                 return util::get_and_reset_value(
                     get_stack_recycle_counter(), reset);
             }
+
+            static std::uint64_t get_stack_page_fault_count(
+                bool reset) noexcept
+            {
+                return posix::get_stack_page_fault_count(reset);
+            }
+
+            static std::uint64_t get_stack_resident_bytes(bool reset) noexcept
+            {
+                return posix::get_stack_resident_bytes(reset);
+            }
 #endif
 
         private:
             // declare m_stack_size first so we can use it to initialize m_stack
             std::ptrdiff_t m_stack_size;
             void* m_stack;
+            std::size_t m_stack_resident = 0;
             void (*funp_)(void*);
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
@@ -11,6 +11,7 @@
 #include <hpx/coroutines/detail/coroutine_self.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/modules/errors.hpp>
 
 #include <cstddef>
 #include <limits>
@@ -33,11 +34,25 @@ namespace hpx::threads::coroutines::detail {
             HPX_ASSERT(pimpl_);
         }
 
-        arg_type yield_impl(result_type) override
-        {
-            // stackless coroutines don't support suspension
-            HPX_ASSERT(false);
-            return threads::thread_restart_state::abort;
+        arg_type yield_impl(result_type arg) override
+        {
+            // Stackless coroutines run on the stack of the scheduling loop,
+            // yielding without suspending is a no-op as there is nothing to
+            // switch to.
+            if (arg.first == thread_schedule_state::pending ||
+                arg.first == thread_schedule_state::pending_boost)
+            {
+                return threads::thread_restart_state::signaled;
+            }
+
+            // Stackless coroutines don't support suspension. The frame of the
+            // running thread lives on the stack of the scheduling loop and
+            // can't be moved to a coroutine stack, and silently continuing
+            // would make the caller believe it was woken up.
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "coroutine_stackless_self::yield_impl",
+                "stackless threads can't be suspended, use a stackful thread "
+                "(executor) instead");
         }
 
         thread_id_type get_thread_id() const noexcept override
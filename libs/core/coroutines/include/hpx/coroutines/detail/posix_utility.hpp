@@ -46,8 +46,10 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
+#include <string>
 
 #if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
 #include <errno.h>
@@ -78,11 +80,64 @@ namespace hpx::threads::coroutines::detail::posix {
 
     HPX_CORE_EXPORT extern bool use_guard_pages;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Policy deciding what happens to the pages of a stack that was used
+    // beyond its first page once the owning coroutine is recycled:
+    //
+    //  - dontneed:  release the pages immediately (MADV_DONTNEED), the next
+    //               use of the stack will page fault them in again
+    //  - free:      mark the pages as lazily reclaimable (MADV_FREE, falls
+    //               back to MADV_DONTNEED where not supported), the kernel
+    //               releases them only under memory pressure
+    //  - watermark: keep the pages resident as long as the overall resident
+    //               size of all stacks stays below stack_resident_watermark
+    enum class stack_reclamation_policy : std::uint8_t
+    {
+        dontneed = 0,
+        free = 1,
+        watermark = 2
+    };
+
+    // carve stacks from large (optionally huge-page backed) arenas instead
+    // of mapping each stack separately
+    HPX_CORE_EXPORT extern bool use_stack_arenas;
+    HPX_CORE_EXPORT extern bool use_huge_page_stacks;
+    HPX_CORE_EXPORT extern std::size_t stack_arena_size;
+
+    HPX_CORE_EXPORT extern stack_reclamation_policy stack_reclamation;
+    HPX_CORE_EXPORT extern std::size_t stack_resident_watermark;
+
+    // Convert the value of the hpx.stacks.reclamation configuration entry.
+    HPX_CORE_EXPORT stack_reclamation_policy parse_stack_reclamation_policy(
+        std::string const& policy);
+
+    // Number of stack pages which were faulted in since the stacks were
+    // last reclaimed (estimated from the pages found resident whenever a
+    // stack is reset), and the number of bytes currently known to be
+    // resident in all stacks.
+    HPX_CORE_EXPORT std::int64_t get_stack_page_fault_count(
+        bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_stack_resident_bytes(bool reset) noexcept;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+    HPX_CORE_EXPORT void* arena_alloc_stack(std::size_t size);
+    HPX_CORE_EXPORT void arena_free_stack(void* stack, std::size_t size);
+
+    HPX_CORE_EXPORT bool reclaim_stack(
+        void* stack, std::size_t size, std::size_t& resident);
+    HPX_CORE_EXPORT void account_stack(std::int64_t bytes) noexcept;
+
     inline void* alloc_stack(std::size_t size)
     {
+        if (use_stack_arenas)
+        {
+            void* stack = arena_alloc_stack(size);
+            account_stack(EXEC_PAGESIZE);
+            return stack;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -114,6 +169,10 @@ namespace hpx::threads::coroutines::detail::posix {
             throw std::runtime_error(error_message);
         }
 
+        // the first page of each stack becomes resident right away as it
+        // holds the watermark
+        account_stack(EXEC_PAGESIZE);
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -140,7 +199,11 @@ namespace hpx::threads::coroutines::detail::posix {
         *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
     }
 
-    inline bool reset_stack(void* stack, std::size_t size)
+    // 'resident' holds the number of bytes of the given stack (beyond its
+    // first page) which were found to be resident when it was reset last.
+    // Returns whether the stack pages were given back to the system.
+    inline bool reset_stack(
+        void* stack, std::size_t size, std::size_t& resident)
     {
         void** watermark = static_cast<void**>(stack) +
             ((size - EXEC_PAGESIZE) / sizeof(void*));
@@ -149,17 +212,24 @@ namespace hpx::threads::coroutines::detail::posix {
         // page.
         if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
         {
-            // We never free up the first page, as it's initialized only when the
-            // stack is created.
-            ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
-            return true;
+            // We never free up the first page, as it's initialized only when
+            // the stack is created.
+            return reclaim_stack(stack, size, resident);
         }
 
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    inline void free_stack(void* stack, std::size_t size, std::size_t resident)
     {
+        account_stack(-static_cast<std::int64_t>(resident + EXEC_PAGESIZE));
+
+        if (use_stack_arenas)
+        {
+            arena_free_stack(stack, size);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -205,12 +275,12 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void watermark_stack(void* stack, std::size_t size) {}    // no-op
 
-    inline bool reset_stack(void* stack, std::size_t size)
+    inline bool reset_stack(void* stack, std::size_t size, std::size_t&)
     {
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    inline void free_stack(void* stack, std::size_t size, std::size_t)
     {
         delete[] static_cast<stack_aligner*>(stack);
     }
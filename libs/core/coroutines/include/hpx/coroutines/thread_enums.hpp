@@ -419,6 +419,7 @@ namespace hpx::threads {
             thread_schedule_hint const& rhs) const noexcept
         {
             return mode == rhs.mode && hint == rhs.hint &&
+                criticality == rhs.criticality &&
                 placement_mode() == rhs.placement_mode() &&
                 sharing_mode() == rhs.sharing_mode() &&
                 runs_as_child_mode() == rhs.runs_as_child_mode();
@@ -470,6 +471,12 @@ namespace hpx::threads {
         /// The mode of the scheduling hint.
         thread_schedule_hint_mode mode = thread_schedule_hint_mode::none;
 
+        /// A hint describing how critical the task is for the overall progress
+        /// of the application, e.g. the length of the longest chain of
+        /// dependent tasks waiting for it. Schedulers supporting this hint
+        /// prefer running tasks with larger values, zero means no hint.
+        std::uint16_t criticality = 0;
+
         /// The mode of the desired thread placement.
         std::uint8_t placement_mode_bits : 5;
 
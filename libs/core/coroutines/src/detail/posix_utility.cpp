@@ -11,6 +11,18 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace hpx::threads::coroutines::detail::posix {
 
@@ -18,6 +30,305 @@ namespace hpx::threads::coroutines::detail::posix {
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+    // these global variables control how stacks are allocated and what
+    // happens to their pages once a coroutine is recycled
+    bool use_stack_arenas = false;
+    bool use_huge_page_stacks = false;
+    std::size_t stack_arena_size = 0x400000;    // 4MB
+
+    stack_reclamation_policy stack_reclamation =
+        stack_reclamation_policy::dontneed;
+    std::size_t stack_resident_watermark = 0x10000000;    // 256MB
+
+    stack_reclamation_policy parse_stack_reclamation_policy(
+        std::string const& policy)
+    {
+        if (policy == "dontneed")
+            return stack_reclamation_policy::dontneed;
+        if (policy == "free")
+            return stack_reclamation_policy::free;
+        if (policy == "watermark")
+            return stack_reclamation_policy::watermark;
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "parse_stack_reclamation_policy",
+            "unknown stack reclamation policy: '{}', expected one of "
+            "'dontneed', 'free', or 'watermark'",
+            policy);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::atomic<std::int64_t> stack_page_faults(0);
+        std::atomic<std::int64_t> stack_resident_bytes(0);
+    }    // namespace
+
+    std::int64_t get_stack_page_fault_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_page_faults, reset);
+    }
+
+    // the resident size is a gauge, it can't be reset
+    std::int64_t get_stack_resident_bytes(bool) noexcept
+    {
+        return stack_resident_bytes.load(std::memory_order_relaxed);
+    }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+    void account_stack(std::int64_t bytes) noexcept
+    {
+        stack_resident_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Count the pages of the given memory region which are currently
+        // resident.
+        std::size_t count_resident_bytes(void* addr, std::size_t size) noexcept
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            using vec_type = unsigned char;
+#else
+            using vec_type = char;
+#endif
+            constexpr std::size_t chunk_pages = 256;
+            vec_type vec[chunk_pages];
+
+            std::size_t resident = 0;
+            char* p = static_cast<char*>(addr);
+            while (size != 0)
+            {
+                std::size_t const pages =
+                    (std::min) (size / EXEC_PAGESIZE, chunk_pages);
+                std::size_t const bytes = pages * EXEC_PAGESIZE;
+                if (::mincore(p, bytes, vec) != 0)
+                    break;
+
+                for (std::size_t i = 0; i != pages; ++i)
+                {
+                    if (vec[i] & 0x1)
+                        resident += EXEC_PAGESIZE;
+                }
+
+                p += bytes;
+                size -= bytes;
+            }
+            return resident;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Stacks carved from the arenas are never unmapped, freed stacks are
+        // kept in a free list per stack size and are handed out again by
+        // subsequent allocations.
+        constexpr std::size_t huge_page_size = 0x200000;    // 2MB
+
+        struct stack_arenas
+        {
+            std::mutex mtx;
+            std::unordered_map<std::size_t, std::vector<void*>> free_slots;
+        };
+
+        // intentionally leaked, stacks may be freed during static destruction
+        stack_arenas& get_stack_arenas()
+        {
+            static stack_arenas* arenas = new stack_arenas;
+            return *arenas;
+        }
+
+        std::size_t guard_page_size() noexcept
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            return use_guard_pages ? EXEC_PAGESIZE : 0;
+#else
+            return 0;
+#endif
+        }
+
+        void* map_stack_arena(std::size_t size)
+        {
+            std::size_t const alignment =
+                use_huge_page_stacks ? huge_page_size : EXEC_PAGESIZE;
+            std::size_t const mapped = size + alignment - EXEC_PAGESIZE;
+
+            void* region = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                MAP_PRIVATE | MAP_ANON,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1, 0);
+
+            if (region == MAP_FAILED)
+            {
+                throw std::runtime_error(
+                    "mmap() failed to allocate thread stack arena");
+            }
+
+            // trim the region to the requested alignment
+            auto const begin = reinterpret_cast<std::uintptr_t>(region);
+            auto const aligned = (begin + alignment - 1) & ~(alignment - 1);
+            if (aligned != begin)
+            {
+                ::munmap(region, aligned - begin);
+            }
+            if (std::size_t const tail = begin + mapped - (aligned + size);
+                tail != 0)
+            {
+                ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+            }
+
+            void* arena = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+            if (use_huge_page_stacks)
+            {
+                ::madvise(arena, size, MADV_HUGEPAGE);
+            }
+#endif
+            return arena;
+        }
+    }    // namespace
+
+    void* arena_alloc_stack(std::size_t size)
+    {
+        std::size_t const guard = guard_page_size();
+        std::size_t const slot_size = size + guard;
+
+        stack_arenas& arenas = get_stack_arenas();
+        {
+            std::lock_guard<std::mutex> l(arenas.mtx);
+            if (auto& slots = arenas.free_slots[slot_size]; !slots.empty())
+            {
+                char* slot = static_cast<char*>(slots.back());
+                slots.pop_back();
+                return slot + guard;
+            }
+        }
+
+        // carve a new arena into as many stacks as fit, rounding the arena
+        // up to a multiple of the huge page size if those are used
+        std::size_t num_slots =
+            (std::max) (stack_arena_size / slot_size, std::size_t(1));
+        if (use_huge_page_stacks)
+        {
+            std::size_t const arena_size =
+                (num_slots * slot_size + huge_page_size - 1) &
+                ~(huge_page_size - 1);
+            num_slots = arena_size / slot_size;
+        }
+
+        char* arena =
+            static_cast<char*>(map_stack_arena(num_slots * slot_size));
+
+        // Set the guard pages, note that these split huge pages, huge pages
+        // pay off mostly for large stacks or if guard pages are disabled.
+        if (guard != 0)
+        {
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                ::mprotect(arena + i * slot_size, guard, PROT_NONE);
+            }
+        }
+
+        if (num_slots > 1)
+        {
+            std::lock_guard<std::mutex> l(arenas.mtx);
+            auto& slots = arenas.free_slots[slot_size];
+            for (std::size_t i = num_slots - 1; i != 0; --i)
+            {
+                slots.push_back(arena + i * slot_size);
+            }
+        }
+
+        return arena + guard;
+    }
+
+    void arena_free_stack(void* stack, std::size_t size)
+    {
+        // drop the contents of the stack, the slot stays mapped
+        ::madvise(stack, size, MADV_DONTNEED);
+
+        std::size_t const guard = guard_page_size();
+
+        stack_arenas& arenas = get_stack_arenas();
+        std::lock_guard<std::mutex> l(arenas.mtx);
+        arenas.free_slots[size + guard].push_back(
+            static_cast<char*>(stack) - guard);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool reclaim_stack(void* stack, std::size_t size, std::size_t& resident)
+    {
+        std::size_t const body = size - EXEC_PAGESIZE;
+
+        // Measuring the resident pages costs a system call, avoid it if the
+        // result is not needed.
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        constexpr bool track_resident = true;
+#else
+        bool const track_resident =
+            stack_reclamation != stack_reclamation_policy::dontneed;
+#endif
+        if (track_resident)
+        {
+            // all pages resident now which were not resident after this
+            // stack was reset last have been faulted in since
+            std::size_t const now = count_resident_bytes(stack, body);
+            if (now > resident)
+            {
+                stack_page_faults.fetch_add(
+                    static_cast<std::int64_t>((now - resident) / EXEC_PAGESIZE),
+                    std::memory_order_relaxed);
+            }
+            account_stack(static_cast<std::int64_t>(now) -
+                static_cast<std::int64_t>(resident));
+            resident = now;
+        }
+
+        // re-arm the watermark, we come back here only if the stack grows
+        // beyond its first page again
+        watermark_stack(stack, size);
+
+        switch (stack_reclamation)
+        {
+        case stack_reclamation_policy::watermark:
+            if (static_cast<std::size_t>(stack_resident_bytes.load(
+                    std::memory_order_relaxed)) <= stack_resident_watermark)
+            {
+                // keep the pages resident for the next user of this stack
+                return false;
+            }
+            break;
+
+        case stack_reclamation_policy::free:
+#if defined(MADV_FREE)
+            // the pages stay resident until the kernel decides to reclaim
+            // them, which will be noticed next time around
+            ::madvise(stack, body, MADV_FREE);
+            return true;
+#else
+            break;
+#endif
+
+        case stack_reclamation_policy::dontneed:
+            [[fallthrough]];
+        default:
+            break;
+        }
+
+        ::madvise(stack, body, MADV_DONTNEED);
+        account_stack(-static_cast<std::int64_t>(resident));
+        resident = 0;
+
+        return true;
+    }
+#endif
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
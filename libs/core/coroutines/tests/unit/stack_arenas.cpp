@@ -0,0 +1,237 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test the allocation of coroutine stacks from arenas and the policies
+// deciding what happens to the stack pages once a coroutine is recycled.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+std::size_t const page_size = EXEC_PAGESIZE;
+
+std::size_t guard_size()
+{
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+    return posix::use_guard_pages ? page_size : 0;
+#else
+    return 0;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_arena_reuse()
+{
+    posix::use_stack_arenas = true;
+
+    std::size_t const size = 16 * page_size;
+
+    void* stack = posix::alloc_stack(size);
+    HPX_TEST(stack != nullptr);
+
+    // the stack is usable in its full size
+    std::memset(stack, 0xff, size);
+    posix::free_stack(stack, size, 0);
+
+    // a freed stack is handed out again instead of mapping a new one
+    void* reused = posix::alloc_stack(size);
+    HPX_TEST_EQ(reused, stack);
+
+    // its contents were dropped when it was freed
+    HPX_TEST_EQ(static_cast<unsigned char*>(reused)[0], 0);
+    posix::free_stack(reused, size, 0);
+
+    posix::use_stack_arenas = false;
+}
+
+void test_arena_exhaustion()
+{
+    posix::use_stack_arenas = true;
+
+    // use a stack size not used by any other test to start with an empty
+    // free list
+    std::size_t const size = 24 * page_size;
+    std::size_t const slot_size = size + guard_size();
+    std::size_t const num_slots = 4;
+
+    std::size_t const arena_size = posix::stack_arena_size;
+    posix::stack_arena_size = num_slots * slot_size;
+
+    // the first arena is carved into num_slots consecutive stacks
+    std::vector<char*> stacks;
+    for (std::size_t i = 0; i != num_slots; ++i)
+    {
+        stacks.push_back(static_cast<char*>(posix::alloc_stack(size)));
+        std::memset(stacks.back(), 0xff, size);
+    }
+
+    char* const arena_begin = stacks[0] - guard_size();
+    char* const arena_end = arena_begin + num_slots * slot_size;
+    for (std::size_t i = 0; i != num_slots; ++i)
+    {
+        HPX_TEST_EQ(stacks[i], stacks[0] + i * slot_size);
+    }
+
+    // once the arena is exhausted a new one is mapped
+    char* next = static_cast<char*>(posix::alloc_stack(size));
+    HPX_TEST(next + size <= arena_begin || next >= arena_end);
+    std::memset(next, 0xff, size);
+    stacks.push_back(next);
+
+    for (char* stack : stacks)
+    {
+        posix::free_stack(stack, size, 0);
+    }
+
+    // all freed stacks are available again, no new arena is needed
+    std::vector<char*> reused;
+    for (std::size_t i = 0; i != stacks.size(); ++i)
+    {
+        reused.push_back(static_cast<char*>(posix::alloc_stack(size)));
+        HPX_TEST(std::find(stacks.begin(), stacks.end(), reused.back()) !=
+            stacks.end());
+    }
+    for (char* stack : reused)
+    {
+        posix::free_stack(stack, size, 0);
+    }
+
+    posix::stack_arena_size = arena_size;
+    posix::use_stack_arenas = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocate a stack, use all of it, and reset it with the given reclamation
+// policy. Returns whether the pages were given back to the system, 'resident'
+// receives the number of resident bytes recorded for the stack.
+bool use_and_reset_stack(posix::stack_reclamation_policy policy,
+    std::size_t watermark, std::size_t& resident)
+{
+    posix::stack_reclamation = policy;
+    posix::stack_resident_watermark = watermark;
+
+    std::size_t const size = 16 * page_size;
+    void* stack = posix::alloc_stack(size);
+    posix::watermark_stack(stack, size);
+
+    // a stack which was used within its first page only is left alone
+    resident = 0;
+    HPX_TEST(!posix::reset_stack(stack, size, resident));
+    HPX_TEST_EQ(resident, static_cast<std::size_t>(0));
+
+    // use the whole stack, this overwrites the watermark
+    std::memset(stack, 0xff, size);
+
+    bool const reclaimed = posix::reset_stack(stack, size, resident);
+
+    // the watermark was re-armed, the stack is not reset again unless it is
+    // used beyond its first page
+    std::size_t resident_again = resident;
+    HPX_TEST(!posix::reset_stack(stack, size, resident_again));
+    HPX_TEST_EQ(resident_again, resident);
+
+    posix::free_stack(stack, size, resident);
+
+    posix::stack_reclamation = posix::stack_reclamation_policy::dontneed;
+    return reclaimed;
+}
+
+void test_reclamation_policies()
+{
+    std::size_t const body = 15 * page_size;
+    std::size_t const max_watermark = ~static_cast<std::size_t>(0);
+
+    HPX_TEST(posix::parse_stack_reclamation_policy("dontneed") ==
+        posix::stack_reclamation_policy::dontneed);
+    HPX_TEST(posix::parse_stack_reclamation_policy("free") ==
+        posix::stack_reclamation_policy::free);
+    HPX_TEST(posix::parse_stack_reclamation_policy("watermark") ==
+        posix::stack_reclamation_policy::watermark);
+
+    bool caught = false;
+    try
+    {
+        posix::parse_stack_reclamation_policy("unknown");
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught);
+
+    std::size_t resident = 0;
+
+    // dontneed: the pages are released right away
+    HPX_TEST(use_and_reset_stack(
+        posix::stack_reclamation_policy::dontneed, max_watermark, resident));
+    HPX_TEST_EQ(resident, static_cast<std::size_t>(0));
+
+    // free: the pages are released lazily, they may still be resident
+    HPX_TEST(use_and_reset_stack(
+        posix::stack_reclamation_policy::free, max_watermark, resident));
+    HPX_TEST_LTE(resident, body);
+
+    // watermark: below the watermark the pages are kept and accounted for,
+    // including the page faults that made them resident
+    posix::get_stack_page_fault_count(true);
+    HPX_TEST(!use_and_reset_stack(
+        posix::stack_reclamation_policy::watermark, max_watermark, resident));
+    HPX_TEST_EQ(resident, body);
+    HPX_TEST_LTE(static_cast<std::int64_t>(body / page_size),
+        posix::get_stack_page_fault_count(true));
+
+    // watermark: above the watermark the pages are released
+    HPX_TEST(use_and_reset_stack(
+        posix::stack_reclamation_policy::watermark, 0, resident));
+    HPX_TEST_EQ(resident, static_cast<std::size_t>(0));
+
+    // all stacks were freed, the resident size went back to where it was
+    std::int64_t const resident_bytes = posix::get_stack_resident_bytes(false);
+    std::vector<void*> stacks;
+    for (int i = 0; i != 4; ++i)
+    {
+        stacks.push_back(posix::alloc_stack(16 * page_size));
+    }
+    HPX_TEST_EQ(posix::get_stack_resident_bytes(false),
+        resident_bytes + static_cast<std::int64_t>(4 * page_size));
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, 16 * page_size, 0);
+    }
+    HPX_TEST_EQ(posix::get_stack_resident_bytes(false), resident_bytes);
+}
+
+int main()
+{
+    test_arena_reuse();
+    test_arena_exhaustion();
+    test_reclamation_policies();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
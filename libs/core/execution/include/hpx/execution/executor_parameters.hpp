@@ -10,8 +10,12 @@
 
 #include <hpx/execution/executors/adaptive_static_chunk_size.hpp>
 #include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/cache_aware_chunk_size.hpp>
+#include <hpx/execution/executors/deterministic_reduction.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
+#include <hpx/execution/executors/non_temporal_stores.hpp>
 #include <hpx/execution/executors/num_cores.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/execution/executors/single_pass_scan.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/cache_aware_chunk_size.hpp
+/// \page hpx::execution::experimental::cache_aware_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/config/cache_line_size.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Return the share of the cache of the given level available to a
+        // single processing unit (in bytes), zero if the cache level does not
+        // exist or the topology does not provide any cache information.
+        HPX_CORE_EXPORT std::size_t get_cache_size_per_pu(int level);
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces such that the data touched by
+    /// each piece (its working set) fits into half of the share of a given
+    /// cache level available to a single processing unit. The number of bytes
+    /// touched per loop iteration has to be specified (see also
+    /// \a make_cache_aware_chunk_size, which derives it from the value types
+    /// of the iterators used by an algorithm). The cache sizes are queried
+    /// from the hardware topology.
+    ///
+    /// Optionally, the chunk size is rounded such that the data of every
+    /// chunk spans a whole number of cache lines. This avoids false sharing at
+    /// the chunk boundaries for cache line aligned data.
+    ///
+    /// \note If the number of bytes per iteration is not known or if the
+    ///       topology does not provide the size of the requested cache level,
+    ///       the default chunk size is used.
+    ///
+    struct cache_aware_chunk_size
+    {
+        /// Construct a \a cache_aware_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a cache_aware_chunk_size executor
+        ///       parameter types will use the default chunk size.
+        ///
+        cache_aware_chunk_size() = default;
+
+        /// Construct a \a cache_aware_chunk_size executor parameters object
+        ///
+        /// \param bytes_per_iteration [in] The number of bytes of data
+        ///                     touched by a single loop iteration.
+        /// \param cache_level  [in] The cache level the working set of each
+        ///                     chunk should fit (default: 2).
+        /// \param align_to_cache_lines [in] Make the data of each chunk span
+        ///                     a whole number of cache lines (default: true).
+        ///
+        constexpr explicit cache_aware_chunk_size(
+            std::size_t bytes_per_iteration, int cache_level = 2,
+            bool align_to_cache_lines = true) noexcept
+          : bytes_per_iteration_(bytes_per_iteration)
+          , cache_level_(cache_level)
+          , align_to_cache_lines_(align_to_cache_lines)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::get_chunk_size_t,
+            cache_aware_chunk_size const& this_, Executor&& /* exec */,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t num_iterations)
+        {
+            if (this_.bytes_per_iteration_ == 0)
+            {
+                return 0;    // use default chunk size
+            }
+
+            std::size_t const cache_size =
+                detail::get_cache_size_per_pu(this_.cache_level_);
+            if (cache_size == 0)
+            {
+                return 0;    // use default chunk size
+            }
+
+            // leave room in the cache for other data
+            std::size_t chunk_size = (std::max) (std::size_t(1),
+                cache_size / 2 / this_.bytes_per_iteration_);
+
+            // make sure all cores get some work
+            if (cores > 1)
+            {
+                chunk_size = (std::min) (
+                    chunk_size, (num_iterations + cores - 1) / cores);
+            }
+
+            if (this_.align_to_cache_lines_)
+            {
+                // the smallest number of iterations touching a whole number
+                // of cache lines
+                std::size_t const line_size =
+                    hpx::threads::get_cache_line_size();
+                std::size_t const granularity = line_size /
+                    std::gcd(line_size, this_.bytes_per_iteration_);
+
+                chunk_size =
+                    (chunk_size + granularity - 1) / granularity * granularity;
+            }
+
+            return (std::max) (chunk_size, std::size_t(1));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & bytes_per_iteration_ & cache_level_ & align_to_cache_lines_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t bytes_per_iteration_ = 0;
+        int cache_level_ = 2;
+        bool align_to_cache_lines_ = true;
+        /// \endcond
+    };
+
+    /// Create a \a cache_aware_chunk_size executor parameters object for
+    /// algorithms operating on the given iterator types. The number of bytes
+    /// touched per loop iteration is the sum of the sizes of the value types
+    /// of all iterators.
+    ///
+    /// \param cache_level  [in] The cache level the working set of each
+    ///                     chunk should fit (default: 2).
+    /// \param align_to_cache_lines [in] Make the data of each chunk span
+    ///                     a whole number of cache lines (default: true).
+    ///
+    template <typename... Iters>
+    constexpr cache_aware_chunk_size make_cache_aware_chunk_size(
+        int cache_level = 2, bool align_to_cache_lines = true) noexcept
+    {
+        static_assert(sizeof...(Iters) != 0,
+            "make_cache_aware_chunk_size requires at least one iterator type");
+
+        return cache_aware_chunk_size(
+            (sizeof(typename std::iterator_traits<Iters>::value_type) + ...),
+            cache_level, align_to_cache_lines);
+    }
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::cache_aware_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
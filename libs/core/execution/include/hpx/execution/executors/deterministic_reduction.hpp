@@ -0,0 +1,70 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/deterministic_reduction.hpp
+/// \page hpx::execution::experimental::deterministic_reduction
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Floating point sums computed by algorithms invoked with this executor
+    /// parameters type are reproducible: the result is bit-identical
+    /// independently of the number of cores used, of the chunk sizes, and of
+    /// the order in which the chunks are executed. This applies to
+    /// \a transform_reduce (including the binary form computing dot
+    /// products), \a inclusive_scan, and to \a for_loop with
+    /// \a reduction_plus, whenever the values are summed using \a std::plus.
+    /// Instead of adding up the values directly, the algorithms deposit them
+    /// into binned reproducible floating point accumulators which are
+    /// combined after all chunks have finished. Other reductions are not
+    /// affected.
+    ///
+    /// \note This executor parameters type does not influence the chunk
+    ///       sizes used and can be combined with any other executor
+    ///       parameters, e.g.
+    ///       \code
+    ///       par.with(static_chunk_size(1000), deterministic_reduction())
+    ///       \endcode
+    ///
+    struct deterministic_reduction
+    {
+        /// Construct a \a deterministic_reduction executor parameters object
+        constexpr deterministic_reduction() noexcept = default;
+
+        /// \cond NOINTERNAL
+        // This executor parameters type tells the algorithms to use
+        // reproducible floating point accumulation.
+        using has_deterministic_reduction = std::true_type;
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        constexpr void serialize(Archive&, unsigned int const) noexcept
+        {
+        }
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::deterministic_reduction> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
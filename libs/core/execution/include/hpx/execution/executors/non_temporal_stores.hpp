@@ -0,0 +1,72 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/non_temporal_stores.hpp
+/// \page hpx::execution::experimental::non_temporal_stores
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parallel algorithms invoked with this executor parameters type write
+    /// their destination range using streaming (non-temporal) stores that
+    /// bypass the caches. This applies to \a fill, \a fill_n, \a copy,
+    /// \a copy_n, \a transform, \a uninitialized_copy,
+    /// \a uninitialized_copy_n, \a uninitialized_fill, and
+    /// \a uninitialized_fill_n whenever the destination is a contiguous range
+    /// of trivially copyable elements. For destinations much larger than the
+    /// last level cache this avoids evicting data that is still needed and
+    /// saves the memory bandwidth otherwise spent on reading the destination
+    /// before it is overwritten. All other algorithms and all other
+    /// destinations are not affected.
+    ///
+    /// \note Streaming stores are beneficial only if the written data is not
+    ///       accessed again soon after the algorithm has finished. This
+    ///       executor parameters type does not influence the chunk sizes
+    ///       used and can be combined with any other executor parameters,
+    ///       e.g.
+    ///       \code
+    ///       par.with(static_chunk_size(1 << 20), non_temporal_stores())
+    ///       \endcode
+    ///
+    struct non_temporal_stores
+    {
+        /// Construct a \a non_temporal_stores executor parameters object
+        constexpr non_temporal_stores() noexcept = default;
+
+        /// \cond NOINTERNAL
+        // This executor parameters type tells the algorithms to use streaming
+        // stores for the destination range.
+        using has_non_temporal_stores = std::true_type;
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        constexpr void serialize(Archive&, unsigned int const) noexcept
+        {
+        }
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::non_temporal_stores> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/single_pass_scan.hpp
+/// \page hpx::execution::experimental::single_pass_scan
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Scan based algorithms (inclusive_scan, exclusive_scan, the transform
+    /// scans, copy_if, remove_copy, unique_copy, partition_copy) invoked with
+    /// this executor parameters type perform a single pass over their input
+    /// instead of reducing all chunks before scanning them. The input is split
+    /// into tiles of \a tile_size elements that are processed in order by one
+    /// task per core. Each tile publishes its aggregate and, as soon as it is
+    /// known, its inclusive prefix and determines its own prefix by looking
+    /// back at the tiles preceding it (decoupled look-back). Tiles are small
+    /// enough to remain in the cache between reducing and scanning them, so
+    /// the data is read from memory only once.
+    ///
+    /// \note This executor parameters type defines the chunk size to use and
+    ///       can't be combined with other parameters types that do the same.
+    ///
+    struct single_pass_scan
+    {
+        /// Construct a \a single_pass_scan executor parameters object
+        ///
+        /// \note Default constructed \a single_pass_scan executor parameter
+        ///       types will use a tile size of 8192 elements.
+        ///
+        single_pass_scan() = default;
+
+        /// Construct a \a single_pass_scan executor parameters object
+        ///
+        /// \param tile_size    [in] The number of elements to combine into
+        ///                     one tile.
+        ///
+        constexpr explicit single_pass_scan(std::size_t tile_size) noexcept
+          : tile_size_(tile_size != 0 ? tile_size : default_tile_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type tells the scan partitioner to use
+        // decoupled look-back.
+        using has_single_pass_scan = std::true_type;
+
+        template <typename Executor>
+        friend constexpr std::size_t tag_override_invoke(
+            hpx::execution::experimental::get_chunk_size_t,
+            single_pass_scan const& this_, Executor&& /* exec */,
+            hpx::chrono::steady_duration const&, std::size_t /* cores */,
+            std::size_t /* num_tasks */) noexcept
+        {
+            return this_.tile_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & tile_size_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        static constexpr std::size_t default_tile_size = 8192;
+
+        std::size_t tile_size_ = default_tile_size;
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::single_pass_scan> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,45 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/cache_aware_chunk_size.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::execution::experimental::detail {
+
+    std::size_t get_cache_size_per_pu(int level)
+    {
+        // the topology is queried once for each of the cache levels (1 to 5)
+        constexpr std::size_t unknown = static_cast<std::size_t>(-1);
+        static std::array<std::atomic<std::size_t>, 5> cache_sizes = {
+            {unknown, unknown, unknown, unknown, unknown}};
+
+        if (level < 1 || level > 5)
+        {
+            return 0;
+        }
+
+        std::atomic<std::size_t>& cache_size = cache_sizes[level - 1];
+
+        std::size_t size = cache_size.load(std::memory_order_relaxed);
+        if (size == unknown)
+        {
+            threads::topology const& topo = threads::create_topology();
+
+            error_code ec(throwmode::lightweight);
+            threads::mask_cref_type mask = topo.get_thread_affinity_mask(0, ec);
+
+            size = ec ? 0 : topo.get_cache_size(mask, level);
+            cache_size.store(size, std::memory_order_relaxed);
+        }
+        return size;
+    }
+}    // namespace hpx::execution::experimental::detail
@@ -108,6 +108,48 @@ void test_guided_chunk_size()
     }
 }
 
+void test_cache_aware_chunk_size()
+{
+    using hpx::execution::experimental::cache_aware_chunk_size;
+
+    {
+        cache_aware_chunk_size cacs;
+        parameters_test(cacs);
+    }
+
+    {
+        cache_aware_chunk_size cacs(sizeof(std::size_t));
+        parameters_test(cacs);
+    }
+
+    {
+        cache_aware_chunk_size cacs(3 * sizeof(int), 1, false);
+        parameters_test(cacs);
+    }
+
+    {
+        auto cacs = hpx::execution::experimental::make_cache_aware_chunk_size<
+            std::vector<std::size_t>::iterator, double*>(3);
+        parameters_test(cacs);
+    }
+
+    // the chunk size spans a whole number of cache lines
+    {
+        cache_aware_chunk_size cacs(24);
+        hpx::execution::parallel_executor exec;
+
+        std::size_t const chunk_size =
+            hpx::execution::experimental::get_chunk_size(cacs, exec,
+                hpx::chrono::null_duration, 4, std::size_t(1) << 30);
+        if (chunk_size != 0)
+        {
+            HPX_TEST_EQ(
+                chunk_size * 24 % hpx::threads::get_cache_line_size(),
+                std::size_t(0));
+        }
+    }
+}
+
 void test_auto_chunk_size()
 {
     {
@@ -223,6 +265,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_static_chunk_size();
     test_adaptive_static_chunk_size();
     test_guided_chunk_size();
+    test_cache_aware_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
     test_num_cores();
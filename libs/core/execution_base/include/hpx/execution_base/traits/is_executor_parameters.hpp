@@ -105,6 +105,88 @@ namespace hpx::execution::experimental {
     inline constexpr bool extract_invokes_testing_function_v =
         extract_invokes_testing_function<Parameters>::value;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes an embedded type 'has_single_pass_scan' it
+    // is assumed that scan algorithms should be performed in a single pass
+    // over the data (using decoupled look-back between the chunks).
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_single_pass_scan : std::false_type
+    {
+        // by default, scans are performed in two passes
+    };
+
+    template <typename Parameters>
+    struct extract_has_single_pass_scan<Parameters,
+        std::void_t<typename Parameters::has_single_pass_scan>>
+      : std::true_type
+    {
+    };
+
+    template <typename Parameters>
+    struct extract_has_single_pass_scan<::std::reference_wrapper<Parameters>>
+      : extract_has_single_pass_scan<Parameters>
+    {
+    };
+
+    template <typename Parameters>
+    inline constexpr bool extract_has_single_pass_scan_v =
+        extract_has_single_pass_scan<Parameters>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes an embedded type
+    // 'has_deterministic_reduction' it is assumed that floating point sums
+    // should be computed reproducibly, independently of the chunking.
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_deterministic_reduction : std::false_type
+    {
+        // by default, values are summed in any order
+    };
+
+    template <typename Parameters>
+    struct extract_has_deterministic_reduction<Parameters,
+        std::void_t<typename Parameters::has_deterministic_reduction>>
+      : std::true_type
+    {
+    };
+
+    template <typename Parameters>
+    struct extract_has_deterministic_reduction<
+        ::std::reference_wrapper<Parameters>>
+      : extract_has_deterministic_reduction<Parameters>
+    {
+    };
+
+    template <typename Parameters>
+    inline constexpr bool extract_has_deterministic_reduction_v =
+        extract_has_deterministic_reduction<Parameters>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes an embedded type 'has_non_temporal_stores'
+    // it is assumed that algorithms writing large destination ranges should
+    // bypass the caches using streaming (non-temporal) stores.
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_non_temporal_stores : std::false_type
+    {
+        // by default, regular stores are used
+    };
+
+    template <typename Parameters>
+    struct extract_has_non_temporal_stores<Parameters,
+        std::void_t<typename Parameters::has_non_temporal_stores>>
+      : std::true_type
+    {
+    };
+
+    template <typename Parameters>
+    struct extract_has_non_temporal_stores<::std::reference_wrapper<Parameters>>
+      : extract_has_non_temporal_stores<Parameters>
+    {
+    };
+
+    template <typename Parameters>
+    inline constexpr bool extract_has_non_temporal_stores_v =
+        extract_has_non_temporal_stores<Parameters>::value;
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
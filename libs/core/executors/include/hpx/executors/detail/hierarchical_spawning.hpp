@@ -127,8 +127,13 @@ namespace hpx::parallel::execution::detail {
     {
         HPX_ASSERT(pool);
 
+        // the task spawning the work waits for its completion, so it needs a
+        // stack even if the spawned tasks run stackless
+        auto spawn_policy =
+            hpx::execution::experimental::with_stackless(policy, false);
+
         return hpx::detail::async_launch_policy_dispatch<Launch>::call(
-            policy, desc, pool,
+            spawn_policy, desc, pool,
             [](hpx::threads::thread_description const& desc,
                 threads::thread_pool_base* pool, std::size_t first_thread,
                 std::size_t num_threads, std::size_t hierarchical_threshold,
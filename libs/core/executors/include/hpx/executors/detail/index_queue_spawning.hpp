@@ -340,9 +340,13 @@ namespace hpx::parallel::execution::detail {
                 return;
             }
 
-            // run task on small stack
+            // run task on small stack, unless the chunks were requested to
+            // run stackless (they never suspend)
             auto post_policy = hpx::execution::experimental::with_stacksize(
-                policy, threads::thread_stacksize::small_);
+                policy,
+                hpx::execution::experimental::get_stackless(policy) ?
+                    threads::thread_stacksize::nostack :
+                    threads::thread_stacksize::small_);
 
             if (dont_bind_to_core)
             {
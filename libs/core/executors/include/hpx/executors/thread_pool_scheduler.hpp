@@ -9,6 +9,7 @@
 
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
@@ -152,6 +153,31 @@ namespace hpx::execution::experimental {
             return exec.get_first_core();
         }
 
+        // support with_data_placement property
+        // clang-format off
+        template <typename Executor_,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_convertible_v<Executor_, thread_pool_policy_scheduler>
+            )>
+        // clang-format on
+        friend constexpr auto tag_invoke(
+            hpx::execution::experimental::with_data_placement_t,
+            Executor_ const& scheduler,
+            hpx::execution::experimental::data_placement_hint hint) noexcept
+        {
+            auto sched_with_placement = scheduler;
+            sched_with_placement.data_placement_ = hint;
+            return sched_with_placement;
+        }
+
+        // support get_data_placement property
+        friend constexpr hpx::execution::experimental::data_placement_hint
+        tag_invoke(hpx::execution::experimental::get_data_placement_t,
+            thread_pool_policy_scheduler const& scheduler) noexcept
+        {
+            return scheduler.data_placement_;
+        }
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         // support with_annotation property
         // clang-format off
@@ -428,6 +454,7 @@ namespace hpx::execution::experimental {
         Policy policy_;
         std::size_t first_core_ = 0;
         std::size_t num_cores_ = 0;
+        hpx::execution::experimental::data_placement_hint data_placement_;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
@@ -37,12 +37,14 @@
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -114,6 +116,141 @@ namespace hpx::execution::experimental::detail {
         return mask;
     }
 
+    // Return the NUMA domain of each of the given worker threads.
+    inline std::vector<std::uint32_t> get_worker_numa_domains(
+        std::size_t first_thread, std::size_t num_threads)
+    {
+        auto const& rp = hpx::resource::get_partitioner();
+        auto const& topo = hpx::threads::create_topology();
+
+        std::vector<std::uint32_t> domains(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            domains[i] = static_cast<std::uint32_t>(
+                topo.get_numa_node_number(rp.get_pu_num(i + first_thread)));
+        }
+        return domains;
+    }
+
+    // Return the NUMA domain holding the data accessed by each chunk. The
+    // data of a chunk is represented by the page holding its middle element.
+    // Returns an empty vector if the placement of any of those pages can't
+    // be determined (e.g. because they were not touched yet).
+    inline std::vector<std::uint32_t> get_chunk_numa_domains(
+        hpx::execution::experimental::data_placement_hint const& placement,
+        std::size_t const size, std::uint32_t const chunk_size,
+        std::uint32_t const num_chunks)
+    {
+        auto const* first = static_cast<char const*>(placement.first);
+        auto const bytes = static_cast<std::size_t>(
+            static_cast<char const*>(placement.last) - first);
+
+        auto const& topo = hpx::threads::create_topology();
+
+        std::vector<std::uint32_t> domains(num_chunks);
+        try
+        {
+            for (std::uint32_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t const begin =
+                    static_cast<std::size_t>(chunk) * chunk_size;
+                std::size_t const end = (std::min) (begin + chunk_size, size);
+                std::size_t const mid = begin + (end - begin) / 2;
+
+                // avoid overflowing the intermediate products
+                std::size_t const offset =
+                    (bytes / size) * mid + (bytes % size) * mid / size;
+
+                int const domain = topo.get_numa_domain(first + offset);
+                if (domain < 0)
+                {
+                    return {};
+                }
+                domains[chunk] = static_cast<std::uint32_t>(domain);
+            }
+        }
+        catch (hpx::exception const&)
+        {
+            return {};
+        }
+        return domains;
+    }
+
+    // Distribute the chunks such that each worker thread receives a
+    // contiguous range of chunks whose data is placed on the NUMA domain of
+    // the worker thread. This is possible only if the chunks placed on each
+    // of the domains form a single contiguous range (as is the case for
+    // arrays initialized by a parallel loop using first touch or allocated
+    // using a numa_binding_allocator) and if each domain holding some of the
+    // chunks has at least one worker thread. Worker threads on domains not
+    // holding any of the chunks receive no chunks. Returns false if the
+    // chunks can't be distributed this way.
+    template <typename Queues>
+    bool init_queues_numa(Queues& queues,
+        std::vector<std::uint32_t> const& worker_domains,
+        std::vector<std::uint32_t> const& chunk_domains)
+    {
+        std::size_t const num_workers = worker_domains.size();
+        std::size_t const num_chunks = chunk_domains.size();
+
+        std::vector<std::uint32_t> workers;
+        std::vector<std::uint32_t> seen_domains;
+        for (std::size_t begin = 0; begin != num_chunks; /**/)
+        {
+            std::uint32_t const domain = chunk_domains[begin];
+
+            std::size_t end = begin + 1;
+            while (end != num_chunks && chunk_domains[end] == domain)
+            {
+                ++end;
+            }
+
+            if (std::find(seen_domains.begin(), seen_domains.end(),
+                    domain) != seen_domains.end())
+            {
+                return false;
+            }
+            seen_domains.push_back(domain);
+
+            workers.clear();
+            for (std::size_t worker = 0; worker != num_workers; ++worker)
+            {
+                if (worker_domains[worker] == domain)
+                {
+                    workers.push_back(static_cast<std::uint32_t>(worker));
+                }
+            }
+
+            if (workers.empty())
+            {
+                return false;
+            }
+
+            // depth-first placement amongst the worker threads of the domain
+            std::size_t const n = workers.size();
+            std::size_t const count = end - begin;
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                queues[workers[i]].data_.reset(
+                    static_cast<std::uint32_t>(begin + (i * count) / n),
+                    static_cast<std::uint32_t>(begin + ((i + 1) * count) / n));
+            }
+
+            begin = end;
+        }
+
+        // worker threads on domains without any of the data start out empty
+        for (std::size_t worker = 0; worker != num_workers; ++worker)
+        {
+            if (std::find(seen_domains.begin(), seen_domains.end(),
+                    worker_domains[worker]) == seen_domains.end())
+            {
+                queues[worker].data_.reset(0, 0);
+            }
+        }
+        return true;
+    }
+
     template <typename OperationState>
     struct task_function;
 
@@ -174,19 +311,51 @@ namespace hpx::execution::experimental::detail {
                 static constexpr auto opposite_end =
                     hpx::concurrency::detail::opposite_end_v<Which>;
 
-                for (std::uint32_t offset = 1;
-                    offset != op_state->num_worker_threads; ++offset)
+                auto const& domains = op_state->worker_domains;
+                if (domains.empty())
                 {
-                    std::size_t neighbor_thread =
-                        (worker_thread + offset) % op_state->num_worker_threads;
-                    auto& neighbor_queue =
-                        op_state->queues[neighbor_thread].data_;
+                    steal_work<opposite_end>(
+                        ts, [](std::size_t) { return true; });
+                }
+                else
+                {
+                    // The chunks were placed close to their data, steal from
+                    // worker threads on other NUMA domains only after all
+                    // chunks on the own domain have been handled.
+                    std::uint32_t const domain = domains[worker_thread];
+                    steal_work<opposite_end>(ts, [&](std::size_t neighbor) {
+                        return domains[neighbor] == domain;
+                    });
+                    steal_work<opposite_end>(ts, [&](std::size_t neighbor) {
+                        return domains[neighbor] != domain;
+                    });
+                }
+            }
+        }
 
-                    while (
-                        (index = neighbor_queue.template pop<opposite_end>()))
-                    {
-                        do_work_chunk(ts, *index);
-                    }
+        // Steal chunks from the given end of the queues of all neighboring
+        // worker threads for which pred returns true.
+        template <hpx::concurrency::detail::queue_end Which, typename Ts,
+            typename Pred>
+        void steal_work(Ts& ts, Pred&& pred) const
+        {
+            auto const worker_thread = task_f->worker_thread;
+
+            hpx::optional<std::uint32_t> index;
+            for (std::uint32_t offset = 1;
+                offset != op_state->num_worker_threads; ++offset)
+            {
+                std::size_t neighbor_thread =
+                    (worker_thread + offset) % op_state->num_worker_threads;
+                if (!pred(neighbor_thread))
+                {
+                    continue;
+                }
+
+                auto& neighbor_queue = op_state->queues[neighbor_thread].data_;
+                while ((index = neighbor_queue.template pop<Which>()))
+                {
+                    do_work_chunk(ts, *index);
                 }
             }
         }
@@ -385,6 +554,75 @@ namespace hpx::execution::experimental::detail {
             queue.reset(part_begin, part_end, num_threads);
         }
 
+        void init_queues(hpx::threads::thread_schedule_hint const hint,
+            std::uint32_t const num_chunks) noexcept
+        {
+            using placement = hpx::threads::thread_placement_hint;
+
+            for (std::uint32_t worker_thread = 0;
+                worker_thread != op_state->num_worker_threads; ++worker_thread)
+            {
+                if (hint.placement_mode() == placement::breadth_first ||
+                    hint.placement_mode() == placement::breadth_first_reverse)
+                {
+                    init_queue_breadth_first(worker_thread, num_chunks,
+                        op_state->num_worker_threads);
+                }
+                else
+                {
+                    // the default for this scheduler is depth-first placement
+                    init_queue_depth_first(worker_thread, num_chunks,
+                        op_state->num_worker_threads);
+                }
+            }
+        }
+
+        // Place the chunks on the worker threads running on the NUMA domain
+        // holding their data, if the scheduler carries a data placement hint
+        // and the worker threads span more than one domain. The tasks are
+        // pinned to the worker threads only if no explicit thread hint was
+        // given, the placement is skipped otherwise. Returns false if the
+        // chunks were not placed this way.
+        bool init_queues_numa_placement(
+            hpx::threads::thread_schedule_hint const hint,
+            std::size_t const size, std::uint32_t const chunk_size,
+            std::uint32_t const num_chunks)
+        {
+            op_state->worker_domains.clear();
+
+            auto const data_placement =
+                hpx::execution::experimental::get_data_placement(
+                    op_state->scheduler);
+            if (data_placement.empty() ||
+                hint.mode != hpx::threads::thread_schedule_hint_mode::none ||
+                hint.hint != -1)
+            {
+                return false;
+            }
+
+            auto worker_domains = detail::get_worker_numa_domains(
+                op_state->first_thread, op_state->num_worker_threads);
+            if (std::adjacent_find(worker_domains.begin(),
+                    worker_domains.end(),
+                    std::not_equal_to<>()) == worker_domains.end())
+            {
+                // all worker threads run on the same domain
+                return false;
+            }
+
+            auto const chunk_domains = detail::get_chunk_numa_domains(
+                data_placement, size, chunk_size, num_chunks);
+            if (chunk_domains.empty() ||
+                !detail::init_queues_numa(
+                    op_state->queues, worker_domains, chunk_domains))
+            {
+                return false;
+            }
+
+            op_state->worker_domains = HPX_MOVE(worker_domains);
+            return true;
+        }
+
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
         template <typename Task>
@@ -392,10 +630,13 @@ namespace hpx::execution::experimental::detail {
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
             auto& queue = op_state->queues[worker_thread].data_;
-            if (queue.empty())
+            if (queue.empty() &&
+                (op_state->worker_domains.empty() || !task_f.allow_stealing))
             {
                 // If the queue is empty we don't spawn a task. We only signal
-                // that this "task" is ready.
+                // that this "task" is ready. If the chunks were placed close
+                // to their data, worker threads without any chunks on their
+                // own NUMA domain are still spawned to steal chunks.
                 task_f.finish();
                 return;
             }
@@ -489,21 +730,10 @@ namespace hpx::execution::experimental::detail {
 
             // Initialize the queues for all worker threads so that worker
             // threads can start stealing immediately when they start.
-            for (std::uint32_t worker_thread = 0;
-                worker_thread != op_state->num_worker_threads; ++worker_thread)
+            if (!init_queues_numa_placement(
+                    hint, size, chunk_size, num_chunks))
             {
-                if (hint.placement_mode() == placement::breadth_first ||
-                    hint.placement_mode() == placement::breadth_first_reverse)
-                {
-                    init_queue_breadth_first(worker_thread, num_chunks,
-                        op_state->num_worker_threads);
-                }
-                else
-                {
-                    // the default for this scheduler is depth-first placement
-                    init_queue_depth_first(worker_thread, num_chunks,
-                        op_state->num_worker_threads);
-                }
+                init_queues(hint, num_chunks);
             }
 
             // Spawn the worker threads for all except the local queue.
@@ -612,6 +842,12 @@ namespace hpx::execution::experimental::detail {
     // thread will be spawned. Once the HPX thread has finished working on its
     // own queue, it will attempt to steal work from other queues.
     //
+    // If the scheduler carries a data placement hint (see
+    // with_data_placement) the chunks are instead assigned to the worker
+    // threads running on the NUMA domain holding the data of each chunk.
+    // Worker threads then steal from queues on their own domain first and
+    // from queues on other domains only once those are exhausted.
+    //
     // Since predecessor sender must complete on an HPX thread (the completion
     // scheduler is a thread_pool_scheduler; otherwise the customization defined
     // in this file is not chosen) it will be reused as one of the worker
@@ -785,6 +1021,10 @@ namespace hpx::execution::experimental::detail {
             hpx::util::cache_aligned_data<std::atomic<std::size_t>>
                 tasks_remaining;
 
+            // NUMA domain of each worker thread, empty if the chunks were not
+            // placed on the domains holding their data
+            std::vector<std::uint32_t> worker_domains;
+
             using value_types = value_types_of_t<Sender, empty_env,
                 decayed_tuple, hpx::variant>;
             hpx::util::detail::prepend_t<value_types, hpx::monostate> ts;
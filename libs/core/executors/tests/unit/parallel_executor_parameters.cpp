@@ -7,8 +7,10 @@
 #include <hpx/execution.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -46,6 +48,58 @@ void test_stacksize()
     }
 }
 
+void test_stackless()
+{
+    using executor = hpx::execution::parallel_executor;
+
+    executor exec;
+    HPX_TEST(!hpx::execution::experimental::get_stackless(exec));
+
+    auto newexec = hpx::execution::experimental::with_stackless(exec);
+    HPX_TEST(hpx::execution::experimental::get_stackless(newexec));
+    HPX_TEST(hpx::execution::experimental::get_stacksize(newexec) ==
+        hpx::threads::thread_stacksize::nostack);
+
+    // tasks run without a stack of their own and may yield
+    HPX_TEST(hpx::parallel::execution::async_execute(newexec, [] {
+        hpx::this_thread::yield();
+        return get_stacksize();
+    }).get() == hpx::threads::thread_stacksize::nostack);
+
+    // suspending a stackless task is reported as an error instead of
+    // returning as if it was woken up
+    HPX_TEST(hpx::parallel::execution::async_execute(newexec, [] {
+        try
+        {
+            hpx::this_thread::suspend(
+                hpx::threads::thread_schedule_state::suspended);
+        }
+        catch (hpx::exception const& e)
+        {
+            return e.get_error() == hpx::error::invalid_status;
+        }
+        return false;
+    }).get());
+
+    // bulk execution runs all chunks stackless
+    std::atomic<std::size_t> stackful(0);
+    std::vector<int> v(1000);
+    hpx::parallel::execution::bulk_sync_execute(
+        newexec,
+        [&](int) {
+            if (get_stacksize() != hpx::threads::thread_stacksize::nostack)
+                ++stackful;
+        },
+        v);
+    HPX_TEST_EQ(stackful.load(), std::size_t(0));
+
+    // stackless tasks can be turned back into stackful ones
+    auto oldexec = hpx::execution::experimental::with_stackless(newexec, false);
+    HPX_TEST(!hpx::execution::experimental::get_stackless(oldexec));
+    HPX_TEST(hpx::execution::experimental::get_stacksize(oldexec) ==
+        hpx::threads::thread_stacksize::default_);
+}
+
 hpx::threads::thread_priority get_priority()
 {
     return hpx::this_thread::get_priority();
@@ -171,6 +225,7 @@ void test_num_cores()
 int hpx_main()
 {
     test_stacksize();
+    test_stackless();
     test_priority();
     test_hint();
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
@@ -11,18 +11,23 @@
 #if !defined(HPX_CLANG_VERSION) ||                                             \
     ((HPX_CLANG_VERSION / 10000) != 11 && (HPX_CLANG_VERSION / 10000) != 8)
 
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/non_contiguous_index_queue.hpp>
 #include <hpx/condition_variable.hpp>
 #include <hpx/execution.hpp>
+#include <hpx/executors/thread_pool_scheduler_bulk.hpp>
 #include <hpx/functional.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/mutex.hpp>
 #include <hpx/thread.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <stdexcept>
 #include <string>
@@ -337,6 +342,17 @@ void test_properties()
         // thread_pool_scheduler holds the property.
     }
 
+    {
+        std::vector<double> data(100);
+        auto exec_prop =
+            ex::with_data_placement(sched, ex::data_placement_hint(data));
+        HPX_TEST(ex::get_data_placement(sched).empty());
+        HPX_TEST_EQ(ex::get_data_placement(exec_prop).first,
+            static_cast<void const*>(data.data()));
+        HPX_TEST_EQ(ex::get_data_placement(exec_prop).last,
+            static_cast<void const*>(data.data() + data.size()));
+    }
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
     {
         char const* annotation = "<test>";
@@ -2199,6 +2215,148 @@ void test_completion_scheduler()
     }
 }
 
+void test_bulk_data_placement()
+{
+    std::vector<int> const ns = {0, 1, 10, 43, 10007};
+
+    for (int n : ns)
+    {
+        // initialize the data using first touch from all worker threads
+        std::vector<double> data(n);
+        std::vector<int> v(n, 0);
+        auto sched = ex::thread_pool_scheduler{};
+
+#if defined(HPX_HAVE_STDEXEC)
+        tt::sync_wait(ex::schedule(sched) |
+            ex::bulk(n, [&](int i) { data[i] = static_cast<double>(i); }));
+#else
+        ex::schedule(sched) |
+            ex::bulk(n, [&](int i) { data[i] = static_cast<double>(i); }) |
+            tt::sync_wait();
+#endif
+
+        // run the chunks close to their data, all elements have to be
+        // visited exactly once
+        auto placed_sched =
+            ex::with_data_placement(sched, ex::data_placement_hint(data));
+        std::array<hpx::threads::thread_schedule_hint, 3> const hints{
+            {hpx::threads::thread_schedule_hint{},
+                hpx::threads::thread_schedule_hint{
+                    hpx::threads::thread_placement_hint::depth_first_reverse},
+                hpx::threads::thread_schedule_hint{
+                    hpx::threads::thread_sharing_hint::do_not_share_function}}};
+
+        for (auto const hint : hints)
+        {
+            std::fill(v.begin(), v.end(), 0);
+
+#if defined(HPX_HAVE_STDEXEC)
+            tt::sync_wait(ex::schedule(ex::with_hint(placed_sched, hint)) |
+                ex::bulk(n, [&](int i) {
+                    HPX_TEST_EQ(data[i], static_cast<double>(i));
+                    ++v[i];
+                }));
+#else
+            ex::schedule(ex::with_hint(placed_sched, hint)) |
+                ex::bulk(n,
+                    [&](int i) {
+                        HPX_TEST_EQ(data[i], static_cast<double>(i));
+                        ++v[i];
+                    }) |
+                tt::sync_wait();
+#endif
+
+            for (int i = 0; i < n; ++i)
+            {
+                HPX_TEST_EQ(v[i], 1);
+            }
+        }
+    }
+}
+
+using index_queues_type = std::vector<hpx::util::cache_aligned_data<
+    hpx::concurrency::detail::non_contiguous_index_queue<>>>;
+
+// Verify that the chunks assigned to each of the worker threads form the
+// expected range [first, last).
+void check_queues(index_queues_type& queues,
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> const& expected)
+{
+    HPX_TEST_EQ(queues.size(), expected.size());
+    for (std::size_t worker = 0; worker != queues.size(); ++worker)
+    {
+        std::uint32_t next = expected[worker].first;
+        while (auto const chunk = queues[worker].data_.pop_left())
+        {
+            HPX_TEST_EQ(*chunk, next);
+            ++next;
+        }
+        HPX_TEST_EQ(next, expected[worker].second);
+    }
+}
+
+void test_bulk_init_queues_numa()
+{
+    namespace detail = hpx::execution::experimental::detail;
+
+    // all chunks of each domain are contiguous, the chunks are distributed
+    // depth-first amongst the worker threads of the domain
+    {
+        std::vector<std::uint32_t> const worker_domains = {0, 0, 1, 1};
+        std::vector<std::uint32_t> const chunk_domains = {
+            0, 0, 0, 0, 0, 1, 1, 1};
+
+        index_queues_type queues(worker_domains.size());
+        HPX_TEST(
+            detail::init_queues_numa(queues, worker_domains, chunk_domains));
+        check_queues(queues, {{0, 2}, {2, 5}, {5, 6}, {6, 8}});
+    }
+
+    // the worker threads of a domain don't have to be adjacent and the
+    // domains don't have to be ordered, worker threads on a domain not
+    // holding any of the chunks receive no chunks
+    {
+        std::vector<std::uint32_t> const worker_domains = {1, 2, 0, 2, 1};
+        std::vector<std::uint32_t> const chunk_domains = {2, 2, 2, 0, 0};
+
+        index_queues_type queues(worker_domains.size());
+        HPX_TEST(
+            detail::init_queues_numa(queues, worker_domains, chunk_domains));
+        check_queues(queues, {{0, 0}, {0, 1}, {3, 5}, {1, 3}, {0, 0}});
+    }
+
+    // no chunks at all
+    {
+        std::vector<std::uint32_t> const worker_domains = {0, 1};
+        std::vector<std::uint32_t> const chunk_domains;
+
+        index_queues_type queues(worker_domains.size());
+        HPX_TEST(
+            detail::init_queues_numa(queues, worker_domains, chunk_domains));
+        check_queues(queues, {{0, 0}, {0, 0}});
+    }
+
+    // the chunks of domain 0 are not contiguous
+    {
+        std::vector<std::uint32_t> const worker_domains = {0, 1};
+        std::vector<std::uint32_t> const chunk_domains = {0, 0, 1, 1, 0};
+
+        index_queues_type queues(worker_domains.size());
+        HPX_TEST(
+            !detail::init_queues_numa(queues, worker_domains, chunk_domains));
+    }
+
+    // domain 2 holds some of the chunks but has no worker threads
+    {
+        std::vector<std::uint32_t> const worker_domains = {0, 0, 1};
+        std::vector<std::uint32_t> const chunk_domains = {0, 1, 2, 2};
+
+        index_queues_type queues(worker_domains.size());
+        HPX_TEST(
+            !detail::init_queues_numa(queues, worker_domains, chunk_domains));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -2228,6 +2386,8 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_init_queues_numa();
+    test_bulk_data_placement();
     test_completion_scheduler();
 
     return hpx::local::finalize();
@@ -0,0 +1,249 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file continuation_arena.hpp
+/// \page hpx::experimental::continuation_arena
+/// \headerfile hpx/future.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::lcos::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The memory managed by a continuation_arena. Allocations are carved from
+    // a list of fixed size blocks by bumping an offset. The blocks are
+    // recycled as soon as all allocations have been released.
+    class HPX_CORE_EXPORT continuation_arena_data
+    {
+    public:
+        explicit continuation_arena_data(std::size_t block_size);
+
+        continuation_arena_data(continuation_arena_data const&) = delete;
+        continuation_arena_data(continuation_arena_data&&) = delete;
+        continuation_arena_data& operator=(
+            continuation_arena_data const&) = delete;
+        continuation_arena_data& operator=(continuation_arena_data&&) = delete;
+
+        ~continuation_arena_data();
+
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment);
+        void deallocate(
+            void* p, std::size_t bytes, std::size_t alignment) noexcept;
+
+        [[nodiscard]] std::size_t block_size() const noexcept
+        {
+            return block_size_;
+        }
+
+        // return the number of blocks allocated so far
+        [[nodiscard]] std::size_t num_blocks() const noexcept;
+
+        // return the number of allocations not released yet
+        [[nodiscard]] std::size_t num_allocations() const noexcept;
+
+    private:
+        // Requests which do not fit into a block or which need a larger
+        // alignment than guaranteed by a block are served by operator new.
+        [[nodiscard]] bool served_by_arena(
+            std::size_t bytes, std::size_t alignment) const noexcept
+        {
+            return bytes <= block_size_ &&
+                alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        }
+
+        friend void intrusive_ptr_add_ref(continuation_arena_data* p) noexcept
+        {
+            ++p->count_;
+        }
+        friend void intrusive_ptr_release(continuation_arena_data* p) noexcept
+        {
+            if (0 == --p->count_)
+            {
+                delete p;
+            }
+        }
+
+        using mutex_type = hpx::spinlock;
+
+        mutable mutex_type mtx_;
+        std::vector<char*> blocks_;
+        std::size_t current_ = 0;    // index of the block in use
+        std::size_t offset_ = 0;     // first unused byte in the current block
+        std::size_t allocated_ = 0;    // allocations not released yet
+        std::size_t const block_size_;
+        util::atomic_count count_;
+    };
+}    // namespace hpx::lcos::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocator drawing its memory from a \a continuation_arena.
+    ///
+    /// Copies of the allocator keep the memory of the arena alive. All
+    /// allocators referring to the same arena compare equal.
+    template <typename T = char>
+    class continuation_arena_allocator
+    {
+    public:
+        using value_type = T;
+        using is_always_equal = std::false_type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /// \cond NOINTERNAL
+        explicit continuation_arena_allocator(
+            hpx::intrusive_ptr<lcos::detail::continuation_arena_data>
+                arena) noexcept
+          : arena_(HPX_MOVE(arena))
+        {
+        }
+        /// \endcond
+
+        template <typename U>
+        continuation_arena_allocator(
+            continuation_arena_allocator<U> const& rhs) noexcept
+          : arena_(rhs.arena())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            arena_->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        /// \cond NOINTERNAL
+        [[nodiscard]] lcos::detail::continuation_arena_data* arena()
+            const noexcept
+        {
+            return arena_.get();
+        }
+        /// \endcond
+
+        template <typename U>
+        [[nodiscard]] friend bool operator==(
+            continuation_arena_allocator const& lhs,
+            continuation_arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena() == rhs.arena();
+        }
+
+        template <typename U>
+        [[nodiscard]] friend bool operator!=(
+            continuation_arena_allocator const& lhs,
+            continuation_arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena() != rhs.arena();
+        }
+
+    private:
+        hpx::intrusive_ptr<lcos::detail::continuation_arena_data> arena_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Memory arena for the shared states of chains of continuations.
+    ///
+    /// Each invocation of \a future::then creates a new shared state. Shared
+    /// states created by the allocator returned from \a get_allocator are
+    /// carved from a list of memory blocks by bumping an offset instead of
+    /// being allocated individually. The blocks are reused as soon as all
+    /// shared states allocated from the arena have been released, e.g. when
+    /// a chain of continuations has completed.
+    ///
+    /// Continuations attached using \a future::then or \a shared_future::then
+    /// to a future whose shared state was allocated from an arena are
+    /// allocated from the same arena, no allocator has to be passed to those.
+    /// A chain is started by using the allocator with one of the allocator
+    /// aware facilities creating a future, i.e.
+    /// \a hpx::make_ready_future_alloc, \a future::then_alloc, or
+    /// \a hpx::promise (constructed using \a std::allocator_arg).
+    ///
+    /// \code
+    ///     hpx::experimental::continuation_arena arena;
+    ///     hpx::future<int> f =
+    ///         hpx::make_ready_future_alloc<int>(arena.get_allocator(), 42)
+    ///             .then([](hpx::future<int>&& f) { return f.get() + 1; })
+    ///             .then([](hpx::future<int>&& f) { return f.get() * 2; });
+    /// \endcode
+    ///
+    /// \note The memory of the arena is released once the arena object and
+    ///       all shared states allocated from it have been destroyed. Objects
+    ///       of this type can be copied, all copies refer to the same memory.
+    class continuation_arena
+    {
+    public:
+        /// The size of the memory blocks used by default
+        static constexpr std::size_t default_block_size = 4096;
+
+        /// Create a new arena allocating memory in blocks of the given size
+        explicit continuation_arena(
+            std::size_t block_size = default_block_size)
+          : data_(new lcos::detail::continuation_arena_data(block_size), false)
+        {
+        }
+
+        /// Return an allocator drawing its memory from this arena
+        template <typename T = char>
+        [[nodiscard]] continuation_arena_allocator<T> get_allocator()
+            const noexcept
+        {
+            return continuation_arena_allocator<T>(data_);
+        }
+
+        /// Return the number of memory blocks allocated by this arena
+        [[nodiscard]] std::size_t num_blocks() const noexcept
+        {
+            return data_->num_blocks();
+        }
+
+        /// Return the number of allocations served from the memory blocks of
+        /// this arena that have not been released yet
+        [[nodiscard]] std::size_t num_allocations() const noexcept
+        {
+            return data_->num_allocations();
+        }
+
+    private:
+        hpx::intrusive_ptr<lcos::detail::continuation_arena_data> data_;
+    };
+}    // namespace hpx::experimental
+
+namespace hpx::lcos::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the arena used by the given allocator, if any.
+    template <typename Allocator>
+    constexpr continuation_arena_data* get_continuation_arena(
+        Allocator const&) noexcept
+    {
+        return nullptr;
+    }
+
+    template <typename T>
+    continuation_arena_data* get_continuation_arena(
+        hpx::experimental::continuation_arena_allocator<T> const&
+            alloc) noexcept
+    {
+        return alloc.arena();
+    }
+}    // namespace hpx::lcos::detail
@@ -12,6 +12,7 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/continuation_arena.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -27,6 +28,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -95,6 +97,15 @@ namespace hpx::lcos::detail {
             delete this;
         }
 
+        // Return the arena this shared state was allocated from (if any).
+        // Continuations attached using then() are allocated from the same
+        // arena.
+        virtual continuation_arena_data* get_continuation_arena()
+            const noexcept
+        {
+            return nullptr;
+        }
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
@@ -241,7 +252,7 @@ namespace hpx::lcos::detail {
 
         ~future_data_base() override;
 
-        enum state
+        enum state : std::uint8_t
         {
             empty = 0,
             ready = 1,
@@ -258,12 +269,12 @@ namespace hpx::lcos::detail {
 
         bool has_value() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == value;
+            return get_state() == value;
         }
 
         bool has_exception() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == exception;
+            return get_state() == exception;
         }
 
         virtual void execute_deferred(error_code& /*ec*/ = throws) {}
@@ -310,19 +321,57 @@ namespace hpx::lcos::detail {
 
         void reserve_callbacks(std::size_t capacity)
         {
-            on_completed_.reserve(capacity);
+            // the first continuation is stored inline
+            if (capacity > 1)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                get_more_on_completed().reserve(capacity - 1);
+            }
         }
 
     protected:
+        // Flags stored in state_ in addition to the state of the result. Most
+        // futures have at most one continuation and are never waited on. The
+        // first continuation is therefore stored inline without acquiring
+        // mtx_. Only waiting threads (cond_) and any additional continuations
+        // (stored in the lazily allocated more_on_completed_) are protected
+        // by mtx_.
+        enum state_flags : std::uint8_t
+        {
+            state_mask = 7,
+            continuation_pending = 8,    // on_completed_ is being assigned
+            has_continuation = 16,       // on_completed_ holds a continuation
+            has_waiters = 32             // mtx_ needs to be acquired
+        };
+
+        state get_state(
+            std::memory_order order = std::memory_order_acquire) const noexcept
+        {
+            return static_cast<state>(state_.load(order) & state_mask);
+        }
+
+        // Make the future ready by switching to the given state, wake up all
+        // waiting threads, and invoke all registered continuations. The
+        // value or exception must have been stored already.
+        void set_state(state s, char const* caller);
+
+        // Announce that cond_ and more_on_completed_ need to be inspected
+        // once the future gets ready, returns the state of the result before
+        // doing so. This requires for mtx_ to be held.
+        state register_waiter() noexcept;
+
+        completed_callback_vector_type& get_more_on_completed();
+
         // try to perform scoped execution of the associated thread (if any)
         bool execute_thread();
 
     protected:
         mutable mutex_type mtx_;
-        std::atomic<state> state_;    // current state
+        std::atomic<std::uint8_t> state_;    // current state and state_flags
 
-        completed_callback_vector_type on_completed_;
-        local::detail::condition_variable cond_;    // threads waiting in read
+        completed_callback_type on_completed_;    // first continuation
+        std::unique_ptr<completed_callback_vector_type> more_on_completed_;
+        local::detail::condition_variable cond_;    // threads waiting
         threads::thread_id_ref_type runs_child_;
     };
 
@@ -451,71 +500,9 @@ namespace hpx::lcos::detail {
             // NOLINTNEXTLINE(bugprone-multi-level-implicit-pointer-conversion)
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-            [[maybe_unused]] util::ignore_while_checking<decltype(l)> il(&l);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'value' at this
-            // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
-                    "future_data_base::set_value",
-                    "data has already been set for this future");
-            }
-
-            // reset runs_child_ thread id to avoid keeping the thread
-            // alive as long as the future
-            this->base_type::runs_child_.reset();
-
-            // 26111: Caller failing to release lock 'this->mtx_'
-            // 26115: Failing to release lock 'this->mtx_'
-            // 26800: Use of a moved from object 'l'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26111 26115 26800)
-#endif
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know:
-            //
-            //       a. that most of the time we have at most one thread
-            //          waiting on the future (most futures are not shared), and
-            //       b. our implementation of condition_variable::notify_one
-            //          relinquishes the lock before resuming the waiting thread
-            //          that avoids suspension of this thread when it tries to
-            //          re-lock the mutex while exiting from
-            //          condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-            il.reset_owns_registration();
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
-
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
+            // make the value visible to all other threads, this runs all
+            // continuations
+            this->base_type::set_state(value, "future_data_base::set_value");
         }
 
         void set_exception(std::exception_ptr data) override
@@ -533,71 +520,10 @@ namespace hpx::lcos::detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             hpx::construct_at(exception_ptr, HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-            [[maybe_unused]] util::ignore_while_checking<decltype(l)> il(&l);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'exception' at this
-            // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
-                    "future_data_base::set_exception",
-                    "data has already been set for this future");
-            }
-
-            // reset runs_child_ thread id to avoid keeping the thread
-            // alive as long as the future
-            this->base_type::runs_child_.reset();
-
-            // 26111: Caller failing to release lock 'this->mtx_'
-            // 26115: Failing to release lock 'this->mtx_'
-            // 26800: Use of a moved from object 'l'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26111 26115 26800)
-#endif
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know:
-            //
-            //       a. that most of the time we have at most one thread
-            //          waiting on the future (most futures are not shared), and
-            //       b. our implementation of condition_variable::notify_one
-            //          relinquishes the lock before resuming the waiting thread
-            //          that avoids suspension of this thread when it tries to
-            //          re-lock the mutex while exiting from
-            //          condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-            il.reset_owns_registration();
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
-
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
+            // make the exception visible to all other threads, this runs all
+            // continuations
+            this->base_type::set_state(
+                exception, "future_data_base::set_exception");
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -645,7 +571,8 @@ namespace hpx::lcos::detail {
             // and no reader
 
             // release any stored data and callback functions
-            switch (state_.exchange(empty, std::memory_order_relaxed))
+            switch (static_cast<state>(
+                state_.exchange(empty, std::memory_order_relaxed) & state_mask))
             {
             case value:
             {
@@ -666,12 +593,16 @@ namespace hpx::lcos::detail {
                 break;
             }
 
-            on_completed_.clear();
+            on_completed_.reset();
+            if (more_on_completed_)
+            {
+                more_on_completed_->clear();
+            }
         }
 
         std::exception_ptr get_exception_ptr() const override
         {
-            HPX_ASSERT(state_.load(std::memory_order_acquire) == exception);
+            HPX_ASSERT(this->get_state() == exception);
             return *reinterpret_cast<std::exception_ptr const*>(&storage_);
         }
 
@@ -681,7 +612,6 @@ namespace hpx::lcos::detail {
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         future_data_storage_t<Result> storage_;
     };
 
@@ -771,6 +701,12 @@ namespace hpx::lcos::detail {
 
         // NOLINTEND(bugprone-crtp-constructor-accessibility)
 
+        continuation_arena_data* get_continuation_arena()
+            const noexcept override
+        {
+            return detail::get_continuation_arena(alloc_);
+        }
+
     protected:
         void destroy() noexcept override
         {
@@ -22,6 +22,7 @@
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
 #include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/futures/continuation_arena.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
@@ -400,6 +401,15 @@ namespace hpx::lcos::detail {
                 return result_type();
             }
 
+            // continuations of futures allocated from an arena are allocated
+            // from the same arena
+            if (auto* arena = fut.shared_state_->get_continuation_arena())
+            {
+                return future_then_dispatch<std::decay_t<F>>::call_alloc(
+                    hpx::experimental::continuation_arena_allocator<>(arena),
+                    HPX_MOVE(fut), HPX_FORWARD(F, f));
+            }
+
             return future_then_dispatch<std::decay_t<F>>::call_alloc(
                 allocator_type{}, HPX_MOVE(fut), HPX_FORWARD(F, f));
         }
@@ -428,6 +438,15 @@ namespace hpx::lcos::detail {
                 return result_type();
             }
 
+            // continuations of futures allocated from an arena are allocated
+            // from the same arena
+            if (auto* arena = fut.shared_state_->get_continuation_arena())
+            {
+                return future_then_dispatch<std::decay_t<T0>>::call_alloc(
+                    hpx::experimental::continuation_arena_allocator<>(arena),
+                    HPX_MOVE(fut), HPX_FORWARD(T0, t0), HPX_FORWARD(F, f));
+            }
+
             return future_then_dispatch<std::decay_t<T0>>::call_alloc(
                 allocator_type{}, HPX_MOVE(fut), HPX_FORWARD(T0, t0),
                 HPX_FORWARD(F, f));
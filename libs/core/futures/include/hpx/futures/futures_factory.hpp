@@ -233,6 +233,12 @@ namespace hpx::lcos::local {
 
             ~task_object_allocator() override = default;
 
+            lcos::detail::continuation_arena_data* get_continuation_arena()
+                const noexcept override
+            {
+                return lcos::detail::get_continuation_arena(alloc_);
+            }
+
         private:
             void destroy() noexcept override
             {
@@ -423,6 +429,12 @@ namespace hpx::lcos::local {
 
             ~cancelable_task_object_allocator() = default;
 
+            lcos::detail::continuation_arena_data* get_continuation_arena()
+                const noexcept override
+            {
+                return lcos::detail::get_continuation_arena(alloc_);
+            }
+
         private:
             void destroy() noexcept override
             {
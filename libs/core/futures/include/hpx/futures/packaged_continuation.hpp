@@ -325,12 +325,15 @@ namespace hpx::lcos::detail {
                     "the future to attach has no valid shared state");
             }
 
+            // Only capture what is needed to run the continuation, this keeps
+            // the stored callback small enough to avoid an allocation.
+            bool const is_async = hpx::detail::has_async_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
-                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
-                    policy = HPX_FORWARD(Policy, policy),
+                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state), is_async,
                     spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (is_async)
                     {
                         this_->template async<Unwrap>(
                             HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
@@ -375,6 +378,12 @@ namespace hpx::lcos::detail {
         {
         }
 
+        continuation_arena_data* get_continuation_arena()
+            const noexcept override
+        {
+            return detail::get_continuation_arena(alloc_);
+        }
+
     private:
         void destroy() noexcept override
         {
@@ -515,6 +524,12 @@ namespace hpx::lcos::detail {
         {
         }
 
+        continuation_arena_data* get_continuation_arena()
+            const noexcept override
+        {
+            return detail::get_continuation_arena(alloc_);
+        }
+
     private:
         void destroy() noexcept override
         {
@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/continuation_arena.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace hpx::lcos::detail {
+
+    namespace {
+
+        constexpr std::size_t align_up(
+            std::size_t offset, std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+    }    // namespace
+
+    continuation_arena_data::continuation_arena_data(std::size_t block_size)
+      : block_size_(align_up(block_size, __STDCPP_DEFAULT_NEW_ALIGNMENT__))
+      , count_(1)
+    {
+    }
+
+    continuation_arena_data::~continuation_arena_data()
+    {
+        HPX_ASSERT(allocated_ == 0);
+        for (char* block : blocks_)
+        {
+            ::operator delete(block);
+        }
+    }
+
+    void* continuation_arena_data::allocate(
+        std::size_t bytes, std::size_t alignment)
+    {
+        if (!served_by_arena(bytes, alignment))
+        {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        std::size_t offset = align_up(offset_, alignment);
+        if (blocks_.empty() || offset + bytes > block_size_)
+        {
+            // continue with the next block, allocate a new one if needed,
+            // the state of the arena is modified only once this succeeded
+            std::size_t const next = blocks_.empty() ? 0 : current_ + 1;
+            if (next == blocks_.size())
+            {
+                blocks_.reserve(blocks_.size() + 1);
+                char* block = static_cast<char*>(::operator new(block_size_));
+                blocks_.push_back(block);    // doesn't throw, see reserve
+            }
+            current_ = next;
+            offset = 0;
+        }
+
+        offset_ = offset + bytes;
+        ++allocated_;
+        return blocks_[current_] + offset;
+    }
+
+    void continuation_arena_data::deallocate(
+        void* p, std::size_t bytes, std::size_t alignment) noexcept
+    {
+        if (!served_by_arena(bytes, alignment))
+        {
+            ::operator delete(p, std::align_val_t(alignment));
+            return;
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // all blocks can be reused once the last allocation was released
+        HPX_ASSERT(allocated_ != 0);
+        if (--allocated_ == 0)
+        {
+            current_ = 0;
+            offset_ = 0;
+        }
+    }
+
+    std::size_t continuation_arena_data::num_blocks() const noexcept
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return blocks_.size();
+    }
+
+    std::size_t continuation_arena_data::num_allocations() const noexcept
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return allocated_;
+    }
+}    // namespace hpx::lcos::detail
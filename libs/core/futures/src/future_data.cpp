@@ -20,7 +20,9 @@
 #include <hpx/modules/memory.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -120,8 +122,7 @@ namespace hpx::lcos::detail {
             return false;
         }
 
-        auto const state = this->state_.load(std::memory_order_acquire);
-        if (state != future_data_base::empty)
+        if (get_state() != future_data_base::empty)
         {
             return false;
         }
@@ -178,7 +179,7 @@ namespace hpx::lcos::detail {
         // thread was suspended, in this case we need to load it again.
         if (s == empty)
         {
-            s = state_.load(std::memory_order_relaxed);
+            s = get_state(std::memory_order_relaxed);
         }
 
         if (s == value)
@@ -327,25 +328,168 @@ namespace hpx::lcos::detail {
             return;
 
         hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
-        if (is_ready(std::memory_order_relaxed))
+
+        // The first continuation is stored inline, this does not require
+        // acquiring the lock. The slot is reserved first to prevent concurrent
+        // attempts to attach a continuation from both succeeding.
+        std::uint8_t s = state_.load(std::memory_order_acquire);
+        while ((s & ready) == 0 &&
+            (s & (continuation_pending | has_continuation)) == 0)
+        {
+            if (state_.compare_exchange_weak(s, s | continuation_pending,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                on_completed_ = HPX_MOVE(data_sink);
+
+                // publish the continuation, if the future became ready in the
+                // meantime the continuation has to be invoked right away
+                s = state_.fetch_xor(continuation_pending | has_continuation,
+                    std::memory_order_acq_rel);
+                if ((s & ready) != 0)
+                {
+                    completed_callback_type on_completed =
+                        HPX_MOVE(on_completed_);
+                    on_completed_.reset();
+                    handle_on_completed_impl(HPX_MOVE(on_completed));
+                }
+                return;
+            }
+        }
+
+        if ((s & ready) != 0)
         {
             // invoke the callback (continuation) function right away
             handle_on_completed_impl(HPX_MOVE(data_sink));
+            return;
+        }
+
+        // any additional continuation is stored in more_on_completed_
+        std::unique_lock l(mtx_);
+        if (register_waiter() != empty)
+        {
+            l.unlock();
+
+            // invoke the callback (continuation) function
+            handle_on_completed_impl(HPX_MOVE(data_sink));
         }
         else
         {
-            std::unique_lock l(mtx_);
-            if (is_ready())
+            get_more_on_completed().push_back(HPX_MOVE(data_sink));
+        }
+    }
+
+    auto future_data_base<traits::detail::future_data_void>::
+        get_more_on_completed() -> completed_callback_vector_type&
+    {
+        if (!more_on_completed_)
+        {
+            more_on_completed_ =
+                std::make_unique<completed_callback_vector_type>();
+        }
+        return *more_on_completed_;
+    }
+
+    future_data_base<traits::detail::future_data_void>::state
+    future_data_base<traits::detail::future_data_void>::
+        register_waiter() noexcept
+    {
+        // If the future is not ready yet, set_state will observe the flag and
+        // will acquire the lock before inspecting cond_ and
+        // more_on_completed_. Blocking on the future does not allocate.
+        return static_cast<state>(
+            state_.fetch_or(has_waiters, std::memory_order_acq_rel) &
+            state_mask);
+    }
+
+    void future_data_base<traits::detail::future_data_void>::set_state(
+        state const new_state, char const* caller)
+    {
+        HPX_ASSERT((new_state & ready) != 0);
+
+        // Changing the state at this point signals to all other threads that
+        // this future is ready.
+        std::uint8_t s = state_.load(std::memory_order_relaxed);
+        do
+        {
+            if ((s & state_mask) != empty)
             {
-                l.unlock();
+                // this future should be 'empty' still (it can't be made ready
+                // more than once).
+                HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
+                    caller, "data has already been set for this future");
+            }
+        } while (!state_.compare_exchange_weak(s, s | new_state,
+            std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        // reset runs_child_ thread id to avoid keeping the thread
+        // alive as long as the future
+        runs_child_.reset();
+
+        // A continuation that is still being attached concurrently will be
+        // invoked by set_on_completed.
+        completed_callback_type on_completed;
+        if ((s & has_continuation) != 0)
+        {
+            on_completed = HPX_MOVE(on_completed_);
+            on_completed_.reset();
+        }
+
+        // Threads waiting for the future or additional continuations require
+        // acquiring the lock.
+        completed_callback_vector_type on_completed_vector;
+        if ((s & has_waiters) != 0)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            [[maybe_unused]] util::ignore_while_checking<decltype(l)> il(&l);
 
-                // invoke the callback (continuation) function
-                handle_on_completed_impl(HPX_MOVE(data_sink));
+            if (more_on_completed_)
+            {
+                on_completed_vector = HPX_MOVE(*more_on_completed_);
+                more_on_completed_->clear();
             }
-            else
+
+            // 26111: Caller failing to release lock 'this->mtx_'
+            // 26115: Failing to release lock 'this->mtx_'
+            // 26800: Use of a moved from object 'l'
+#if defined(HPX_MSVC)
+#pragma warning(push)
+#pragma warning(disable : 26111 26115 26800)
+#endif
+
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know:
+            //
+            //       a. that most of the time we have at most one thread
+            //          waiting on the future (most futures are not shared), and
+            //       b. our implementation of condition_variable::notify_one
+            //          relinquishes the lock before resuming the waiting thread
+            //          that avoids suspension of this thread when it tries to
+            //          re-lock the mutex while exiting from
+            //          condition_variable::wait
+            while (cond_.notify_one(
+                HPX_MOVE(l), threads::thread_priority::boost))
             {
-                on_completed_.push_back(HPX_MOVE(data_sink));
+                l = std::unique_lock<mutex_type>(mtx_);
             }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+            HPX_ASSERT_DOESNT_OWN_LOCK(l);
+            il.reset_owns_registration();
+
+#if defined(HPX_MSVC)
+#pragma warning(pop)
+#endif
+        }
+
+        // invoke the callback (continuation) functions
+        if (on_completed)
+        {
+            handle_on_completed(HPX_MOVE(on_completed));
+        }
+        if (!on_completed_vector.empty())
+        {
+            handle_on_completed(HPX_MOVE(on_completed_vector));
         }
     }
 
@@ -353,13 +497,13 @@ namespace hpx::lcos::detail {
     future_data_base<traits::detail::future_data_void>::wait(error_code& ec)
     {
         // block if this entry is empty
-        state s = state_.load(std::memory_order_acquire);
+        state s = get_state();
         if (s == empty)
         {
             hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
 
             std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            s = register_waiter();
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -369,7 +513,7 @@ namespace hpx::lcos::detail {
                 }
 
                 // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
+                s = get_state(std::memory_order_relaxed);
             }
         }
 
@@ -385,12 +529,12 @@ namespace hpx::lcos::detail {
         std::chrono::steady_clock::time_point const& abs_time, error_code& ec)
     {
         // block if this entry is empty
-        if (state_.load(std::memory_order_acquire) == empty)
+        if (get_state() == empty)
         {
             hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
 
             std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            if (register_waiter() == empty)
             {
                 threads::thread_restart_state const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
@@ -400,7 +544,7 @@ namespace hpx::lcos::detail {
                 }
 
                 if (reason == threads::thread_restart_state::timeout &&
-                    state_.load(std::memory_order_acquire) == empty)
+                    get_state() == empty)
                 {
                     return hpx::future_status::timeout;
                 }
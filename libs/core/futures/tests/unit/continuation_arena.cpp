@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int increment(hpx::future<int>&& f)
+{
+    return f.get() + 1;
+}
+
+// Note: continuations launched asynchronously may release the shared states
+// they refer to only after the result has been retrieved, the number of
+// allocations is verified for synchronously executed continuations only.
+
+void test_ready_future_chain()
+{
+    hpx::experimental::continuation_arena arena;
+    {
+        // all continuations of the chain are allocated from the arena
+        hpx::future<int> f =
+            hpx::make_ready_future_alloc<int>(arena.get_allocator(), 0)
+                .then(hpx::launch::sync, &increment)
+                .then(hpx::launch::sync, &increment);
+
+        HPX_TEST_EQ(arena.num_allocations(), std::size_t(1));
+        HPX_TEST_EQ(f.get(), 2);
+    }
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+    HPX_TEST_EQ(arena.num_blocks(), std::size_t(1));
+
+    // the memory is reused for the next chain
+    {
+        hpx::future<int> f =
+            hpx::make_ready_future_alloc<int>(arena.get_allocator(), 0)
+                .then(hpx::launch::sync, &increment)
+                .then(hpx::launch::sync, &increment)
+                .then(hpx::launch::sync, &increment);
+
+        HPX_TEST_EQ(f.get(), 3);
+    }
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+    HPX_TEST_EQ(arena.num_blocks(), std::size_t(1));
+
+    // asynchronously executed continuations
+    {
+        hpx::future<int> f =
+            hpx::make_ready_future_alloc<int>(arena.get_allocator(), 0)
+                .then(&increment)
+                .then(hpx::launch::async, &increment)
+                .then(hpx::launch::sync, &increment);
+
+        HPX_TEST_EQ(f.get(), 3);
+    }
+}
+
+void test_promise_chain()
+{
+    hpx::experimental::continuation_arena arena(256);
+    {
+        hpx::promise<int> p(std::allocator_arg, arena.get_allocator());
+        HPX_TEST_EQ(arena.num_allocations(), std::size_t(1));
+
+        hpx::future<int> f = p.get_future();
+        for (int i = 0; i != 10; ++i)
+        {
+            f = f.then(hpx::launch::sync, &increment);
+        }
+
+        // the chain spans several blocks
+        HPX_TEST_EQ(arena.num_allocations(), std::size_t(11));
+        HPX_TEST_LT(std::size_t(1), arena.num_blocks());
+
+        p.set_value(0);
+        HPX_TEST_EQ(f.get(), 10);
+    }
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+}
+
+void test_shared_future_chain()
+{
+    hpx::experimental::continuation_arena arena;
+    {
+        hpx::promise<int> p(std::allocator_arg, arena.get_allocator());
+        hpx::shared_future<int> sf = p.get_future();
+
+        std::vector<hpx::future<int>> results;
+        for (int i = 0; i != 10; ++i)
+        {
+            results.push_back(sf.then(hpx::launch::sync,
+                [i](hpx::shared_future<int> const& f) { return f.get() + i; }));
+        }
+        HPX_TEST_EQ(arena.num_allocations(), std::size_t(11));
+
+        p.set_value(42);
+        for (int i = 0; i != 10; ++i)
+        {
+            HPX_TEST_EQ(results[i].get(), 42 + i);
+        }
+    }
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+}
+
+void test_then_alloc()
+{
+    hpx::experimental::continuation_arena arena;
+    {
+        // the chain is moved to the arena by the first continuation
+        hpx::future<int> f = hpx::make_ready_future(0)
+                                 .then_alloc(arena.get_allocator(), &increment)
+                                 .then(&increment);
+
+        HPX_TEST_EQ(f.get(), 2);
+    }
+
+    // the arena outlives the arena object
+    hpx::future<int> f;
+    {
+        hpx::experimental::continuation_arena temp;
+        f = hpx::make_ready_future_alloc<int>(temp.get_allocator(), 1)
+                .then(&increment);
+    }
+    HPX_TEST_EQ(f.get(), 2);
+}
+
+void test_exceptions()
+{
+    hpx::experimental::continuation_arena arena;
+    {
+        hpx::future<int> f =
+            hpx::make_ready_future_alloc<int>(arena.get_allocator(), 0)
+                .then(hpx::launch::sync,
+                    [](hpx::future<int>&&) -> int {
+                        throw std::runtime_error("test");
+                    })
+                .then(hpx::launch::sync, &increment);
+
+        bool caught_exception = false;
+        try
+        {
+            f.get();
+        }
+        catch (std::runtime_error const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+}
+
+void test_allocator()
+{
+    hpx::experimental::continuation_arena arena;
+    hpx::experimental::continuation_arena other;
+
+    auto alloc = arena.get_allocator<int>();
+    HPX_TEST(alloc == arena.get_allocator<double>());
+    HPX_TEST(alloc != other.get_allocator<int>());
+
+    // allocations exceeding the block size are supported
+    std::vector<int, hpx::experimental::continuation_arena_allocator<int>> v(
+        alloc);
+    v.resize(10000, 42);
+    HPX_TEST_EQ(v[9999], 42);
+    HPX_TEST_EQ(arena.num_allocations(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_ready_future_chain();
+    test_promise_chain();
+    test_shared_future_chain();
+    test_then_alloc();
+    test_exceptions();
+    test_allocator();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/thread.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -1288,6 +1289,48 @@ void test_wait_for_all_from_list_iterators()
     }
 }
 
+// attach several continuations and wait from several threads while the
+// shared state is being made ready concurrently
+void test_continuations_and_waiters_race()
+{
+    constexpr int num_attempts = 100;
+    constexpr int num_consumers = 4;
+
+    for (int attempt = 0; attempt != num_attempts; ++attempt)
+    {
+        hpx::promise<int> p;
+        hpx::shared_future<int> sf = p.get_future();
+
+        std::atomic<int> invoked(0);
+        std::vector<hpx::future<int>> consumers;
+        consumers.reserve(2 * num_consumers + 1);
+
+        for (int i = 0; i != num_consumers; ++i)
+        {
+            consumers.push_back(hpx::async([sf, &invoked]() {
+                return sf
+                    .then(hpx::launch::sync,
+                        [&invoked](hpx::shared_future<int>&& f) {
+                            ++invoked;
+                            return f.get();
+                        })
+                    .get();
+            }));
+            consumers.push_back(hpx::async([sf]() { return sf.get(); }));
+        }
+        consumers.push_back(hpx::async([&p]() {
+            p.set_value(42);
+            return 42;
+        }));
+
+        for (auto& f : consumers)
+        {
+            HPX_TEST_EQ(f.get(), 42);
+        }
+        HPX_TEST_EQ(invoked.load(), num_consumers);
+    }
+}
+
 void test_wait_for_all_two_futures()
 {
     hpx::lcos::local::futures_factory<int()> pt1(make_int_slowly);
@@ -1542,6 +1585,7 @@ int hpx_main(variables_map&)
         //         test_wait_for_any_from_range();
         test_wait_for_all_from_list();
         test_wait_for_all_from_list_iterators();
+        test_continuations_and_waiters_race();
         test_wait_for_all_two_futures();
         test_wait_for_all_three_futures();
         test_wait_for_all_four_futures();
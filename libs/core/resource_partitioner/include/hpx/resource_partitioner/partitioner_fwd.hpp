@@ -108,6 +108,8 @@ namespace hpx::resource {
         local_workrequesting_fifo = 8,
         local_workrequesting_lifo = 9,
         local_workrequesting_mc = 10,
+        local_priority_chase_lev = 11,
+        local_priority_critical_path = 12,
     };
 
 #define HPX_SCHEDULING_POLICY_UNSCOPED_ENUM_DEPRECATION_MSG                    \
@@ -141,6 +141,12 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_priority_lifo:
             sched = "local_priority_lifo";
             break;
+        case resource::scheduling_policy::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
+        case resource::scheduling_policy::local_priority_critical_path:
+            sched = "local_priority_critical_path";
+            break;
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         case resource::scheduling_policy::local_workrequesting_fifo:
             sched = "local_workrequesting_fifo";
@@ -492,6 +498,18 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
+        else if (0 ==
+            std::string("local-priority-critical-path")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_critical_path;
+        }
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         else if (0 ==
             std::string("local-workrequesting-fifo")
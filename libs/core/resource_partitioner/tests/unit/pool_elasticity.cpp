@@ -0,0 +1,74 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elasticity controller suspends the processing units of an
+// idle pool and resumes them once work is queued up.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::size_t get_active_count()
+{
+    return hpx::resource::get_thread_pool("default")
+        .get_active_os_thread_count();
+}
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("default");
+    HPX_TEST_LTE(std::size_t(2), num_threads);
+
+    // an idle pool shrinks down to the minimal number of processing units
+    hpx::chrono::high_resolution_timer t;
+    while (get_active_count() != 1 && t.elapsed() < 10.0)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(get_active_count(), std::size_t(1));
+
+    // queued work makes it grow again
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 100 * num_threads; ++i)
+    {
+        futures.push_back(hpx::async([] {
+            hpx::chrono::high_resolution_timer t;
+            while (t.elapsed() < 0.01)
+                ;
+        }));
+    }
+
+    std::size_t max_active = 1;
+    while (!std::all_of(futures.begin(), futures.end(),
+        [](auto const& f) { return f.is_ready(); }))
+    {
+        max_active = (std::max) (max_active, get_active_count());
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_LT(std::size_t(1), max_active);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.elasticity.enable=1", "hpx.elasticity.interval=10",
+        "hpx.elasticity.hysteresis=2", "hpx.elasticity.shrink_utilization=0.5"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
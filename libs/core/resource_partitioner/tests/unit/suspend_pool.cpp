@@ -186,6 +186,8 @@ int main(int argc, char* argv[])
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         hpx::resource::scheduling_policy::local_priority_lifo,
 #endif
+        hpx::resource::scheduling_policy::local_priority_chase_lev,
+        hpx::resource::scheduling_policy::local_priority_critical_path,
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         hpx::resource::scheduling_policy::abp_priority_fifo,
         hpx::resource::scheduling_policy::abp_priority_lifo,
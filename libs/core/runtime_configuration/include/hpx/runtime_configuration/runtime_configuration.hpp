@@ -110,6 +110,13 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // settings controlling the allocation and reclamation of stacks
+        bool use_stack_arenas() const;
+        bool use_huge_page_stacks() const;
+        std::size_t get_stack_arena_size() const;
+        std::string get_stack_reclamation_policy() const;
+        std::size_t get_stack_resident_watermark() const;
 #endif
 
         // return trace_depth for stack-backtraces
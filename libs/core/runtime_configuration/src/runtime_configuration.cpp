@@ -176,6 +176,9 @@ namespace hpx::util {
             "max_idle_backoff_time = "
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
+            "idle_yield_count = "
+            "${HPX_IDLE_YIELD_COUNT:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_IDLE_BACKOFF_YIELD_COUNT)) "}",
 #endif
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
@@ -219,6 +222,11 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_arenas = ${HPX_STACK_USE_ARENAS:0}",
+            "use_huge_pages = ${HPX_STACK_USE_HUGE_PAGES:0}",
+            "arena_size = ${HPX_STACK_ARENA_SIZE:0x400000}",
+            "reclamation = ${HPX_STACK_RECLAMATION:dontneed}",
+            "resident_watermark = ${HPX_STACK_RESIDENT_WATERMARK:0x10000000}",
 #endif
 
             "[hpx.threadpools]",
@@ -262,6 +270,32 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "max_thread_heap_size = "
+            "${HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)) "}",
+            "steal_cache_level = ${HPX_THREAD_QUEUE_STEAL_CACHE_LEVEL:3}",
+            "steal_siblings_backoff = "
+            "${HPX_THREAD_QUEUE_STEAL_SIBLINGS_BACKOFF:0}",
+            "steal_siblings_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_SIBLINGS_BATCH_SIZE:64}",
+            "steal_numa_backoff = ${HPX_THREAD_QUEUE_STEAL_NUMA_BACKOFF:0}",
+            "steal_numa_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_NUMA_BATCH_SIZE:32}",
+            "steal_remote_backoff = "
+            "${HPX_THREAD_QUEUE_STEAL_REMOTE_BACKOFF:16}",
+            "steal_remote_batch_size = "
+            "${HPX_THREAD_QUEUE_STEAL_REMOTE_BATCH_SIZE:8}",
+            "steal_half = ${HPX_THREAD_QUEUE_STEAL_HALF:0}",
+
+            "[hpx.elasticity]",
+            "enable = ${HPX_ELASTICITY_ENABLE:0}",
+            "pools = ${HPX_ELASTICITY_POOLS:}",
+            "interval = ${HPX_ELASTICITY_INTERVAL:100}",
+            "min_threads = ${HPX_ELASTICITY_MIN_THREADS:1}",
+            "max_threads = ${HPX_ELASTICITY_MAX_THREADS:0}",
+            "grow_queue_length = ${HPX_ELASTICITY_GROW_QUEUE_LENGTH:4}",
+            "shrink_utilization = ${HPX_ELASTICITY_SHRINK_UTILIZATION:0.25}",
+            "hysteresis = ${HPX_ELASTICITY_HYSTERESIS:5}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -1106,6 +1140,49 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_arenas() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_arenas", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::use_huge_page_stacks() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_stack_arena_size() const
+    {
+        return static_cast<std::size_t>(
+            init_stack_size("arena_size", "0x400000", 0x400000));
+    }
+
+    std::string runtime_configuration::get_stack_reclamation_policy() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return sec->get_entry("reclamation", "dontneed");
+        }
+        return "dontneed";
+    }
+
+    std::size_t runtime_configuration::get_stack_resident_watermark() const
+    {
+        return static_cast<std::size_t>(init_stack_size(
+            "resident_watermark", "0x10000000", 0x10000000));
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -221,6 +221,83 @@ namespace hpx::threads::policies {
         }
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_allocated_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    count += high_priority_queues_[i]
+                                 .data_->get_num_allocated_threads(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += bound_queues_[i].data_->get_num_allocated_threads(
+                        reset);
+                    count += queues_[i].data_->get_num_allocated_threads(reset);
+                }
+                return count +
+                    low_priority_queue_.get_num_allocated_threads(reset);
+            }
+
+            count += bound_queues_[num_thread].data_->get_num_allocated_threads(
+                reset);
+            count +=
+                queues_[num_thread].data_->get_num_allocated_threads(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                count += high_priority_queues_[num_thread]
+                             .data_->get_num_allocated_threads(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_num_allocated_threads(reset);
+            }
+            return count;
+        }
+
+        std::int64_t get_num_reused_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    count += high_priority_queues_[i]
+                                 .data_->get_num_reused_threads(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count +=
+                        bound_queues_[i].data_->get_num_reused_threads(reset);
+                    count += queues_[i].data_->get_num_reused_threads(reset);
+                }
+                return count +
+                    low_priority_queue_.get_num_reused_threads(reset);
+            }
+
+            count +=
+                bound_queues_[num_thread].data_->get_num_reused_threads(reset);
+            count += queues_[num_thread].data_->get_num_reused_threads(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                count += high_priority_queues_[num_thread]
+                             .data_->get_num_reused_threads(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_num_reused_threads(reset);
+            }
+            return count;
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) override
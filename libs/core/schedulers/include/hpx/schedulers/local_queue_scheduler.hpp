@@ -155,6 +155,39 @@ namespace hpx::threads::policies {
         }
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_allocated_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_allocated = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    num_allocated +=
+                        queues_[i]->get_num_allocated_threads(reset);
+
+                return num_allocated;
+            }
+
+            return queues_[num_thread]->get_num_allocated_threads(reset);
+        }
+
+        std::int64_t get_num_reused_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_reused = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    num_reused += queues_[i]->get_num_reused_threads(reset);
+
+                return num_reused;
+            }
+
+            return queues_[num_thread]->get_num_reused_threads(reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) override
@@ -21,6 +21,7 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -87,6 +88,11 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// By default, workers adaptively switch between requesting a single task and
+// requesting half of the victim's tasks. Setting hpx.thread_queue.steal_half=1
+// makes every steal request transfer half of the victim's staged and pending
+// tasks in a single message.
 
 namespace hpx::threads::policies {
 
@@ -144,6 +150,10 @@ namespace hpx::threads::policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+
+            // always request half of the victim's tasks instead of adaptively
+            // switching between steal-one and steal-half
+            bool steal_half_ = false;
         };
 
         struct workrequesting_task_data
@@ -309,6 +319,12 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_sent_ = 0;
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
+#endif
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // number of steal requests answered with tasks and the overall
+            // number of tasks received that way
+            std::atomic<std::int64_t> num_steals_{0};
+            std::atomic<std::int64_t> num_stolen_tasks_{0};
 #endif
         };
 
@@ -325,6 +341,7 @@ namespace hpx::threads::policies {
           , affinity_data_(init.affinity_data_)
           , num_queues_(init.num_queues_)
           , num_high_priority_queues_(init.num_high_priority_queues_)
+          , steal_half_(init.steal_half_)
         {
             HPX_ASSERT(init.num_queues_ != 0);
             HPX_ASSERT(num_high_priority_queues_ != 0);
@@ -395,6 +412,81 @@ namespace hpx::threads::policies {
         }
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        std::int64_t get_num_allocated_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    auto const& d = data_[i].data_;
+                    if (i < num_high_priority_queues_)
+                    {
+                        count +=
+                            d.high_priority_queue_->get_num_allocated_threads(
+                                reset);
+                    }
+                    count += d.queue_->get_num_allocated_threads(reset);
+                    count += d.bound_queue_->get_num_allocated_threads(reset);
+                }
+
+                return count +
+                    low_priority_queue_.get_num_allocated_threads(reset);
+            }
+
+            auto const& d = data_[num_thread].data_;
+            if (num_thread < num_high_priority_queues_)
+            {
+                count +=
+                    d.high_priority_queue_->get_num_allocated_threads(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_num_allocated_threads(reset);
+            }
+            count += d.queue_->get_num_allocated_threads(reset);
+            return count + d.bound_queue_->get_num_allocated_threads(reset);
+        }
+
+        std::int64_t get_num_reused_threads(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    auto const& d = data_[i].data_;
+                    if (i < num_high_priority_queues_)
+                    {
+                        count +=
+                            d.high_priority_queue_->get_num_reused_threads(
+                                reset);
+                    }
+                    count += d.queue_->get_num_reused_threads(reset);
+                    count += d.bound_queue_->get_num_reused_threads(reset);
+                }
+
+                return count +
+                    low_priority_queue_.get_num_reused_threads(reset);
+            }
+
+            auto const& d = data_[num_thread].data_;
+            if (num_thread < num_high_priority_queues_)
+            {
+                count += d.high_priority_queue_->get_num_reused_threads(reset);
+            }
+            if (num_thread == num_queues_ - 1)
+            {
+                count += low_priority_queue_.get_num_reused_threads(reset);
+            }
+            count += d.queue_->get_num_reused_threads(reset);
+            return count + d.bound_queue_->get_num_reused_threads(reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) override
@@ -615,6 +707,34 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        std::int64_t get_average_tasks_per_steal(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_steals = 0;
+            std::int64_t num_stolen_tasks = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    auto& d = data_[i].data_;
+                    num_steals += util::get_and_reset_value(d.num_steals_, reset);
+                    num_stolen_tasks +=
+                        util::get_and_reset_value(d.num_stolen_tasks_, reset);
+                }
+            }
+            else
+            {
+                auto& d = data_[num_thread].data_;
+                num_steals = util::get_and_reset_value(d.num_steals_, reset);
+                num_stolen_tasks =
+                    util::get_and_reset_value(d.num_stolen_tasks_, reset);
+            }
+
+            if (num_steals == 0)
+                return 0;
+            return num_stolen_tasks / num_steals;
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -886,9 +1006,20 @@ namespace hpx::threads::policies {
             std::size_t max_num_to_steal = 1;
             if (req.stealhalf_)
             {
-                max_num_to_steal = d.queue_->get_pending_queue_length(
-                                       std::memory_order_relaxed) /
-                    2;
+                // staged tasks count as well, convert as many of those as
+                // needed to be able to hand over half of all our work in one
+                // go
+                std::int64_t const pending = d.queue_->get_pending_queue_length(
+                    std::memory_order_relaxed);
+                std::int64_t const staged = d.queue_->get_staged_queue_length(
+                    std::memory_order_relaxed);
+
+                std::int64_t const half = (pending + staged) / 2;
+                if (half > pending)
+                {
+                    d.queue_->convert_staged_tasks(half - pending);
+                }
+                max_num_to_steal = static_cast<std::size_t>(half);
             }
 
             if (max_num_to_steal != 0)
@@ -896,19 +1027,16 @@ namespace hpx::threads::policies {
                 task_data thrds(d.num_thread_);
                 thrds.tasks_.reserve(max_num_to_steal);
 
-#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                 thread_id_ref_type thrd;
                 while (max_num_to_steal-- != 0 &&
                     d.queue_->get_next_thread(thrd, false, true))
                 {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                     d.queue_->increment_num_stolen_from_pending();
+#endif
                     thrds.tasks_.push_back(HPX_MOVE(thrd));
                     thrd = thread_id_ref_type{};
                 }
-#else
-                d.queue_->get_next_threads(
-                    thrds.tasks_.begin(), thrds.tasks_.size(), false, true);
-#endif
 
                 // we are ready to send at least one task
                 if (!thrds.tasks_.empty())
@@ -1582,7 +1710,11 @@ namespace hpx::threads::policies {
             {
                 // Estimate work-stealing efficiency during the last interval;
                 // switch strategies if the value is below a threshold
-                if (d.num_recent_steals_ >=
+                if (steal_half_)
+                {
+                    d.stealhalf_ = true;
+                }
+                else if (d.num_recent_steals_ >=
                     scheduler_data::num_steal_adaptive_interval_)
                 {
                     double const ratio =
@@ -1638,6 +1770,12 @@ namespace hpx::threads::policies {
                 // if at least one thrd was received
                 if (!thrds.tasks_.empty())
                 {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    d.num_steals_.fetch_add(1, std::memory_order_relaxed);
+                    d.num_stolen_tasks_.fetch_add(
+                        static_cast<std::int64_t>(thrds.tasks_.size()),
+                        std::memory_order_relaxed);
+#endif
                     // Schedule all but the first received task in reverse order
                     // to maintain the sequence of tasks as pulled from the
                     // victims queue.
@@ -1881,6 +2019,7 @@ namespace hpx::threads::policies {
         detail::affinity_data const& affinity_data_;
         std::size_t const num_queues_;
         std::size_t const num_high_priority_queues_;
+        bool const steal_half_;
     };
 }    // namespace hpx::threads::policies
 
@@ -20,8 +20,13 @@
 #include <hpx/allocator_support/aligned_allocator.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -166,6 +171,265 @@ namespace hpx::threads::policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque (LIFO for the owner, FIFO for thieves).
+    //
+    // The queue is owned by the worker thread it was started on (see
+    // on_start_thread), identified by its pool and local thread number. Only
+    // the owner pushes to and pops from the bottom end of the bounded ring,
+    // which avoids any CAS on the common path. All other threads steal from
+    // the top end.
+    //
+    // Pushes from non-owning threads, pushes that find the ring full, and
+    // pushes to the other end (threads rescheduled through
+    // schedule_thread_last, e.g. after yielding) go to an unbounded FIFO
+    // inject queue. The owner drains it only after its ring is empty, so that
+    // a yielding thread is not immediately picked up again.
+    struct lockfree_chase_lev;
+
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = hpx::lockfree::chase_lev_deque<T>;
+        using inject_container_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        // minimal number of slots in the bounded ring
+        static constexpr std::size_t min_ring_capacity = 1024;
+
+        explicit lockfree_chase_lev_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : queue_((std::max) (static_cast<std::size_t>(initial_size),
+                min_ring_capacity))
+          , inject_(static_cast<std::size_t>(initial_size))
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner() && queue_.push(val))
+                return true;
+            return inject_.enqueue(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner() && queue_.push(val))
+                return true;
+            return inject_.enqueue(HPX_MOVE(val));
+        }
+
+        bool pop(reference val, bool steal = true) noexcept
+        {
+            if (!steal && is_owner())
+            {
+                if (queue_.pop(val))
+                    return true;
+            }
+            else if (queue_.steal(val))
+            {
+                return true;
+            }
+            return inject_.try_dequeue(val);
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inject_.size_approx() == 0;
+        }
+
+        // Make the worker thread calling this the owner of the ring. Must be
+        // called on the worker thread itself after its thread numbers have
+        // been stored in thread local storage.
+        void on_start_thread(std::size_t num_thread) noexcept
+        {
+            owner_.store(make_owner(threads::detail::get_thread_pool_num_tss(),
+                             num_thread),
+                std::memory_order_release);
+        }
+
+        // Items left in the ring can still be stolen by everybody.
+        void on_stop_thread(std::size_t /* num_thread */) noexcept
+        {
+            owner_.store(no_owner, std::memory_order_release);
+        }
+
+    private:
+        static constexpr std::uint64_t no_owner = static_cast<std::uint64_t>(-1);
+
+        static constexpr std::uint64_t make_owner(
+            std::size_t pool_num, std::size_t num_thread) noexcept
+        {
+            return (static_cast<std::uint64_t>(pool_num) << 32) |
+                (static_cast<std::uint64_t>(num_thread) & 0xffffffff);
+        }
+
+        bool is_owner() const noexcept
+        {
+            std::uint64_t const owner = owner_.load(std::memory_order_acquire);
+            return owner != no_owner &&
+                owner ==
+                make_owner(threads::detail::get_thread_pool_num_tss(),
+                    threads::detail::get_local_thread_num_tss());
+        }
+
+        container_type queue_;
+        inject_container_type inject_;
+        std::atomic<std::uint64_t> owner_{no_owner};
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Extract the critical-path hint (see thread_schedule_hint) from the
+        // items stored in the queues of a thread_queue: threads, threads
+        // wrapped for measuring their wait time, and staged tasks.
+        template <typename T,
+            typename Enable = std::enable_if_t<std::is_convertible_v<T,
+                threads::detail::thread_data_reference_counting const*>>>
+        std::uint16_t get_criticality(T const& val, int) noexcept
+        {
+            return static_cast<thread_data const*>(val)->get_criticality();
+        }
+
+        template <typename T>
+        auto get_criticality(T const& val, long) noexcept
+            -> decltype(get_thread_id_data(val->data)->get_criticality())
+        {
+            return get_thread_id_data(val->data)->get_criticality();
+        }
+
+        template <typename T>
+        auto get_criticality(T const& val, long) noexcept
+            -> decltype(val->data.schedulehint.criticality)
+        {
+            return val->data.schedulehint.criticality;
+        }
+
+        template <typename T>
+        constexpr std::uint16_t get_criticality(T const&, ...) noexcept
+        {
+            return 0;
+        }
+    }    // namespace detail
+
+    // A bucketed priority queue ordering its items by their critical-path
+    // hint. Items are sorted into buckets by the position of the most
+    // significant bit of their hint (bucket zero holds all items without a
+    // hint). Each bucket is a FIFO, pop() takes from the highest non-empty
+    // bucket. A bit mask of the (possibly) non-empty buckets avoids scanning
+    // all of them.
+    template <typename T>
+    struct lockfree_critical_path_backend
+    {
+        using bucket_type = lockfree_fifo_backend<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        static constexpr std::size_t num_buckets = 17;
+
+        explicit lockfree_critical_path_backend(size_type /* initial_size */ = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+        {
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            std::size_t const bucket = bucket_of(val);
+            if (!buckets_[bucket].push(val))
+                return false;
+            non_empty_.fetch_or(std::uint32_t(1) << bucket);
+            return true;
+        }
+
+        bool push(rvalue_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            std::size_t const bucket = bucket_of(val);
+            if (!buckets_[bucket].push(HPX_MOVE(val)))
+                return false;
+            non_empty_.fetch_or(std::uint32_t(1) << bucket);
+            return true;
+        }
+
+        bool pop(reference val, bool /* steal */ = true) noexcept
+        {
+            std::uint32_t mask = non_empty_.load(std::memory_order_acquire);
+            while (mask != 0)
+            {
+                std::size_t bucket = num_buckets - 1;
+                while ((mask & (std::uint32_t(1) << bucket)) == 0)
+                    --bucket;
+
+                if (buckets_[bucket].pop(val))
+                    return true;
+
+                // The bucket was found empty, clear its bit. Re-set the bit
+                // if an item was pushed concurrently, as the corresponding
+                // push may have set the bit before it was cleared here.
+                std::uint32_t const bit = std::uint32_t(1) << bucket;
+                non_empty_.fetch_and(~bit);
+                if (!buckets_[bucket].empty())
+                    non_empty_.fetch_or(bit);
+
+                mask &= ~bit;
+            }
+            return false;
+        }
+
+        bool empty() noexcept
+        {
+            return non_empty_.load(std::memory_order_relaxed) == 0;
+        }
+
+    private:
+        static std::size_t bucket_of(const_reference val) noexcept
+        {
+            std::uint16_t criticality = detail::get_criticality(val, 0);
+
+            std::size_t bucket = 0;
+            while (criticality != 0)
+            {
+                ++bucket;
+                criticality >>= 1;
+            }
+            return bucket;
+        }
+
+        bucket_type buckets_[num_buckets];
+        std::atomic<std::uint32_t> non_empty_{0};
+    };
+
+    struct lockfree_critical_path
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_critical_path_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/debugging.hpp>
 #include <hpx/modules/errors.hpp>
@@ -25,7 +26,9 @@
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -37,6 +40,7 @@
 #include <numeric>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -94,6 +98,147 @@ namespace hpx::threads::policies {
         std::size_t low_priority;
     };
 
+    // The levels of the memory hierarchy an idle worker steals from, in the
+    // order they are visited.
+    enum class steal_level : std::uint8_t
+    {
+        siblings = 0,    // cores sharing a cache with the thief
+        numa_domain = 1,    // other cores on the NUMA domain of the thief
+        remote_domains = 2,    // cores on other NUMA domains
+    };
+
+    inline constexpr std::size_t num_steal_levels = 3;
+
+    // Per-level stealing parameters
+    struct steal_level_parameters
+    {
+        // number of consecutive unsuccessful attempts to find work on the
+        // closer levels before this level is visited
+        std::size_t backoff;
+
+        // maximal number of staged tasks converted by one steal operation
+        std::size_t batch_size;
+    };
+
+    // Holds the parameters of the hierarchical stealing policy used by the
+    // shared_priority_queue_scheduler.
+    struct steal_hierarchy_parameters
+    {
+        // cores attached to the same cache of this level are considered to be
+        // siblings, zero disables the sibling level
+        int cache_level = 3;
+
+        std::array<steal_level_parameters, num_steal_levels> levels = {
+            {{0, 64}, {0, 32}, {16, 8}}};
+
+        constexpr steal_level_parameters const& operator[](
+            steal_level l) const noexcept
+        {
+            return levels[static_cast<std::size_t>(l)];
+        }
+    };
+
+    // a queue to steal from
+    struct steal_victim
+    {
+        std::size_t domain;
+        std::size_t q_index;
+
+        friend constexpr bool operator==(
+            steal_victim const& lhs, steal_victim const& rhs) noexcept
+        {
+            return lhs.domain == rhs.domain && lhs.q_index == rhs.q_index;
+        }
+    };
+
+    using steal_victims =
+        std::array<std::vector<steal_victim>, num_steal_levels>;
+
+    // Returns whether an idle worker visits the given level of the steal
+    // hierarchy after the given number of consecutive unsuccessful attempts
+    // to find work. Levels are visited in order, the remote domains only if
+    // stealing across NUMA domains is enabled.
+    constexpr bool is_steal_level_enabled(
+        steal_hierarchy_parameters const& hierarchy, steal_level level,
+        std::size_t misses, bool numa_stealing) noexcept
+    {
+        if (level == steal_level::remote_domains && !numa_stealing)
+            return false;
+        return misses >= hierarchy[level].backoff;
+    }
+
+    // Sort the queues of all worker threads except the given one into the
+    // levels of the steal hierarchy. d_lookup and q_lookup hold the NUMA
+    // domain and queue index of each worker thread, q_counts the number of
+    // queues per domain. cache_number(local_id) returns the index of the
+    // cache the given worker is attached to (or -1 if cache siblings should
+    // not be considered). Within a level, the queues are ordered by their
+    // distance from the queue of the thread, such that neighboring threads
+    // start stealing from different victims. Queues shared by several worker
+    // threads are listed once.
+    template <typename CacheNumber>
+    steal_victims make_steal_victims(std::size_t this_thread,
+        std::size_t num_workers, std::size_t num_domains,
+        std::size_t const* d_lookup, std::size_t const* q_lookup,
+        std::size_t const* q_counts, CacheNumber&& cache_number)
+    {
+        std::size_t const domain = d_lookup[this_thread];
+        std::size_t const q_index = q_lookup[this_thread];
+        std::size_t const cache = cache_number(this_thread);
+
+        // distance of a queue from this thread's queue, domains first
+        auto distance = [&](steal_victim const& v) {
+            std::size_t const d =
+                fast_mod(v.domain + num_domains - domain, num_domains);
+            std::size_t const q = fast_mod(v.q_index + q_counts[v.domain] -
+                    fast_mod(q_index, q_counts[v.domain]),
+                q_counts[v.domain]);
+            return std::make_pair(d, q);
+        };
+
+        steal_victims victims;
+        for (std::size_t local_id = 0; local_id != num_workers; ++local_id)
+        {
+            steal_victim const v{d_lookup[local_id], q_lookup[local_id]};
+            if (v.domain == domain && v.q_index == q_index)
+                continue;
+
+            steal_level level = steal_level::remote_domains;
+            if (v.domain == domain)
+            {
+                level = (cache != static_cast<std::size_t>(-1) &&
+                            cache_number(local_id) == cache) ?
+                    steal_level::siblings :
+                    steal_level::numa_domain;
+            }
+            victims[static_cast<std::size_t>(level)].push_back(v);
+        }
+
+        for (auto& level : victims)
+        {
+            std::sort(level.begin(), level.end(),
+                [&](steal_victim const& lhs, steal_victim const& rhs) {
+                    return distance(lhs) < distance(rhs);
+                });
+            level.erase(std::unique(level.begin(), level.end()), level.end());
+        }
+
+        // a queue shared with a sibling must not be visited again on the
+        // NUMA level
+        auto& numa =
+            victims[static_cast<std::size_t>(steal_level::numa_domain)];
+        auto const& siblings =
+            victims[static_cast<std::size_t>(steal_level::siblings)];
+        numa.erase(std::remove_if(numa.begin(), numa.end(),
+                       [&](steal_victim const& v) {
+                           return std::find(siblings.begin(), siblings.end(),
+                                      v) != siblings.end();
+                       }),
+            numa.end());
+
+        return victims;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // The shared_priority_queue_scheduler maintains a set of high, normal, and
     // low priority queues. For each priority level there is a core/queue ratio
@@ -148,6 +293,7 @@ namespace hpx::threads::policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+            steal_hierarchy_parameters steal_hierarchy_;
         };
         using init_parameter_type = init_parameter;
 
@@ -162,6 +308,12 @@ namespace hpx::threads::policies {
 #endif
 #endif
           , cores_per_queue_(init.cores_per_queue_)
+          , steal_hierarchy_(init.steal_hierarchy_)
+          , steal_victims_(init.num_worker_threads_)
+          , steal_misses_(init.num_worker_threads_)
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+          , steal_counts_(init.num_worker_threads_)
+#endif
           , num_workers_(init.num_worker_threads_)
           , num_domains_(1)
           , affinity_data_(init.affinity_data_)
@@ -464,145 +616,100 @@ namespace hpx::threads::policies {
                 ->create_thread(data, thrd, local_num, ec);
         }
 
-        template <typename T>
-        bool steal_by_function(std::size_t domain, std::size_t q_index,
-            bool steal_numa, bool steal_core, thread_holder_type* origin,
-            T& var, char const* prefix,
-            hpx::function<bool(
-                std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
-                operation_HP,
-            hpx::function<bool(
-                std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
-                operation)
+        // number of staged tasks converted from the queues of the thread
+        // itself
+        static constexpr std::size_t local_add_new_count = 64;
+
+        // Try the given operation on the queues of each steal level in turn,
+        // a level is only visited if the closer ones have failed to provide
+        // work for the configured number of consecutive attempts.
+        template <typename T, typename F>
+        bool steal_from_levels(std::size_t this_thread,
+            thread_holder_type* receiver, T& var, std::size_t misses,
+            char const* prefix, F&& operation)
         {
-            bool result;
-
-            // All stealing disabled
-            if (!steal_core)
+            for (std::size_t l = 0; l != num_steal_levels; ++l)
             {
-                // try only the queues on this thread, in order BP,HP,NP,LP
-                result =
-                    operation_HP(domain, q_index, origin, var, false, false);
-                result = result ||
-                    operation(domain, q_index, origin, var, false, false);
-                if (result)
+                auto const level = static_cast<steal_level>(l);
+                if (!is_steal_level_enabled(
+                        steal_hierarchy_, level, misses, numa_stealing_))
                 {
-                    spq_deb.debug(debug::str<>(prefix), "local no stealing",
-                        "D", debug::dec<2>(domain), "Q",
-                        debug::dec<3>(q_index));
-                    return result;
+                    break;
                 }
-            }
-            // High priority tasks first
-            else if (steal_hp_first_)
-            {
-                for (std::size_t d = 0; d < num_domains_; ++d)
-                {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation_HP(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first BP/HP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
-                }
-                for (std::size_t d = 0; d < num_domains_; ++d)
+
+                steal_level_parameters const& params = steal_hierarchy_[level];
+
+                for (steal_victim const& v : steal_victims_[this_thread][l])
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
+                    if (operation(v.domain, v.q_index, receiver, var, true,
+                            params.batch_size))
                     {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first NP/LP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
+                        spq_deb.debug(debug::str<>(prefix), "stolen", "level",
+                            l, "D", debug::dec<2>(v.domain), "Q",
+                            debug::dec<3>(v.q_index));
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                        std::int64_t count = 1;
+                        if constexpr (std::is_same_v<T, std::size_t>)
+                        {
+                            count = static_cast<std::int64_t>(var);
+                        }
+                        steal_counts_[this_thread].data_[l].fetch_add(
+                            count, std::memory_order_relaxed);
+#endif
+                        return true;
                     }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
                 }
             }
-            else /*steal_after_local*/
+            return false;
+        }
+
+        // Look for work in the queues of this thread first, then walk the
+        // steal hierarchy: siblings sharing a cache, the rest of the NUMA
+        // domain, and finally the other NUMA domains.
+        template <typename T, typename FHP, typename F>
+        bool steal_hierarchical(std::size_t this_thread,
+            thread_holder_type* receiver, T& var, char const* prefix,
+            FHP&& operation_HP, F&& operation)
+        {
+            std::size_t const domain = d_lookup_[this_thread];
+            std::size_t const q_index = q_lookup_[this_thread];
+            std::size_t& misses = steal_misses_[this_thread].data_;
+
+            bool result = operation_HP(domain, q_index, receiver, var, false,
+                local_add_new_count);
+
+            // High priority tasks first
+            if (!result && core_stealing_ && steal_hp_first_)
             {
-                // do this local core/queue
-                result =
-                    operation_HP(domain, q_index, origin, var, false, false);
-                result = result ||
-                    operation(domain, q_index, origin, var, false, false);
-                if (result)
-                {
-                    spq_deb.debug(debug::str<>(prefix),
-                        "steal_after_local local taken", "D",
-                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                    return result;
-                }
+                result = steal_from_levels(
+                    this_thread, receiver, var, misses, prefix, operation_HP);
+            }
 
-                if (q_counts_[domain] > 1)
-                {
-                    // steal from other cores on this numa domain?
-                    // use q+1 to avoid testing the same local queue again
-                    q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                    result =
-                        operation_HP(domain, q_index, origin, var, true, true);
-                    result = result ||
-                        operation(domain, q_index, origin, var, true, true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_after_local this numa", "stolen", "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                }
+            result = result ||
+                operation(domain, q_index, receiver, var, false,
+                    local_add_new_count);
 
-                if (steal_numa)
+            if (!result && core_stealing_)
+            {
+                if (!steal_hp_first_)
                 {
-                    // try other numa domains BP/HP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation_HP(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa BP/HP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                    // try other numa domains NP/LP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa NP/LP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
+                    result = steal_from_levels(this_thread, receiver, var,
+                        misses, prefix, operation_HP);
                 }
+                result = result ||
+                    steal_from_levels(
+                        this_thread, receiver, var, misses, prefix, operation);
             }
-            return false;
+
+            if (result)
+            {
+                misses = 0;
+            }
+            else if (core_stealing_)
+            {
+                ++misses;
+            }
+            return result;
         }
 
         // Return the next thread to be executed, return false if none available
@@ -622,32 +729,30 @@ namespace hpx::threads::policies {
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* /* receiver */,
                     threads::thread_id_ref_type& th, bool stealing,
-                    bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread_HP(
-                        q_index, th, stealing, allow_stealing);
+                    std::size_t /* batch_size */) {
+                    return numa_holder_[domain]
+                        .thread_queue(q_index)
+                        ->get_next_thread_HP(th, stealing, !stealing);
                 };
 
             auto get_next_thread_function =
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* /* receiver */,
                     threads::thread_id_ref_type& th, bool stealing,
-                    bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread(
-                        q_index, th, stealing, allow_stealing);
+                    std::size_t /* batch_size */) {
+                    return numa_holder_[domain]
+                        .thread_queue(q_index)
+                        ->get_next_thread(th, stealing);
                 };
 
-            std::size_t domain = d_lookup_[this_thread];
-            std::size_t q_index = q_lookup_[this_thread];
-
             // first try a high priority task, allow stealing if stealing of HP
             // tasks in on, this will be fine but send a null function for
             // normal tasks
 
             if (bool const result =
-                    steal_by_function<threads::thread_id_ref_type>(domain,
-                        q_index, numa_stealing_, core_stealing_, nullptr, thrd,
-                        "SBF-get_next_thread", get_next_thread_function_HP,
-                        get_next_thread_function))
+                    steal_hierarchical<threads::thread_id_ref_type>(this_thread,
+                        nullptr, thrd, "SH-get_next_thread",
+                        get_next_thread_function_HP, get_next_thread_function))
             {
                 return result;
             }
@@ -682,17 +787,20 @@ namespace hpx::threads::policies {
             auto add_new_function_HP =
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* receiver, std::size_t& add,
-                    bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].add_new_HP(
-                        receiver, q_index, add, stealing, allow_stealing);
+                    bool stealing, std::size_t batch_size) {
+                    add = receiver->add_new_HP(
+                        static_cast<std::int64_t>(batch_size),
+                        numa_holder_[domain].thread_queue(q_index), stealing);
+                    return add > 0;
                 };
 
             auto add_new_function = [&](std::size_t domain, std::size_t q_index,
                                         thread_holder_type* receiver,
                                         std::size_t& add, bool stealing,
-                                        bool allow_stealing) {
-                return numa_holder_[domain].add_new(
-                    receiver, q_index, add, stealing, allow_stealing);
+                                        std::size_t batch_size) {
+                add = receiver->add_new(static_cast<std::int64_t>(batch_size),
+                    numa_holder_[domain].thread_queue(q_index), stealing);
+                return add > 0;
             };
 
             std::size_t domain = d_lookup_[this_thread];
@@ -704,9 +812,9 @@ namespace hpx::threads::policies {
                 q_index, "numa_stealing ", numa_stealing_, "core_stealing ",
                 core_stealing_);
 
-            bool const added_tasks = steal_by_function<std::size_t>(domain,
-                q_index, numa_stealing_, core_stealing_, receiver, added,
-                "wait_or_add_new", add_new_function_HP, add_new_function);
+            bool const added_tasks = steal_hierarchical<std::size_t>(
+                this_thread, receiver, added, "wait_or_add_new",
+                add_new_function_HP, add_new_function);
 
             return !added_tasks;
         }
@@ -1213,6 +1321,9 @@ namespace hpx::threads::policies {
                 std::this_thread::yield();
             }
 
+            // now that all queues are known, decide where to steal from
+            init_steal_victims(local_thread, topo);
+
             lock.lock();
             if (!debug_init_)
             {
@@ -1231,6 +1342,32 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Sort the queues of all other worker threads into the levels of the
+        // steal hierarchy as seen from the given thread.
+        void init_steal_victims(
+            std::size_t local_thread, threads::topology const& topo)
+        {
+            auto cache_number = [&](std::size_t local_id) {
+                if (steal_hierarchy_.cache_level == 0)
+                    return static_cast<std::size_t>(-1);
+                std::size_t const pu_num = affinity_data_.get_pu_num(
+                    local_to_global_thread_index(local_id));
+                return topo.get_cache_number(
+                    pu_num, steal_hierarchy_.cache_level);
+            };
+
+            auto& victims = steal_victims_[local_thread];
+            victims = make_steal_victims(local_thread, num_workers_,
+                num_domains_, d_lookup_.data(), q_lookup_.data(),
+                q_counts_.data(), cache_number);
+
+            steal_misses_[local_thread].data_ = 0;
+
+            spq_deb.debug(debug::str<>("steal victims"), "local_thread",
+                local_thread, "siblings", victims[0].size(), "numa",
+                victims[1].size(), "remote", victims[2].size());
+        }
+
         void on_stop_thread(std::size_t thread_num) override
         {
             if (thread_num > num_workers_)
@@ -1333,6 +1470,46 @@ namespace hpx::threads::policies {
                 "get_num_stolen_to_staged performance counter");
             return 0;
         }
+
+        std::int64_t get_num_stolen_from_level(
+            steal_level level, std::size_t num_thread, bool reset)
+        {
+            auto const l = static_cast<std::size_t>(level);
+            if (num_thread != static_cast<std::size_t>(-1))
+            {
+                HPX_ASSERT(num_thread < num_workers_);
+                return util::get_and_reset_value(
+                    steal_counts_[num_thread].data_[l], reset);
+            }
+
+            std::int64_t count = 0;
+            for (auto& counts : steal_counts_)
+            {
+                count += util::get_and_reset_value(counts.data_[l], reset);
+            }
+            return count;
+        }
+
+        std::int64_t get_num_stolen_from_siblings(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_level(
+                steal_level::siblings, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_level(
+                steal_level::numa_domain, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote_domains(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_level(
+                steal_level::remote_domains, num_thread, reset);
+        }
 #endif
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -1393,6 +1570,23 @@ namespace hpx::threads::policies {
         // number of cores per queue for HP, NP, LP queues
         core_ratios cores_per_queue_;
 
+        // per-level parameters for stealing
+        steal_hierarchy_parameters const steal_hierarchy_;
+
+        // for each worker thread, the queues to steal from on each level
+        std::vector<steal_victims> steal_victims_;
+
+        // for each worker thread, the number of consecutive unsuccessful
+        // attempts to find work
+        std::vector<util::cache_aligned_data<std::size_t>> steal_misses_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // for each worker thread, the number of tasks stolen on each level
+        std::vector<util::cache_aligned_data<
+            std::array<std::atomic<std::int64_t>, num_steal_levels>>>
+            steal_counts_;
+#endif
+
         // when true, new tasks are added round robing to thread queues
         bool round_robin_ = true;
 
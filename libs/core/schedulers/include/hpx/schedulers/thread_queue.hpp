@@ -17,6 +17,7 @@
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/thread_registry.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
@@ -37,6 +38,9 @@
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
 #include <hpx/util/get_and_reset_value.hpp>
 #endif
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+#include <hpx/util/get_and_reset_value.hpp>
+#endif
 
 #include <algorithm>
 #include <atomic>
@@ -76,6 +80,10 @@ namespace hpx::threads::policies {
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
+    //
+    //     // optional, called on the worker thread the queue belongs to
+    //     void on_start_thread(std::size_t num_thread);
+    //     void on_stop_thread(std::size_t num_thread);
     // };
     //
     // struct queue_policy
@@ -86,6 +94,17 @@ namespace hpx::threads::policies {
     //         typedef ... type;
     //     };
     // };
+    namespace detail {
+
+        template <typename Backend>
+        using queue_backend_on_start_thread_t =
+            decltype(std::declval<Backend&>().on_start_thread(std::size_t()));
+
+        template <typename Backend>
+        using queue_backend_on_stop_thread_t =
+            decltype(std::declval<Backend&>().on_stop_thread(std::size_t()));
+    }    // namespace detail
+
     template <typename Mutex, typename PendingQueuing, typename StagedQueuing,
         typename TerminatedQueuing>
     class thread_queue
@@ -96,9 +115,13 @@ namespace hpx::threads::policies {
 
         // this is the type of the map holding all threads (except depleted
         // ones)
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+        using thread_map_type = thread_registry;
+#else
         using thread_map_type =
             std::unordered_set<thread_id_type, std::hash<thread_id_type>,
                 std::equal_to<>, util::internal_allocator<thread_id_type>>;
+#endif
 
         using thread_heap_type = std::vector<thread_id_type,
             util::internal_allocator<thread_id_type>>;
@@ -183,10 +206,16 @@ namespace hpx::threads::policies {
                 thrd = heap->back();
                 heap->pop_back();
                 get_thread_id_data(thrd)->rebind(data);
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+                ++thread_objects_reused_;
+#endif
             }
             else
 #endif
             {
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+                ++thread_objects_allocated_;
+#endif
                 hpx::unlock_guard<Lock> ull(lk);
 
                 // Allocate a new thread object.
@@ -351,30 +380,64 @@ namespace hpx::threads::policies {
             std::ptrdiff_t const stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
+            thread_heap_type* heap = nullptr;
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_back(thrd);
+                heap = &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_back(thrd);
+                heap = &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_back(thrd);
+                heap = &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_back(thrd);
+                heap = &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_back(thrd);
+                heap = &thread_heap_nostack_;
             }
             else
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            heap->push_back(thrd);
+
+            if (parameters_.max_thread_heap_size_ > 0 &&
+                static_cast<std::int64_t>(heap->size()) >
+                    parameters_.max_thread_heap_size_)
+            {
+                trim_thread_heap(*heap);
+            }
+        }
+
+        // Threads terminate on (and are recycled by) the queue that created
+        // them. If one queue creates many more threads than it runs at any
+        // point in time (e.g. a producer spawning short tasks that are stolen
+        // by other cores) its heaps would keep growing, holding on to the
+        // stacks of all those threads. Once a heap exceeds its high-water
+        // mark, destroy half of the recycled threads at once. This releases
+        // the memory in batches while keeping enough threads around to serve
+        // subsequent bursts without allocating.
+        void trim_thread_heap(thread_heap_type& heap)
+        {
+            auto const low_water =
+                static_cast<std::size_t>(parameters_.max_thread_heap_size_ / 2);
+            while (heap.size() > low_water)
+            {
+                threads::thread_data* p = get_thread_id_data(heap.back());
+                heap.pop_back();
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+                thread_map_.release_slot(p);
+#endif
+                deallocate(p);
             }
         }
 
@@ -505,6 +568,10 @@ namespace hpx::threads::policies {
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
 #endif
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+          , thread_objects_allocated_(0)
+          , thread_objects_reused_(0)
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
           , pending_misses_(0)
           , pending_accesses_(0)
@@ -599,6 +666,21 @@ namespace hpx::threads::policies {
         }
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        // number of thread objects (including their stacks) which had to be
+        // newly allocated, and which were taken from the heaps of recycled
+        // threads instead
+        std::int64_t get_num_allocated_threads(bool reset) noexcept
+        {
+            return util::get_and_reset_value(thread_objects_allocated_, reset);
+        }
+
+        std::int64_t get_num_reused_threads(bool reset) noexcept
+        {
+            return util::get_and_reset_value(thread_objects_reused_, reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(bool reset) noexcept
         {
@@ -1099,6 +1181,26 @@ namespace hpx::threads::policies {
             return true;
         }
 
+        // Convert up to the given number of staged tasks into pending threads
+        // of this queue. Returns the number of converted tasks, this does not
+        // wait if the queue is currently locked.
+        std::size_t convert_staged_tasks(
+            std::int64_t add_count, bool steal = false)
+        {
+            if (new_tasks_count_.data_.load(std::memory_order_relaxed) == 0)
+            {
+                return 0;
+            }
+
+            std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
+            if (!lk.owns_lock())
+            {
+                return 0;
+            }
+
+            return add_new(add_count, this, lk, steal);
+        }
+
         // This is a function that gets called periodically by the thread
         // manager to allow for maintenance tasks to be executed in the
         // scheduler. Returns true if the OS thread calling this function has to
@@ -1237,8 +1339,15 @@ namespace hpx::threads::policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t /* num_thread */)
+        void on_start_thread(std::size_t num_thread)
         {
+            if constexpr (hpx::util::is_detected_v<
+                              detail::queue_backend_on_start_thread_t,
+                              work_items_type>)
+            {
+                work_items_.on_start_thread(num_thread);
+            }
+
             thread_heap_small_.reserve(parameters_.init_threads_count_);
             thread_heap_medium_.reserve(parameters_.init_threads_count_);
             thread_heap_large_.reserve(parameters_.init_threads_count_);
@@ -1270,8 +1379,21 @@ namespace hpx::threads::policies {
                 // Finally, store the thread for later use
                 thread_heap_small_.emplace_back(p);
             }
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+            thread_objects_allocated_ += parameters_.init_threads_count_;
+#endif
         }
-        static constexpr void on_stop_thread(std::size_t) noexcept {}
+
+        void on_stop_thread(std::size_t num_thread) noexcept
+        {
+            if constexpr (hpx::util::is_detected_v<
+                              detail::queue_backend_on_stop_thread_t,
+                              work_items_type>)
+            {
+                work_items_.on_stop_thread(num_thread);
+            }
+        }
+
         static constexpr void on_error(
             std::size_t, std::exception_ptr const&) noexcept
         {
@@ -1320,6 +1442,13 @@ namespace hpx::threads::policies {
         std::uint64_t cleanup_terminated_time_;
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        // # of thread objects newly allocated by this queue
+        std::atomic<std::int64_t> thread_objects_allocated_;
+        // # of thread objects taken from the heaps of recycled threads
+        std::atomic<std::int64_t> thread_objects_reused_;
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         // # of times our associated worker-thread couldn't find work in work_items
         std::atomic<std::int64_t> pending_misses_;
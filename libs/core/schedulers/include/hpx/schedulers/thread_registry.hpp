@@ -0,0 +1,309 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Slab-indexed registry of the threads managed by a thread_queue.
+    //
+    // Every thread object is assigned a slot the first time it is added to
+    // the registry. As thread objects are recycled by the queue that created
+    // them (and never handed to another queue), the slot stays valid for the
+    // lifetime of the object. Slots of destroyed thread objects are handed
+    // out again to newly created ones. Adding and removing a thread is a
+    // single atomic exchange on its slot, no hashing or rehashing is
+    // involved. Slots are stored in fixed-size chunks which are allocated on
+    // demand and never moved, which allows for iterating over the registry
+    // while other threads add or remove entries.
+    //
+    // All operations are lock-free and may be invoked concurrently, slots
+    // released by destroyed thread objects are kept in a lock-free free list.
+    // Note that thread_queue still adds and removes threads while holding its
+    // mutex, as the same lock protects the recycled thread objects (the
+    // thread heaps) the registry entries are created from and returned to.
+    //
+    // The interface mimics the subset of std::unordered_set used by
+    // thread_queue.
+    class thread_registry
+    {
+        static constexpr std::size_t chunk_size = 4096;
+        static constexpr std::size_t max_chunks = 2048;
+
+        using slot_type = std::atomic<thread_data*>;
+
+    public:
+        using value_type = thread_id_type;
+        using size_type = std::size_t;
+
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = thread_id_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = thread_id_type const*;
+            using reference = thread_id_type;
+
+            constexpr const_iterator() noexcept = default;
+
+            const_iterator(thread_registry const* registry, std::size_t slot,
+                std::size_t last) noexcept
+              : registry_(registry)
+              , slot_(slot)
+              , last_(last)
+            {
+                skip_empty();
+            }
+
+            thread_id_type operator*() const noexcept
+            {
+                return thread_id_type(registry_->load(slot_));
+            }
+
+            const_iterator& operator++() noexcept
+            {
+                ++slot_;
+                skip_empty();
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            // all past-the-end iterators compare equal, even if the registry
+            // has grown in between creating them
+            friend bool operator==(
+                const_iterator const& lhs, const_iterator const& rhs) noexcept
+            {
+                return lhs.slot_ == rhs.slot_ ||
+                    (lhs.slot_ >= lhs.last_ && rhs.slot_ >= rhs.last_);
+            }
+
+            friend bool operator!=(
+                const_iterator const& lhs, const_iterator const& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+        private:
+            void skip_empty() noexcept
+            {
+                while (slot_ < last_ && registry_->load(slot_) == nullptr)
+                    ++slot_;
+            }
+
+            thread_registry const* registry_ = nullptr;
+            std::size_t slot_ = 0;
+            std::size_t last_ = 0;
+        };
+
+        using iterator = const_iterator;
+
+        thread_registry() noexcept
+        {
+            for (auto& chunk : chunks_)
+                chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        thread_registry(thread_registry const&) = delete;
+        thread_registry(thread_registry&&) = delete;
+        thread_registry& operator=(thread_registry const&) = delete;
+        thread_registry& operator=(thread_registry&&) = delete;
+
+        ~thread_registry()
+        {
+            for (auto& chunk : chunks_)
+                delete[] chunk.load(std::memory_order_relaxed);
+        }
+
+        // add the given thread, returns false if it was registered already
+        std::pair<iterator, bool> emplace(thread_id_type const& tid)
+        {
+            thread_data* thrd = get_thread_id_data(tid);
+
+            std::uint32_t slot = thrd->get_registry_slot();
+            if (slot == thread_data::invalid_registry_slot)
+            {
+                slot = allocate_slot();
+                thrd->set_registry_slot(slot);
+            }
+
+            bool const inserted =
+                get_slot(slot).exchange(thrd, std::memory_order_acq_rel) ==
+                nullptr;
+            if (inserted)
+                count_.fetch_add(1, std::memory_order_relaxed);
+
+            return {iterator(this, slot, slots_used()), inserted};
+        }
+
+        // remove the given thread, returns the number of removed entries
+        std::size_t erase(thread_id_type const& tid) noexcept
+        {
+            std::uint32_t const slot =
+                get_thread_id_data(tid)->get_registry_slot();
+            if (slot >= slots_used())
+                return 0;
+
+            slot_type& s = get_slot(slot);
+            thread_data* expected = get_thread_id_data(tid);
+            if (!s.compare_exchange_strong(
+                    expected, nullptr, std::memory_order_acq_rel))
+            {
+                return 0;
+            }
+
+            count_.fetch_sub(1, std::memory_order_relaxed);
+            return 1;
+        }
+
+        // make the slot of the given (unregistered) thread available for
+        // reuse, this has to be called before the thread object is destroyed
+        void release_slot(thread_data* thrd)
+        {
+            std::uint32_t const slot = thrd->get_registry_slot();
+            if (slot == thread_data::invalid_registry_slot)
+                return;
+
+            HPX_ASSERT(slot < slots_used() && load(slot) == nullptr);
+            thrd->set_registry_slot(thread_data::invalid_registry_slot);
+            free_slots_.enqueue(slot);
+        }
+
+        // number of slots handed out so far, including released ones
+        std::size_t capacity() const noexcept
+        {
+            return slots_used();
+        }
+
+        iterator find(thread_id_type const& tid) const noexcept
+        {
+            std::uint32_t const slot =
+                get_thread_id_data(tid)->get_registry_slot();
+            if (slot >= slots_used() || load(slot) != get_thread_id_data(tid))
+                return end();
+            return iterator(this, slot, slots_used());
+        }
+
+        iterator begin() const noexcept
+        {
+            return iterator(this, 0, slots_used());
+        }
+
+        iterator end() const noexcept
+        {
+            std::size_t const last = slots_used();
+            return iterator(this, last, last);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        std::size_t slots_used() const noexcept
+        {
+            return next_slot_.load(std::memory_order_acquire);
+        }
+
+        slot_type& get_slot(std::size_t slot) const noexcept
+        {
+            HPX_ASSERT(slot < slots_used());
+            return chunks_[slot / chunk_size].load(
+                std::memory_order_acquire)[slot % chunk_size];
+        }
+
+        thread_data* load(std::size_t slot) const noexcept
+        {
+            return get_slot(slot).load(std::memory_order_acquire);
+        }
+
+        void ensure_chunk(std::size_t chunk)
+        {
+            if (chunks_[chunk].load(std::memory_order_acquire) != nullptr)
+                return;
+
+            auto* new_chunk = new slot_type[chunk_size];
+            for (std::size_t i = 0; i != chunk_size; ++i)
+                new_chunk[i].store(nullptr, std::memory_order_relaxed);
+
+            slot_type* expected = nullptr;
+            if (!chunks_[chunk].compare_exchange_strong(
+                    expected, new_chunk, std::memory_order_acq_rel))
+            {
+                delete[] new_chunk;
+            }
+        }
+
+        std::uint32_t allocate_slot()
+        {
+            std::uint32_t free_slot = 0;
+            if (free_slots_.try_dequeue(free_slot))
+                return free_slot;
+
+            std::size_t const slot =
+                next_free_slot_.fetch_add(1, std::memory_order_relaxed);
+            std::size_t const chunk = slot / chunk_size;
+            if (HPX_UNLIKELY(chunk >= max_chunks))
+            {
+                HPX_THROW_BAD_ALLOC("thread_registry::allocate_slot");
+            }
+
+            // make sure the chunks holding the new slot and all slots before
+            // it exist, iterators must not see slots of unallocated chunks
+            for (std::size_t c = 0; c <= chunk; ++c)
+                ensure_chunk(c);
+
+            // publish the new slot without waiting for concurrent
+            // allocations of smaller slots, those are still empty
+            std::size_t used = next_slot_.load(std::memory_order_relaxed);
+            while (used < slot + 1 &&
+                !next_slot_.compare_exchange_weak(used, slot + 1,
+                    std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+
+            return static_cast<std::uint32_t>(slot);
+        }
+
+        mutable std::atomic<slot_type*> chunks_[max_chunks];
+        std::atomic<std::size_t> next_free_slot_{0};
+        std::atomic<std::size_t> next_slot_{0};
+        std::atomic<std::size_t> count_{0};
+
+        // slots released by destroyed thread objects
+        hpx::concurrency::ConcurrentQueue<std::uint32_t> free_slots_;
+    };
+}    // namespace hpx::threads::policies
+
+#endif
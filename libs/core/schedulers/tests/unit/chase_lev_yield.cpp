@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Threads rescheduled through schedule_thread_last (yield, pending) must not
+// be picked up again by the owner of a Chase-Lev queue before other work.
+// Otherwise yielding in a loop on a single worker never lets the awaited
+// task run.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+int hpx_main()
+{
+    // yield explicitly until a task spawned afterwards has run
+    {
+        std::atomic<bool> run(false);
+        hpx::future<void> f = hpx::async([&run]() { run = true; });
+
+        while (!run.load())
+        {
+            hpx::this_thread::yield();
+        }
+        f.get();
+    }
+
+    // the same through yield_while
+    {
+        std::atomic<bool> run(false);
+        hpx::future<void> f = hpx::async([&run]() { run = true; });
+
+        hpx::util::yield_while([&run]() { return !run.load(); });
+        f.get();
+    }
+
+    // two threads waiting for each other by yielding
+    {
+        std::atomic<int> count(0);
+        auto ping_pong = [&count](int parity) {
+            for (int i = 0; i != 100; ++i)
+            {
+                while ((count.load() & 1) != parity)
+                {
+                    hpx::this_thread::yield();
+                }
+                ++count;
+            }
+        };
+
+        hpx::future<void> f1 = hpx::async(ping_pong, 0);
+        hpx::future<void> f2 = hpx::async(ping_pong, 1);
+        f1.get();
+        f2.get();
+
+        HPX_TEST_EQ(count.load(), 200);
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[])
+{
+    using scheduler_type =
+        hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+            hpx::threads::policies::lockfree_chase_lev>;
+
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                scheduler_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<scheduler_type> scheduler(
+                    new scheduler_type(init));
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::scheduler_mode::do_background_work |
+                    hpx::threads::policies::scheduler_mode::
+                        reduce_thread_priority |
+                    hpx::threads::policies::scheduler_mode::delay_exit);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        scheduler_type>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    // run twice, the queues have to be re-owned by the new worker threads
+    // after a restart of the runtime
+    test_scheduler(argc, argv);
+    test_scheduler(argc, argv);
+
+    return hpx::util::report_errors();
+}
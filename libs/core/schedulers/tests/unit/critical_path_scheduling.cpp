@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the local-priority-critical-path scheduler runs the work with
+// the highest criticality first.
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// test the queue backend directly, items are ordered by the magnitude of their
+// criticality, items of similar criticality are handed out in FIFO order
+struct task
+{
+    hpx::threads::thread_init_data data;
+    int id;
+};
+
+void test_backend()
+{
+    using backend_type =
+        hpx::threads::policies::lockfree_critical_path_backend<task*>;
+
+    std::uint16_t const criticality[] = {0, 5, 1, 300, 4, 2, 3, 0, 65535};
+    int const expected[] = {8, 3, 1, 4, 5, 6, 2, 0, 7};
+
+    std::vector<task> tasks(std::size(criticality));
+    for (std::size_t i = 0; i != tasks.size(); ++i)
+    {
+        tasks[i].data.schedulehint.criticality = criticality[i];
+        tasks[i].id = static_cast<int>(i);
+    }
+
+    backend_type q;
+    HPX_TEST(q.empty());
+
+    for (auto& t : tasks)
+    {
+        HPX_TEST(q.push(&t));
+    }
+    HPX_TEST(!q.empty());
+
+    for (int id : expected)
+    {
+        task* t = nullptr;
+        HPX_TEST(q.pop(t));
+        HPX_TEST(t != nullptr);
+        if (t != nullptr)
+        {
+            HPX_TEST_EQ(t->id, id);
+        }
+    }
+
+    task* t = nullptr;
+    HPX_TEST(!q.pop(t));
+    HPX_TEST(q.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test the scheduler, all tasks are created on the only worker thread before
+// any of them gets a chance to run
+void test_scheduler()
+{
+    using hpx::execution::experimental::get_criticality;
+    using hpx::execution::experimental::with_criticality;
+
+    std::uint16_t const criticality[] = {1, 100, 10, 1000, 0};
+    std::vector<std::uint16_t> order;
+
+    hpx::latch l(std::size(criticality) + 1);
+
+    hpx::execution::parallel_executor exec;
+    for (std::uint16_t c : criticality)
+    {
+        auto crit_exec = with_criticality(exec, c);
+        HPX_TEST_EQ(get_criticality(crit_exec), c);
+
+        hpx::parallel::execution::post(crit_exec, [&, c]() {
+            order.push_back(c);
+            l.count_down(1);
+        });
+    }
+
+    l.arrive_and_wait();
+
+    std::vector<std::uint16_t> const expected = {1000, 100, 10, 1, 0};
+    HPX_TEST(order == expected);
+}
+
+int hpx_main()
+{
+    test_backend();
+    test_scheduler();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.os_threads=1", "hpx.scheduler=local-priority-critical-path"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
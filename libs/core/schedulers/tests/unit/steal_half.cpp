@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that local_workrequesting_scheduler transfers more than one task per
+// successful steal if steal-half is enabled (hpx.thread_queue.steal_half=1).
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 2000;
+
+void busy_wait(std::uint64_t nanoseconds)
+{
+    auto const start = hpx::chrono::high_resolution_clock::now();
+    while (hpx::chrono::high_resolution_clock::now() - start < nanoseconds)
+    {
+    }
+}
+
+int hpx_main()
+{
+    std::atomic<std::size_t> run_elsewhere(0);
+    hpx::latch l(num_tasks + 1);
+
+    // create all tasks on the queue of the first worker thread, the second
+    // one has to steal them
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_schedule_hint(0));
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::parallel::execution::post(exec, [&]() {
+            busy_wait(50000);
+            if (hpx::get_worker_thread_num() != 0)
+                ++run_elsewhere;
+            l.count_down(1);
+        });
+    }
+
+    l.arrive_and_wait();
+
+    HPX_TEST_NEQ(run_elsewhere.load(), static_cast<std::size_t>(0));
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    auto* scheduler = hpx::threads::get_self_id_data()->get_scheduler_base();
+    HPX_TEST_LT(static_cast<std::int64_t>(1),
+        scheduler->get_average_tasks_per_steal(std::size_t(-1), false));
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=2",
+        "hpx.scheduler=local-workrequesting-fifo",
+        "hpx.thread_queue.steal_half=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the order in which idle workers of the shared_priority_queue_scheduler
+// visit the queues of other workers: cache siblings first, then the rest of
+// the NUMA domain, and the other NUMA domains last. The topologies are
+// synthetic, so this does not depend on the machine running the test.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::policies::is_steal_level_enabled;
+using hpx::threads::policies::make_steal_victims;
+using hpx::threads::policies::steal_hierarchy_parameters;
+using hpx::threads::policies::steal_level;
+using hpx::threads::policies::steal_victim;
+using hpx::threads::policies::steal_victims;
+
+constexpr std::size_t no_cache = static_cast<std::size_t>(-1);
+
+struct synthetic_topology
+{
+    std::vector<std::size_t> d_lookup;
+    std::vector<std::size_t> q_lookup;
+    std::vector<std::size_t> q_counts;
+    std::vector<std::size_t> caches;
+
+    steal_victims victims_of(std::size_t thread) const
+    {
+        return make_steal_victims(thread, d_lookup.size(), q_counts.size(),
+            d_lookup.data(), q_lookup.data(), q_counts.data(),
+            [this](std::size_t local_id) { return caches[local_id]; });
+    }
+};
+
+std::vector<steal_victim> const& level_of(
+    steal_victims const& victims, steal_level level)
+{
+    return victims[static_cast<std::size_t>(level)];
+}
+
+// Collect the queues visited by one steal attempt after the given number of
+// consecutive misses, in the order the scheduler visits them.
+std::vector<steal_victim> visit_order(steal_victims const& victims,
+    steal_hierarchy_parameters const& hierarchy, std::size_t misses,
+    bool numa_stealing)
+{
+    std::vector<steal_victim> visited;
+    for (std::size_t l = 0; l != victims.size(); ++l)
+    {
+        if (!is_steal_level_enabled(hierarchy, static_cast<steal_level>(l),
+                misses, numa_stealing))
+        {
+            break;
+        }
+        visited.insert(visited.end(), victims[l].begin(), victims[l].end());
+    }
+    return visited;
+}
+
+// two NUMA domains with four cores each, pairs of cores share a cache
+synthetic_topology two_domains()
+{
+    return synthetic_topology{{0, 0, 0, 0, 1, 1, 1, 1},
+        {0, 1, 2, 3, 0, 1, 2, 3}, {4, 4}, {0, 0, 1, 1, 2, 2, 3, 3}};
+}
+
+void test_levels()
+{
+    synthetic_topology const topo = two_domains();
+    steal_victims const victims = topo.victims_of(1);
+
+    std::vector<steal_victim> const siblings = {{0, 0}};
+    std::vector<steal_victim> const numa = {{0, 2}, {0, 3}};
+    std::vector<steal_victim> const remote = {{1, 1}, {1, 2}, {1, 3}, {1, 0}};
+
+    HPX_TEST(level_of(victims, steal_level::siblings) == siblings);
+    HPX_TEST(level_of(victims, steal_level::numa_domain) == numa);
+    HPX_TEST(level_of(victims, steal_level::remote_domains) == remote);
+
+    // the thread's own queue is never a victim
+    for (auto const& level : victims)
+    {
+        for (steal_victim const& v : level)
+        {
+            HPX_TEST(!(v.domain == 0 && v.q_index == 1));
+        }
+    }
+}
+
+void test_no_cache_siblings()
+{
+    synthetic_topology topo = two_domains();
+    topo.caches.assign(topo.caches.size(), no_cache);
+
+    // without cache information all cores of the domain are on the NUMA level
+    steal_victims const victims = topo.victims_of(5);
+
+    std::vector<steal_victim> const numa = {{1, 2}, {1, 3}, {1, 0}};
+    std::vector<steal_victim> const remote = {{0, 1}, {0, 2}, {0, 3}, {0, 0}};
+
+    HPX_TEST(level_of(victims, steal_level::siblings).empty());
+    HPX_TEST(level_of(victims, steal_level::numa_domain) == numa);
+    HPX_TEST(level_of(victims, steal_level::remote_domains) == remote);
+}
+
+void test_shared_queues()
+{
+    // two cores per queue, the cores of a queue share a cache
+    synthetic_topology const topo{{0, 0, 0, 0, 1, 1, 1, 1},
+        {0, 0, 1, 1, 0, 0, 1, 1}, {2, 2}, {0, 0, 0, 0, 1, 1, 1, 1}};
+
+    steal_victims const victims = topo.victims_of(0);
+
+    // each queue is listed once, on the closest level
+    std::vector<steal_victim> const siblings = {{0, 1}};
+    std::vector<steal_victim> const remote = {{1, 0}, {1, 1}};
+
+    HPX_TEST(level_of(victims, steal_level::siblings) == siblings);
+    HPX_TEST(level_of(victims, steal_level::numa_domain).empty());
+    HPX_TEST(level_of(victims, steal_level::remote_domains) == remote);
+}
+
+void test_visit_order()
+{
+    synthetic_topology const topo = two_domains();
+    steal_victims const victims = topo.victims_of(1);
+
+    steal_hierarchy_parameters hierarchy;
+    hierarchy.levels = {{{0, 64}, {2, 32}, {4, 8}}};
+
+    std::vector<steal_victim> const siblings = {{0, 0}};
+    std::vector<steal_victim> const siblings_numa = {{0, 0}, {0, 2}, {0, 3}};
+    std::vector<steal_victim> const all = {
+        {0, 0}, {0, 2}, {0, 3}, {1, 1}, {1, 2}, {1, 3}, {1, 0}};
+
+    // the levels are visited from the closest to the farthest one, farther
+    // levels only after the configured number of misses
+    HPX_TEST(visit_order(victims, hierarchy, 0, true) == siblings);
+    HPX_TEST(visit_order(victims, hierarchy, 1, true) == siblings);
+    HPX_TEST(visit_order(victims, hierarchy, 2, true) == siblings_numa);
+    HPX_TEST(visit_order(victims, hierarchy, 3, true) == siblings_numa);
+    HPX_TEST(visit_order(victims, hierarchy, 4, true) == all);
+
+    // other domains are never visited without NUMA stealing
+    HPX_TEST(visit_order(victims, hierarchy, 100, false) == siblings_numa);
+
+    // the default parameters defer remote steals
+    steal_hierarchy_parameters const defaults;
+    HPX_TEST(is_steal_level_enabled(defaults, steal_level::siblings, 0, true));
+    HPX_TEST(
+        is_steal_level_enabled(defaults, steal_level::numa_domain, 0, true));
+    HPX_TEST(!is_steal_level_enabled(
+        defaults, steal_level::remote_domains, 0, true));
+}
+
+int hpx_main()
+{
+    test_levels();
+    test_no_cache_siblings();
+    test_shared_queues();
+    test_visit_order();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/schedulers/thread_registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::threads::thread_data;
+using hpx::threads::thread_id_type;
+using hpx::threads::policies::thread_registry;
+
+thread_data* create_thread_object()
+{
+    hpx::threads::thread_init_data init_data;
+    init_data.stacksize = hpx::threads::thread_stacksize::nostack;
+    return hpx::threads::thread_data_stackless::create(init_data, nullptr,
+        0, hpx::threads::thread_id_addref::no);
+}
+
+void test_emplace_erase()
+{
+    thread_registry registry;
+    HPX_TEST(registry.empty());
+    HPX_TEST(registry.begin() == registry.end());
+
+    std::vector<thread_data*> threads;
+    for (int i = 0; i != 100; ++i)
+        threads.push_back(create_thread_object());
+
+    for (thread_data* p : threads)
+    {
+        auto const result = registry.emplace(thread_id_type(p));
+        HPX_TEST(result.second);
+        HPX_TEST(*result.first == thread_id_type(p));
+        HPX_TEST_NEQ(
+            p->get_registry_slot(), thread_data::invalid_registry_slot);
+    }
+    HPX_TEST_EQ(registry.size(), threads.size());
+
+    // registering a thread twice fails
+    HPX_TEST(!registry.emplace(thread_id_type(threads[0])).second);
+    HPX_TEST_EQ(registry.size(), threads.size());
+
+    // all registered threads are found and enumerated exactly once
+    std::size_t count = 0;
+    for (auto it = registry.begin(); it != registry.end(); ++it)
+    {
+        HPX_TEST(std::find(threads.begin(), threads.end(),
+                     hpx::threads::get_thread_id_data(*it)) != threads.end());
+        ++count;
+    }
+    HPX_TEST_EQ(count, threads.size());
+
+    for (thread_data* p : threads)
+        HPX_TEST(registry.find(thread_id_type(p)) != registry.end());
+
+    // removing a thread keeps its slot, re-adding reuses it
+    std::uint32_t const slot = threads[42]->get_registry_slot();
+    HPX_TEST_EQ(registry.erase(thread_id_type(threads[42])),
+        static_cast<std::size_t>(1));
+    HPX_TEST_EQ(registry.erase(thread_id_type(threads[42])),
+        static_cast<std::size_t>(0));
+    HPX_TEST(registry.find(thread_id_type(threads[42])) == registry.end());
+    HPX_TEST_EQ(registry.size(), threads.size() - 1);
+
+    HPX_TEST(registry.emplace(thread_id_type(threads[42])).second);
+    HPX_TEST_EQ(threads[42]->get_registry_slot(), slot);
+
+    for (thread_data* p : threads)
+    {
+        HPX_TEST_EQ(
+            registry.erase(thread_id_type(p)), static_cast<std::size_t>(1));
+        registry.release_slot(p);
+        p->destroy();
+    }
+    HPX_TEST(registry.empty());
+    HPX_TEST(registry.begin() == registry.end());
+}
+
+void test_slot_reuse()
+{
+    thread_registry registry;
+
+    thread_data* p1 = create_thread_object();
+    registry.emplace(thread_id_type(p1));
+    std::uint32_t const slot = p1->get_registry_slot();
+
+    // the slot of a destroyed thread object is handed to the next new one
+    registry.erase(thread_id_type(p1));
+    registry.release_slot(p1);
+    HPX_TEST_EQ(
+        p1->get_registry_slot(), thread_data::invalid_registry_slot);
+    p1->destroy();
+
+    thread_data* p2 = create_thread_object();
+    registry.emplace(thread_id_type(p2));
+    HPX_TEST_EQ(p2->get_registry_slot(), slot);
+    HPX_TEST_EQ(registry.capacity(), static_cast<std::size_t>(1));
+
+    registry.erase(thread_id_type(p2));
+    registry.release_slot(p2);
+    p2->destroy();
+}
+
+// registry operations do not need any external locking
+void test_concurrent()
+{
+    constexpr int num_threads = 4;
+    constexpr int num_objects = 1000;
+    constexpr int num_rounds = 10;
+
+    thread_registry registry;
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t != num_threads; ++t)
+    {
+        workers.emplace_back([&]() {
+            std::vector<thread_data*> threads;
+            for (int i = 0; i != num_objects; ++i)
+                threads.push_back(create_thread_object());
+
+            for (int round = 0; round != num_rounds; ++round)
+            {
+                for (thread_data* p : threads)
+                {
+                    if (!registry.emplace(thread_id_type(p)).second)
+                        failed = true;
+                }
+
+                // enumerate while other threads modify the registry
+                std::size_t count = 0;
+                for (auto it = registry.begin(); it != registry.end(); ++it)
+                    ++count;
+                if (count > registry.capacity())
+                    failed = true;
+
+                for (thread_data* p : threads)
+                {
+                    if (registry.erase(thread_id_type(p)) != 1)
+                        failed = true;
+                }
+
+                // release half of the slots, those are reused in the next
+                // round by any of the threads
+                for (std::size_t i = 0; i != threads.size(); i += 2)
+                {
+                    registry.release_slot(threads[i]);
+                    threads[i]->destroy();
+                    threads[i] = create_thread_object();
+                }
+            }
+
+            for (thread_data* p : threads)
+            {
+                registry.release_slot(p);
+                p->destroy();
+            }
+        });
+    }
+
+    for (auto& w : workers)
+        w.join();
+
+    HPX_TEST(!failed);
+    HPX_TEST(registry.empty());
+
+    // released slots were reused instead of allocating new ones
+    HPX_TEST_LTE(registry.capacity(),
+        static_cast<std::size_t>(num_threads * num_objects * 2));
+}
+
+int hpx_main()
+{
+    test_emplace_erase();
+    test_slot_reuse();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The parameters controlling the elasticity of thread pools (see
+    /// elasticity_controller), all are read from the [hpx.elasticity]
+    /// configuration section.
+    struct elasticity_parameters
+    {
+        /// time between two samples of the load of the pools
+        std::chrono::milliseconds interval{100};
+
+        /// the minimal and maximal number of active processing units of each
+        /// pool (0: all processing units of the pool)
+        std::size_t min_threads = 1;
+        std::size_t max_threads = 0;
+
+        /// a processing unit is resumed if the number of queued tasks per
+        /// active processing unit exceeds this value
+        double grow_queue_length = 4.0;
+
+        /// a processing unit is suspended if the fraction of active
+        /// processing units busy executing tasks or doing background work
+        /// falls below this value while no tasks are queued
+        double shrink_utilization = 0.25;
+
+        /// the number of consecutive samples a condition has to hold before
+        /// a processing unit is suspended or resumed
+        std::size_t hysteresis = 5;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The elasticity_controller periodically samples the load of a set of
+    /// thread pools (queue lengths, scheduler utilization, and background
+    /// work time) and suspends or resumes their processing units accordingly.
+    /// All pools need to have the scheduler_mode::enable_elasticity flag set.
+    ///
+    /// The controller runs on a separate OS thread as suspending a
+    /// processing unit blocks until it has run out of work.
+    class HPX_CORE_EXPORT elasticity_controller
+    {
+    public:
+        explicit elasticity_controller(elasticity_parameters const& params);
+        ~elasticity_controller();
+
+        elasticity_controller(elasticity_controller const&) = delete;
+        elasticity_controller(elasticity_controller&&) = delete;
+        elasticity_controller& operator=(elasticity_controller const&) = delete;
+        elasticity_controller& operator=(elasticity_controller&&) = delete;
+
+        /// Add a pool to the set of controlled pools, must be called before
+        /// start().
+        void add_pool(thread_pool_base& pool);
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return pools_.empty();
+        }
+
+        void start();
+        void stop();
+
+        /// Sample the load of all controlled pools once and adapt the number
+        /// of their active processing units.
+        void step();
+
+    private:
+        struct pool_data
+        {
+            thread_pool_base* pool_;
+            std::size_t grow_count_ = 0;
+            std::size_t shrink_count_ = 0;
+            std::int64_t background_duration_ = 0;
+            std::int64_t cumulative_duration_ = 0;
+        };
+
+        void step(pool_data& data);
+        void run();
+
+        elasticity_parameters const params_;
+        std::vector<pool_data> pools_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stopped_ = true;
+        std::thread thread_;
+    };
+}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
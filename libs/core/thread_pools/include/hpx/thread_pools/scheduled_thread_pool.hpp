@@ -225,6 +225,32 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_from_siblings(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_siblings(num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_numa_domain(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote_domains(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_remote_domains(
+                num, reset);
+        }
+
+        std::int64_t get_average_tasks_per_steal(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_average_tasks_per_steal(num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
@@ -251,6 +277,18 @@ namespace hpx::threads::detail {
 #if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
         std::int64_t get_executed_threads(std::size_t, bool) override;
         std::int64_t get_executed_thread_phases(std::size_t, bool) override;
+
+        std::int64_t get_num_allocated_threads(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_allocated_threads(num, reset);
+        }
+
+        std::int64_t get_num_reused_threads(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_reused_threads(num, reset);
+        }
 #if defined(HPX_HAVE_THREAD_IDLE_RATES)
         std::int64_t get_thread_phase_duration(std::size_t, bool) override;
         std::int64_t get_thread_duration(std::size_t, bool) override;
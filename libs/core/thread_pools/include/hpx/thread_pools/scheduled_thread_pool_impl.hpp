@@ -247,7 +247,7 @@ namespace hpx::threads::detail {
             sched_->Scheduler::set_all_states_at_least(hpx::state::stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(static_cast<std::size_t>(-1));
+            sched_->Scheduler::wake_all_parked_threads();
 
             if (blocking)
             {
@@ -260,8 +260,7 @@ namespace hpx::threads::detail {
                     // make sure no OS thread is waiting
                     LTM_(info).format("stop: {} notify_all", id_.name());
 
-                    sched_->Scheduler::do_some_work(
-                        static_cast<std::size_t>(-1));
+                    sched_->Scheduler::wake_all_parked_threads();
 
                     LTM_(info).format("stop: {} join:{}", id_.name(), i);
 
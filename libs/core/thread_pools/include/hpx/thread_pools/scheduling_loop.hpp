@@ -175,6 +175,7 @@ namespace hpx::threads::detail {
 
                 idle_loop_count = 0;
                 ++busy_loop_count;
+                scheduler.reset_idle_backoff(num_thread);
 
                 may_exit = false;
 
@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/thread_pools/elasticity_controller.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace hpx::threads {
+
+    elasticity_controller::elasticity_controller(
+        elasticity_parameters const& params)
+      : params_(params)
+    {
+    }
+
+    elasticity_controller::~elasticity_controller()
+    {
+        stop();
+    }
+
+    void elasticity_controller::add_pool(thread_pool_base& pool)
+    {
+        HPX_ASSERT(stopped_);
+        pools_.push_back(pool_data{&pool});
+    }
+
+    void elasticity_controller::start()
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        if (!stopped_ || pools_.empty())
+            return;
+
+        stopped_ = false;
+        thread_ = std::thread(&elasticity_controller::run, this);
+    }
+
+    void elasticity_controller::stop()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (stopped_)
+                return;
+            stopped_ = true;
+        }
+
+        cond_.notify_all();
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    void elasticity_controller::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (!cond_.wait_for(
+            l, params_.interval, [this] { return stopped_; }))
+        {
+            l.unlock();
+            step();
+            l.lock();
+        }
+    }
+
+    void elasticity_controller::step()
+    {
+        for (auto& data : pools_)
+        {
+            step(data);
+        }
+    }
+
+    void elasticity_controller::step(pool_data& data)
+    {
+        thread_pool_base& pool = *data.pool_;
+        policies::scheduler_base* sched = pool.get_scheduler();
+
+        std::size_t const num_threads = pool.get_os_thread_count();
+        if (sched == nullptr || num_threads == 0 ||
+            !sched->has_scheduler_mode(
+                policies::scheduler_mode::enable_elasticity))
+        {
+            return;
+        }
+
+        std::size_t const max_threads = params_.max_threads == 0 ?
+            num_threads :
+            (std::min) (params_.max_threads, num_threads);
+        std::size_t const min_threads =
+            (std::clamp) (params_.min_threads, std::size_t(1), max_threads);
+
+        // processing units in transition (pre_sleep) are neither counted as
+        // active nor are they considered for being suspended or resumed
+        std::size_t active = 0;
+        std::size_t to_suspend = num_threads;
+        std::size_t to_resume = num_threads;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            hpx::state const s = sched->get_state(i).load();
+            if (s == hpx::state::running)
+            {
+                ++active;
+                to_suspend = i;
+            }
+            else if (s == hpx::state::sleeping && to_resume == num_threads)
+            {
+                to_resume = i;
+            }
+        }
+
+        if (active == 0)
+            return;
+
+        // sample the load of the pool, the scheduler utilization is the
+        // percentage of processing units currently executing tasks
+        std::int64_t const queue_length =
+            pool.get_queue_length(static_cast<std::size_t>(-1), false);
+        double busy = static_cast<double>(pool.get_scheduler_utilization()) *
+            static_cast<double>(num_threads) / 100.0;
+
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+        // time spent on background work (networking) keeps processing units
+        // busy as well
+        std::int64_t const background_duration =
+            pool.get_background_work_duration(
+                static_cast<std::size_t>(-1), false);
+        std::int64_t const cumulative_duration =
+            pool.get_cumulative_duration(static_cast<std::size_t>(-1), false);
+
+        std::int64_t const background_delta =
+            background_duration - data.background_duration_;
+        std::int64_t const cumulative_delta =
+            cumulative_duration - data.cumulative_duration_;
+
+        data.background_duration_ = background_duration;
+        data.cumulative_duration_ = cumulative_duration;
+
+        if (background_delta > 0 && cumulative_delta > 0)
+        {
+            busy += static_cast<double>(active) *
+                static_cast<double>(background_delta) /
+                static_cast<double>(cumulative_delta);
+        }
+#endif
+
+        double const utilization = busy / static_cast<double>(active);
+
+        // Adapt the number of active processing units only if the load has
+        // been too high or too low for a couple of samples in a row. The
+        // upper bound is enforced immediately. Processing units suspended by
+        // other means are resumed only if the load requires it.
+        bool grow = false;
+        bool shrink = active > max_threads;
+
+        if (!shrink)
+        {
+            if (active < max_threads &&
+                static_cast<double>(queue_length) >
+                    params_.grow_queue_length * static_cast<double>(active))
+            {
+                data.shrink_count_ = 0;
+                grow = ++data.grow_count_ >= params_.hysteresis;
+            }
+            else if (active > min_threads && queue_length == 0 &&
+                utilization < params_.shrink_utilization)
+            {
+                data.grow_count_ = 0;
+                shrink = ++data.shrink_count_ >= params_.hysteresis;
+            }
+            else
+            {
+                data.grow_count_ = 0;
+                data.shrink_count_ = 0;
+            }
+        }
+
+        error_code ec(throwmode::lightweight);
+        if (grow && to_resume != num_threads)
+        {
+            LTM_(info).format(
+                "elasticity_controller: resuming processing unit {} of pool "
+                "{} ({} active, queue length {})",
+                to_resume, pool.get_pool_name(), active, queue_length);
+
+            pool.resume_processing_unit_direct(to_resume, ec);
+            data.grow_count_ = 0;
+        }
+        else if (shrink && to_suspend != num_threads)
+        {
+            LTM_(info).format(
+                "elasticity_controller: suspending processing unit {} of pool "
+                "{} ({} active, utilization {})",
+                to_suspend, pool.get_pool_name(), active, utilization);
+
+            pool.suspend_processing_unit_direct(to_suspend, ec);
+            data.shrink_count_ = 0;
+        }
+    }
+}    // namespace hpx::threads
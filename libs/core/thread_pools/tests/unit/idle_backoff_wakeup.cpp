@@ -0,0 +1,71 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work scheduled for parked worker threads wakes them up
+// immediately instead of after their (potentially long) backoff period.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const this_thread = hpx::get_worker_thread_num();
+
+    for (int round = 0; round != 3; ++round)
+    {
+        // let all other worker threads run out of work and park for longer
+        // and longer periods of time
+        std::this_thread::sleep_for(std::chrono::seconds(2));
+
+        hpx::chrono::high_resolution_timer t;
+
+        std::vector<hpx::future<void>> futures;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (i == this_thread)
+                continue;
+
+            auto exec = hpx::execution::experimental::with_hint(
+                hpx::execution::parallel_executor(),
+                hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(i)));
+
+            futures.push_back(hpx::async(exec, [] {}));
+        }
+        hpx::wait_all(futures);
+
+        // the parked threads have backed off for more than a second at this
+        // point, without being woken up the tasks would take that long
+        HPX_TEST_LT(t.elapsed(), 0.5);
+    }
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=4", "hpx.max_idle_loop_count=0",
+        "hpx.idle_yield_count=0", "hpx.max_idle_backoff_time=60000"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -99,12 +99,35 @@ namespace hpx::threads::policies {
             return description_;
         }
 
+        /// This function gets called by the scheduling loop whenever the
+        /// given OS thread has been idle for hpx.max_idle_loop_count
+        /// iterations. The first hpx.idle_yield_count invocations yield the
+        /// OS thread, after that the OS thread is parked until new work
+        /// arrives (or at most for hpx.max_idle_backoff_time milliseconds).
         void idle_callback(std::size_t num_thread);
 
+        /// This function gets called by the scheduling loop whenever the
+        /// given OS thread has found work, this ends the current idle episode
+        /// and restarts the back-off from yielding for the next one.
+        void reset_idle_backoff(
+            [[maybe_unused]] std::size_t num_thread) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            std::uint32_t& wait_count =
+                wait_counts_[num_thread].data_.wait_count_;
+            if (wait_count != 0)
+                wait_count = 0;
+#endif
+        }
+
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
         /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        void do_some_work(std::size_t num_thread);
+
+        /// Wake up all OS threads which are currently parked because of idle
+        /// queues, for instance to let them observe a change in state.
+        void wake_all_parked_threads();
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -168,6 +191,22 @@ namespace hpx::threads::policies {
         virtual std::uint64_t get_cleanup_time(bool reset) = 0;
 #endif
 
+#ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
+        // number of thread objects (with their stacks) which were newly
+        // allocated, and which were reused after their previous thread had
+        // terminated
+        virtual std::int64_t get_num_allocated_threads(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_reused_threads(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         virtual std::int64_t get_num_pending_misses(
             std::size_t num_thread, bool reset) = 0;
@@ -182,6 +221,34 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // number of tasks the given worker thread has stolen from queues of
+        // cores sharing a cache with it, from other cores of its NUMA domain,
+        // and from other NUMA domains (only NUMA-aware schedulers report
+        // those)
+        virtual std::int64_t get_num_stolen_from_siblings(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_remote_domains(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+
+        // average number of tasks transferred by one successful steal
+        // operation (only work-requesting schedulers report this)
+        virtual std::int64_t get_average_tasks_per_steal(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -282,15 +349,32 @@ namespace hpx::threads::policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking OS threads on idle queues, each OS thread is
+        // parked on its own futex (condition variable where futexes are not
+        // available) which allows to wake up exactly the OS threads needed
+        enum idle_state : std::uint32_t
+        {
+            idle_state_running = 0,
+            idle_state_parked = 1
+        };
+
         struct idle_backoff_data
         {
-            std::uint32_t wait_count_;
-            double max_idle_backoff_time_;
+            std::atomic<std::uint32_t> state_{idle_state_running};
+            std::uint32_t wait_count_ = 0;
+#if !defined(__linux__)
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+#endif
         };
+
+        bool wake_parked_thread(std::size_t num_thread);
+        void wake_any_parked_thread(std::size_t num_thread);
+
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+        std::atomic<std::size_t> num_parked_threads_{0};
+        double max_idle_backoff_time_;
+        std::uint32_t idle_yield_count_;
 #endif
 
         // support for suspension of pus
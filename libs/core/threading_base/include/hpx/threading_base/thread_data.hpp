@@ -518,6 +518,12 @@ namespace hpx::threads {
             last_worker_thread_num_ = last_worker_thread_num;
         }
 
+        // critical-path hint given when this thread was created
+        constexpr std::uint16_t get_criticality() const noexcept
+        {
+            return criticality_;
+        }
+
         constexpr std::ptrdiff_t get_stack_size() const noexcept
         {
             return stacksize_enum_ == thread_stacksize::nostack ?
@@ -536,6 +542,22 @@ namespace hpx::threads {
             return *static_cast<ThreadQueue*>(queue_);
         }
 
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+        // slot of this thread object in the registry of its owning queue
+        static constexpr std::uint32_t invalid_registry_slot =
+            static_cast<std::uint32_t>(-1);
+
+        constexpr std::uint32_t get_registry_slot() const noexcept
+        {
+            return registry_slot_;
+        }
+
+        void set_registry_slot(std::uint32_t slot) noexcept
+        {
+            registry_slot_ = slot;
+        }
+#endif
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -620,6 +642,7 @@ namespace hpx::threads {
         std::atomic<bool> runs_as_child_;
 
         std::uint16_t last_worker_thread_num_;
+        std::uint16_t criticality_;
 
         thread_stacksize stacksize_enum_;
         std::int32_t stacksize_;
@@ -634,6 +657,10 @@ namespace hpx::threads {
 
         void* queue_;
 
+#if defined(HPX_HAVE_THREAD_REGISTRY_SLAB)
+        std::uint32_t registry_slot_ = invalid_registry_slot;
+#endif
+
         ///////////////////////////////////////////////////////////////////////
         // Debugging/logging information
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
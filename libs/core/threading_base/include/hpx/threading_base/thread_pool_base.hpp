@@ -249,6 +249,16 @@ namespace hpx::threads {
         {
             return 0;
         }
+        virtual std::int64_t get_num_allocated_threads(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_reused_threads(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #if defined(HPX_HAVE_THREAD_IDLE_RATES)
         virtual std::int64_t get_thread_phase_duration(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -397,6 +407,28 @@ namespace hpx::threads {
         {
             return 0;
         }
+
+        virtual std::int64_t get_num_stolen_from_siblings(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_remote_domains(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_average_tasks_per_steal(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
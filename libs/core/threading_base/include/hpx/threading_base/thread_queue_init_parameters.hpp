@@ -42,7 +42,11 @@ namespace hpx::threads::policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE) noexcept
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t max_thread_heap_size = static_cast<std::int64_t>(
+                HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE),
+            std::int64_t idle_yield_count = static_cast<std::int64_t>(
+                HPX_IDLE_BACKOFF_YIELD_COUNT)) noexcept
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -58,6 +62,8 @@ namespace hpx::threads::policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , max_thread_heap_size_(max_thread_heap_size)
+          , idle_yield_count_(idle_yield_count)
         {
         }
 
@@ -76,5 +82,7 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t max_thread_heap_size_;
+        std::int64_t idle_yield_count_;
     };
 }    // namespace hpx::threads::policies
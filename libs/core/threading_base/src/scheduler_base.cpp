@@ -29,9 +29,17 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) && defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads::policies {
 
@@ -57,65 +65,186 @@ namespace hpx::threads::policies {
         scheduler_base::set_scheduler_mode(mode);
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        double const max_time = thread_queue_init.max_idle_backoff_time_;
-
-        wait_counts_.resize(num_threads);
-        for (auto&& data : wait_counts_)
-        {
-            data.data_.wait_count_ = 0;
-            data.data_.max_idle_backoff_time_ = max_time;
-        }
+        wait_counts_ =
+            std::vector<util::cache_line_data<idle_backoff_data>>(num_threads);
+        max_idle_backoff_time_ = thread_queue_init.max_idle_backoff_time_;
+        idle_yield_count_ =
+            static_cast<std::uint32_t>(thread_queue_init.idle_yield_count_);
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].data_.store(hpx::state::initialized);
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+#if defined(__linux__)
+        static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                sizeof(std::uint32_t),
+            "futexes require std::atomic<std::uint32_t> to have the same "
+            "layout as std::uint32_t");
+
+        // block while the given word still holds the expected value, at most
+        // for the given period of time
+        void futex_wait(std::atomic<std::uint32_t>& word,
+            std::uint32_t expected, std::chrono::milliseconds period) noexcept
+        {
+            timespec timeout{};
+            timeout.tv_sec = static_cast<time_t>(period.count() / 1000);
+            timeout.tv_nsec =
+                static_cast<long>(period.count() % 1000) * 1000000L;
+
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& word) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+#endif
+    }    // namespace
+#endif
+
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-
+            // The scheduling loop spins for hpx.max_idle_loop_count
+            // iterations before calling this function. The first couple of
+            // times this thread merely yields its core to other OS threads,
+            // after that it is parked until woken up by new work.
             idle_backoff_data& data = wait_counts_[num_thread].data_;
+            if (data.wait_count_ < idle_yield_count_)
+            {
+                ++data.wait_count_;
+                std::this_thread::yield();
+                return;
+            }
 
-            // Exponential back-off with a maximum sleep time.
+            // Exponential back-off with a maximum sleep time, the timeout
+            // makes sure that this thread still does its background work.
             static constexpr std::int64_t const max_exponent =
                 std::numeric_limits<double>::max_exponent;
-            double const exponent =
-                (std::min) (static_cast<double>(data.wait_count_),
-                    static_cast<double>(max_exponent - 1));
+            double const exponent = (std::min) (
+                static_cast<double>(data.wait_count_ - idle_yield_count_),
+                static_cast<double>(max_exponent - 1));
 
-            std::chrono::milliseconds const period(
-                std::lround((std::min) (data.max_idle_backoff_time_,
-                    std::pow(2.0, exponent))));
+            std::chrono::milliseconds const period(std::lround(
+                (std::min) (max_idle_backoff_time_, std::pow(2.0, exponent))));
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) ==    //-V1089
-                std::cv_status::no_timeout)
+            // Announce that this thread is about to be parked before looking
+            // at its queue one last time, any work added after that will wake
+            // it up (see do_some_work).
+            data.state_.store(idle_state_parked);
+            ++num_parked_threads_;
+
+            if (get_queue_length(num_thread) == 0)
             {
-                // reset counter if thread was woken up
-                data.wait_count_ = 0;
+#if defined(__linux__)
+                futex_wait(data.state_, idle_state_parked, period);
+#else
+                std::unique_lock<pu_mutex_type> l(data.mtx_);
+                data.cond_.wait_for(l, period, [&] {    //-V1089
+                    return data.state_.load() != idle_state_parked;
+                });
+#endif
             }
+
+            // The counter is not reset here, a thread may have been woken up
+            // without getting any work (see do_some_work). The scheduling
+            // loop resets it once work was found (see reset_idle_backoff).
+            --num_parked_threads_;
+            data.state_.store(idle_state_running);
         }
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    bool scheduler_base::wake_parked_thread(std::size_t num_thread)
+    {
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+        if (data.state_.load(std::memory_order_relaxed) != idle_state_parked ||
+            data.state_.exchange(idle_state_running) != idle_state_parked)
+        {
+            return false;
+        }
+
+#if defined(__linux__)
+        futex_wake(data.state_);
+#else
+        {
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+        }
+        data.cond_.notify_one();
+#endif
+        return true;
+    }
+
+    void scheduler_base::wake_any_parked_thread(std::size_t num_thread)
+    {
+        // start looking right after the given thread to spread the wakeups
+        std::size_t const num_threads = wait_counts_.size();
+        std::size_t const start =
+            num_thread < num_threads ? num_thread + 1 : 0;
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (wake_parked_thread((start + i) % num_threads))
+                return;
+        }
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        // nothing to do if no thread is parked, this is the common case
+        if (num_parked_threads_.load() == 0)
+            return;
+
+        // The given number is the schedule hint used for the new work, it
+        // may be -1 or refer to a NUMA domain instead of a thread. Without
+        // stealing only the thread owning the queue the work was actually
+        // added to can run it, so all parked threads have to be woken up to
+        // make sure that thread is among them.
+        if (!(mode_.data_.load(std::memory_order_relaxed) &
+                policies::scheduler_mode::enable_stealing))
+        {
+            wake_all_parked_threads();
+            return;
+        }
+
+        // Otherwise any thread can steal the work. Try the hinted thread
+        // first, if that thread is busy anyways (or the hint did not refer
+        // to a thread), wake up one other thread instead.
+        if (num_thread < wait_counts_.size() && wake_parked_thread(num_thread))
+        {
+            return;
+        }
+
+        wake_any_parked_thread(num_thread);
+#endif
+    }
+
+    void scheduler_base::wake_all_parked_threads()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (num_parked_threads_.load() == 0)
+            return;
+
+        for (std::size_t i = 0; i != wait_counts_.size(); ++i)
         {
-            cond_.notify_all();
+            wake_parked_thread(i);
         }
 #endif
     }
@@ -325,7 +454,7 @@ namespace hpx::threads::policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(static_cast<std::size_t>(-1));
+        wake_all_parked_threads();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode) noexcept
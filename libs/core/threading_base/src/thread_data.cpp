@@ -65,6 +65,7 @@ namespace hpx::threads {
             init_data.schedulehint.mode == thread_schedule_hint_mode::thread ?
                 init_data.schedulehint.hint :
                 static_cast<std::uint16_t>(-1))
+      , criticality_(init_data.schedulehint.criticality)
       , stacksize_enum_(init_data.stacksize)
       , stacksize_(stacksize_enum_ == thread_stacksize::nostack ?
                 (std::numeric_limits<std::int32_t>::max)() :
@@ -218,6 +219,7 @@ namespace hpx::threads {
             init_data.schedulehint.mode == thread_schedule_hint_mode::thread ?
             init_data.schedulehint.hint :
             static_cast<std::uint16_t>(-1);
+        criticality_ = init_data.schedulehint.criticality;
 
         exit_funcs_.clear();
         scheduler_base_ = init_data.scheduler_base;
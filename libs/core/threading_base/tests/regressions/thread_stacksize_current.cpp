@@ -69,6 +69,8 @@ int main(int argc, char** argv)
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         "local-priority-lifo",
 #endif
+        "local-priority-chase-lev",
+        "local-priority-critical-path",
         "static",
         "static-priority",
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
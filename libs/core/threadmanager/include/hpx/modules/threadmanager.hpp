@@ -13,6 +13,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/thread_pools/elasticity_controller.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -260,6 +261,8 @@ namespace hpx::threads {
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
         std::int64_t get_executed_threads(bool reset) const noexcept;
         std::int64_t get_executed_thread_phases(bool reset) const noexcept;
+        std::int64_t get_num_allocated_threads(bool reset) const;
+        std::int64_t get_num_reused_threads(bool reset) const;
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         std::int64_t get_thread_duration(bool reset) const;
         std::int64_t get_thread_phase_duration(bool reset) const;
@@ -277,10 +280,15 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+        std::int64_t get_num_stolen_from_siblings(bool reset) const;
+        std::int64_t get_num_stolen_from_numa_domain(bool reset) const;
+        std::int64_t get_num_stolen_from_remote_domains(bool reset) const;
+        std::int64_t get_average_tasks_per_steal(bool reset) const;
 #endif
 
     private:
         policies::thread_queue_init_parameters get_init_parameters() const;
+        void create_elasticity_controller();
         void create_scheduler_user_defined(
             hpx::resource::scheduler_function const&,
             thread_pool_init_parameters const&,
@@ -293,6 +301,12 @@ namespace hpx::threads {
         void create_scheduler_local_priority_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_chase_lev(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_critical_path(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static(thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static_priority(
@@ -327,6 +341,10 @@ namespace hpx::threads {
 #endif
         pool_vector pools_;
 
+        // optionally adapts the number of active processing units of the
+        // pools to their load
+        std::unique_ptr<elasticity_controller> elasticity_controller_;
+
         notification_policy_type& notifier_;
         detail::network_background_callback_type network_background_callback_;
     };
@@ -21,7 +21,10 @@
 #include <hpx/modules/type_support.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/string_util/classification.hpp>
+#include <hpx/string_util/split.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
+#include <hpx/thread_pools/elasticity_controller.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -31,6 +34,8 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/get_entry_as.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -129,8 +134,15 @@ namespace hpx::threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        std::int64_t const max_thread_heap_size =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_thread_heap_size",
+                HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
+        std::int64_t const idle_yield_count =
+            hpx::util::get_entry_as<std::int64_t>(
+                rtcfg_, "hpx.idle_yield_count", HPX_IDLE_BACKOFF_YIELD_COUNT);
 
         std::ptrdiff_t const small_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::small_);
@@ -146,7 +158,8 @@ namespace hpx::threads {
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, max_thread_heap_size,
+            idle_yield_count);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -277,6 +290,87 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_priority_chase_lev(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t const numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_queue_scheduler-chase-lev");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
+    void threadmanager::create_scheduler_local_priority_critical_path(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t const numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_critical_path,
+                hpx::threads::policies::lockfree_critical_path>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_queue_scheduler-critical-path");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_static(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -476,6 +570,22 @@ namespace hpx::threads {
             thread_pool_init.affinity_data_, thread_queue_init,
             "core-shared_priority_queue_scheduler");
 
+        // configure the steal hierarchy
+        policies::steal_hierarchy_parameters& steal = init.steal_hierarchy_;
+        steal.cache_level = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.steal_cache_level", steal.cache_level);
+
+        char const* const level_names[] = {"siblings", "numa", "remote"};
+        for (std::size_t l = 0; l != policies::num_steal_levels; ++l)
+        {
+            std::string const prefix =
+                std::string("hpx.thread_queue.steal_") + level_names[l];
+            steal.levels[l].backoff = hpx::util::get_entry_as<std::size_t>(
+                rtcfg_, prefix + "_backoff", steal.levels[l].backoff);
+            steal.levels[l].batch_size = hpx::util::get_entry_as<std::size_t>(
+                rtcfg_, prefix + "_batch_size", steal.levels[l].batch_size);
+        }
+
         auto sched = std::make_unique<local_sched_type>(init);
 
         // set the default scheduler flags
@@ -512,10 +622,12 @@ namespace hpx::threads {
         using local_sched_type =
             hpx::threads::policies::local_workrequesting_scheduler<>;
 
-        local_sched_type::init_parameter_type const init(
+        local_sched_type::init_parameter_type init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
             "core-local_workrequesting_scheduler-fifo");
+        init.steal_half_ = hpx::util::get_entry_as<int>(
+                               rtcfg_, "hpx.thread_queue.steal_half", 0) != 0;
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -560,10 +672,12 @@ namespace hpx::threads {
             hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
                 hpx::threads::policies::concurrentqueue_fifo>;
 
-        local_sched_type::init_parameter_type const init(
+        local_sched_type::init_parameter_type init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
             "core-local_workrequesting_scheduler-mc");
+        init.steal_half_ = hpx::util::get_entry_as<int>(
+                               rtcfg_, "hpx.thread_queue.steal_half", 0) != 0;
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -609,10 +723,12 @@ namespace hpx::threads {
             hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
                 hpx::threads::policies::lockfree_lifo>;
 
-        local_sched_type::init_parameter_type const init(
+        local_sched_type::init_parameter_type init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
             "core-local_workrequesting_scheduler-lifo");
+        init.steal_half_ = hpx::util::get_entry_as<int>(
+                               rtcfg_, "hpx.thread_queue.steal_half", 0) != 0;
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -772,6 +888,16 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_priority_chase_lev:
+                create_scheduler_local_priority_chase_lev(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
+            case resource::scheduling_policy::local_priority_critical_path:
+                create_scheduler_local_priority_critical_path(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::static_:
                 create_scheduler_static(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -832,6 +958,76 @@ namespace hpx::threads {
                 threads_lookup_.emplace_back(pool_iter->get_pool_id());
             }
         }
+
+        create_elasticity_controller();
+    }
+
+    void threadmanager::create_elasticity_controller()
+    {
+        if (hpx::util::get_entry_as<int>(rtcfg_, "hpx.elasticity.enable", 0) ==
+            0)
+        {
+            return;
+        }
+
+        elasticity_parameters params;
+        params.interval =
+            std::chrono::milliseconds(hpx::util::get_entry_as<std::int64_t>(
+                rtcfg_, "hpx.elasticity.interval", params.interval.count()));
+        params.min_threads = hpx::util::get_entry_as<std::size_t>(
+            rtcfg_, "hpx.elasticity.min_threads", params.min_threads);
+        params.max_threads = hpx::util::get_entry_as<std::size_t>(
+            rtcfg_, "hpx.elasticity.max_threads", params.max_threads);
+        params.grow_queue_length = hpx::util::get_entry_as<double>(rtcfg_,
+            "hpx.elasticity.grow_queue_length", params.grow_queue_length);
+        params.shrink_utilization = hpx::util::get_entry_as<double>(rtcfg_,
+            "hpx.elasticity.shrink_utilization", params.shrink_utilization);
+        params.hysteresis = hpx::util::get_entry_as<std::size_t>(
+            rtcfg_, "hpx.elasticity.hysteresis", params.hysteresis);
+
+        if (params.interval.count() <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "threadmanager::create_elasticity_controller",
+                "hpx.elasticity.interval must be positive, got {}",
+                params.interval.count());
+        }
+
+        // an empty list of pools selects all pools
+        std::vector<std::string> pool_names;
+        std::string const pools =
+            rtcfg_.get_entry("hpx.elasticity.pools", std::string());
+        hpx::string_util::split(pool_names, pools,
+            hpx::string_util::is_any_of(", "),
+            hpx::string_util::token_compress_mode::on);
+        pool_names.erase(std::remove(pool_names.begin(), pool_names.end(),
+                             std::string()),
+            pool_names.end());
+
+        auto controller = std::make_unique<elasticity_controller>(params);
+        for (auto const& pool_iter : pools_)
+        {
+            if (!pool_names.empty() &&
+                std::find(pool_names.begin(), pool_names.end(),
+                    pool_iter->get_pool_name()) == pool_names.end())
+            {
+                continue;
+            }
+
+            // suspending processing units requires the scheduler to avoid
+            // scheduling work on them
+            if (policies::scheduler_base* sched = pool_iter->get_scheduler())
+            {
+                sched->add_scheduler_mode(
+                    policies::scheduler_mode::enable_elasticity);
+                controller->add_pool(*pool_iter);
+            }
+        }
+
+        if (!controller->empty())
+        {
+            elasticity_controller_ = HPX_MOVE(controller);
+        }
     }
 
     threadmanager::~threadmanager() = default;
@@ -1364,6 +1560,22 @@ namespace hpx::threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_num_allocated_threads(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_allocated_threads(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_reused_threads(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_reused_threads(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     std::int64_t threadmanager::get_thread_duration(bool reset) const
     {
@@ -1466,6 +1678,44 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_from_siblings(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_siblings(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_numa_domain(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_remote_domains(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_remote_domains(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_tasks_per_steal(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_average_tasks_per_steal(all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1507,6 +1757,9 @@ namespace hpx::threads {
                 sched->set_all_states(hpx::state::running);
         }
 
+        if (elasticity_controller_)
+            elasticity_controller_->start();
+
         LTM_(info).format("run: running");
         return true;
     }
@@ -1515,6 +1768,10 @@ namespace hpx::threads {
     {
         LTM_(info).format("stop: blocking({})", blocking ? "true" : "false");
 
+        // the elasticity controller must not touch the pools anymore
+        if (elasticity_controller_)
+            elasticity_controller_->stop();
+
         std::unique_lock<mutex_type> lk(mtx_);
         for (auto const& pool_iter : pools_)
         {
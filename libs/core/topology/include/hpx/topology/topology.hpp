@@ -275,6 +275,17 @@ namespace hpx::threads {
         /// Return the size of the cache associated with the given mask.
         std::size_t get_cache_size(mask_cref_type mask, int level) const;
 
+        /// \brief Return the (logical) number of the cache of the given level
+        ///        the processing unit the given thread is running on is
+        ///        attached to.
+        ///
+        /// \param num_thread [in]
+        /// \param level      [in] the cache level (1 to 5)
+        ///
+        /// \returns std::size_t(-1) if the requested cache level is not
+        ///          available.
+        std::size_t get_cache_number(std::size_t num_thread, int level) const;
+
         mask_type get_cpubind_mask(error_code& ec = throws) const;
         mask_type get_cpubind_mask(
             std::thread& handle, error_code& ec = throws) const;
@@ -1552,6 +1552,71 @@ namespace hpx::threads {
         return cache_size;
     }
 
+    std::size_t topology::get_cache_number(
+        std::size_t num_thread, int level) const
+    {
+        if (level < 1 || level > 5 ||
+            static_cast<std::size_t>(-1) == num_thread)
+        {
+            return static_cast<std::size_t>(-1);
+        }
+
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        std::unique_lock<mutex_type> lk(topo_mtx);
+
+        hwloc_obj_t const pu_obj = hwloc_get_obj_by_type(
+            topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+        if (pu_obj == nullptr)
+        {
+            return static_cast<std::size_t>(-1);
+        }
+
+#if HWLOC_API_VERSION >= 0x00020000
+        hwloc_obj_type_t type = HWLOC_OBJ_L1CACHE;
+        switch (level)
+        {
+        case 2:
+            type = HWLOC_OBJ_L2CACHE;
+            break;
+
+        case 3:
+            type = HWLOC_OBJ_L3CACHE;
+            break;
+
+        case 4:
+            type = HWLOC_OBJ_L4CACHE;
+            break;
+
+        case 5:
+            type = HWLOC_OBJ_L5CACHE;
+            break;
+
+        default:
+            break;
+        }
+
+        hwloc_obj_t const cache_obj =
+            hwloc_get_ancestor_obj_by_type(topo, type, pu_obj);
+        if (cache_obj != nullptr)
+        {
+            return static_cast<std::size_t>(cache_obj->logical_index);
+        }
+#else
+        // traverse up until found the requested cache level
+        for (hwloc_obj_t obj = pu_obj->parent; obj != nullptr;
+             obj = obj->parent)
+        {
+            if (obj->type == HWLOC_OBJ_CACHE &&
+                obj->attr->cache.depth == static_cast<unsigned>(level))
+            {
+                return static_cast<std::size_t>(obj->logical_index);
+            }
+        }
+#endif
+        return static_cast<std::size_t>(-1);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hwloc_bitmap_t topology::mask_to_bitmap(
         mask_cref_type mask, hwloc_obj_type_t htype) const
@@ -7,4 +7,6 @@
 #pragma once
 
 #include <hpx/parallel/algorithms/make_heap.hpp>
+#include <hpx/parallel/algorithms/pop_heap_n.hpp>
+#include <hpx/parallel/algorithms/push_heap_n.hpp>
 #include <hpx/parallel/container_algorithms/make_heap.hpp>
@@ -7,4 +7,5 @@
 #pragma once
 
 #include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/merge_k.hpp>
 #include <hpx/parallel/container_algorithms/merge.hpp>
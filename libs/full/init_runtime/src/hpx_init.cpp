@@ -427,6 +427,18 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+            {
+                namespace posix = threads::coroutines::detail::posix;
+                posix::use_stack_arenas = cmdline.rtcfg_.use_stack_arenas();
+                posix::use_huge_page_stacks =
+                    cmdline.rtcfg_.use_huge_page_stacks();
+                posix::stack_arena_size = cmdline.rtcfg_.get_stack_arena_size();
+                posix::stack_reclamation =
+                    posix::parse_stack_reclamation_policy(
+                        cmdline.rtcfg_.get_stack_reclamation_policy());
+                posix::stack_resident_watermark =
+                    cmdline.rtcfg_.get_stack_resident_watermark();
+            }
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
@@ -327,6 +327,16 @@ namespace hpx::performance_counters::detail {
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                         get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-page-faults
+            {"count/stack-page-faults",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                        get_stack_page_fault_count),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-resident-bytes
+            {"count/stack-resident-bytes",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                        get_stack_resident_bytes),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -436,6 +446,24 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_executed_thread_phases,
                     &threads::thread_pool_base::get_executed_thread_phases),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/objects-allocated",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-thread objects (including "
+                "their stacks) newly allocated for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_allocated_threads,
+                    &threads::thread_pool_base::get_num_allocated_threads),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/objects-reused",
+                counter_type::monotonically_increasing,
+                "returns the overall number of recycled HPX-thread objects "
+                "reused for new HPX-threads for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_reused_threads,
+                    &threads::thread_pool_base::get_num_reused_threads),
+                &locality_pool_thread_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
             {"/threads/time/average", counter_type::average_timer,
                 "returns the average time spent executing one HPX-thread",
@@ -614,6 +642,17 @@ namespace hpx::performance_counters {
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
+            {"/threads/count/stack-page-faults",
+                counter_type::monotonically_increasing,
+                "returns the (estimated) number of HPX-thread stack pages "
+                "faulted in for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-resident-bytes", counter_type::raw,
+                "returns the number of bytes of all HPX-thread stacks known "
+                "to be resident for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
 #endif
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
@@ -677,6 +716,49 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-siblings",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen by the "
+                "referenced worker-thread from cores sharing a cache with it "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_from_siblings,
+                    &threads::thread_pool_base::get_num_stolen_from_siblings),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen by the "
+                "referenced worker-thread from other cores of its NUMA domain "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_numa_domain,
+                    &threads::thread_pool_base::
+                        get_num_stolen_from_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-remote-domains",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen by the "
+                "referenced worker-thread from cores of other NUMA domains "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_remote_domains,
+                    &threads::thread_pool_base::
+                        get_num_stolen_from_remote_domains),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/tasks-per-steal", counter_type::average_count,
+                "returns the average number of HPX-threads transferred by a "
+                "single successful steal request of the referenced "
+                "worker-thread for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_average_tasks_per_steal,
+                    &threads::thread_pool_base::get_average_tasks_per_steal),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
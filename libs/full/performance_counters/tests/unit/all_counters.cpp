@@ -43,6 +43,8 @@ char const* const locality_pool_thread_counter_names[] =
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
     "/threads/count/cumulative",
     "/threads/count/cumulative-phases",
+    "/threads/count/objects-allocated",
+    "/threads/count/objects-reused",
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     "/threads/time/average",
     "/threads/time/average-phase",
@@ -59,6 +61,10 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/count/stolen-from-siblings",
+    "/threads/count/stolen-from-numa-domain",
+    "/threads/count/stolen-from-remote-domains",
+    "/threads/count/tasks-per-steal",
 #endif
     nullptr
 };
@@ -82,6 +88,8 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-recycles",
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
+    "/threads/count/stack-page-faults",
+    "/threads/count/stack-resident-bytes",
 #endif
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
@@ -12,6 +12,7 @@
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -35,8 +36,14 @@ std::uint64_t payload = 0;
 std::uint64_t contexts = 1000;
 std::uint64_t iterations = 100000;
 std::uint64_t seed = 0;
+std::uint64_t stack_usage = 0;
 bool header = true;
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS) && !defined(HPX_WINDOWS) &&           \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
+#define HPX_COROUTINES_CALL_OVERHEAD_STACK_COUNTERS
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 std::string format_build_date()
 {
@@ -51,7 +58,7 @@ std::string format_build_date()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void print_results(double w_M)
+void print_results(double w_M, std::int64_t page_faults)
 {
     if (header)
     {
@@ -69,7 +76,12 @@ void print_results(double w_M)
                 "## 2:CTXS:# of Contexts - Independent Variable\n"
                 "## 3:ITER:# of Iterations - Independent Variable\n"
                 "## 4:SEED:PRNG seed - Independent Variable\n"
-                "## 5:WTIME_CS:Walltime/Context Switch [nano-seconds]\n";
+                "## 5:STACK:Stack usage [bytes] - Independent Variable\n"
+                "## 6:WTIME_CS:Walltime/Context Switch [nano-seconds]\n";
+#if defined(HPX_COROUTINES_CALL_OVERHEAD_STACK_COUNTERS)
+        cout << "## 7:STKFLT:Stack page faults\n"
+                "## 8:STKRES:Resident stack size [bytes]\n";
+#endif
     }
 
     std::uint64_t const os_thread_count = hpx::get_os_thread_count();
@@ -78,22 +90,44 @@ void print_results(double w_M)
     //     double E = w_T/w_M;
     double O = w_M - w_T;
 
-    hpx::util::format_to(cout, "{} {} {} {} {} {:.14g}", payload,
-        os_thread_count, contexts, iterations, seed,
+    hpx::util::format_to(cout, "{} {} {} {} {} {} {:.14g}", payload,
+        os_thread_count, contexts, iterations, seed, stack_usage,
         (O / (2 * iterations * os_thread_count)) * 1e9);
 
+#if defined(HPX_COROUTINES_CALL_OVERHEAD_STACK_COUNTERS)
+    hpx::util::format_to(cout, " {} {}", page_faults,
+        coroutine_type::impl_type::get_stack_resident_bytes(false));
+#else
+    (void) page_faults;
+#endif
+
     cout << "\n";
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+// touch the given number of bytes of the coroutine stack
+HPX_NOINLINE std::uint64_t touch_stack(std::uint64_t bytes)
+{
+    if (bytes == 0)
+        return 0;
+
+    volatile char buffer[1024];
+    buffer[0] = static_cast<char>(bytes);
+    buffer[sizeof(buffer) - 1] = static_cast<char>(bytes);
+
+    std::uint64_t const chunk = (std::min) (bytes, std::uint64_t(1024));
+    return buffer[0] + touch_stack(bytes - chunk);
+}
+
 struct kernel
 {
     hpx::threads::thread_result_type operator()(thread_restart_state) const
     {
         worker_timed(payload * 1000);
+        touch_stack(stack_usage);
 
         return hpx::threads::thread_result_type(
-            hpx::threads::thread_schedule_state::pending,
+            hpx::threads::thread_schedule_state::terminated,
             hpx::threads::invalid_thread_id);
     }
 
@@ -126,18 +160,26 @@ double perform_2n_iterations()
     for (std::uint64_t i = 0; i < iterations; ++i)
         indices.push_back(dist(prng));
 
+    // Each invocation runs the kernel to completion, which resets the stack
+    // of the coroutine (as done for terminated HPX threads). The coroutine
+    // is then rebound to a new kernel (as done for recycled HPX threads).
+    auto invoke = [&](coroutine_type* c) {
+        (*c)(wait_signaled);
+        c->rebind(k, hpx::threads::invalid_thread_id);
+    };
+
     ///////////////////////////////////////////////////////////////////////
     // Warmup
     for (std::uint64_t i = 0; i < iterations; ++i)
     {
-        (*coroutines[indices[i]])(wait_signaled);
+        invoke(coroutines[indices[i]]);
     }
 
     hpx::chrono::high_resolution_timer t;
 
     for (std::uint64_t i = 0; i < iterations; ++i)
     {
-        (*coroutines[indices[i]])(wait_signaled);
+        invoke(coroutines[indices[i]]);
     }
 
     double elapsed = t.elapsed();
@@ -165,6 +207,10 @@ int hpx_main(variables_map& vm)
 
         std::vector<hpx::shared_future<double>> futures;
 
+#if defined(HPX_COROUTINES_CALL_OVERHEAD_STACK_COUNTERS)
+        coroutine_type::impl_type::get_stack_page_fault_count(true);
+#endif
+
         std::uint64_t num_thread = hpx::get_worker_thread_num();
 
         for (std::uint64_t i = 0; i < os_thread_count; ++i)
@@ -180,7 +226,13 @@ int hpx_main(variables_map& vm)
         for (std::uint64_t i = 0; i < futures.size(); ++i)
             total_elapsed += futures[i].get();
 
-        print_results(total_elapsed);
+#if defined(HPX_COROUTINES_CALL_OVERHEAD_STACK_COUNTERS)
+        std::int64_t const page_faults = static_cast<std::int64_t>(
+            coroutine_type::impl_type::get_stack_page_fault_count(true));
+#else
+        std::int64_t const page_faults = 0;
+#endif
+        print_results(total_elapsed, page_faults);
     }
 
     return hpx::finalize();
@@ -210,7 +262,13 @@ int main(int argc, char* argv[])
                     "is "
                     "chosen based on the current system time)")
 
-                    ("no-header", "do not print out the header");
+                    ("stack-usage",
+                        value<std::uint64_t>(&stack_usage)->default_value(0),
+                        "number of stack bytes touched by each coroutine "
+                        "(use together with --hpx:ini=hpx.stacks.* to compare "
+                        "stack allocation and reclamation policies)")
+
+                        ("no-header", "do not print out the header");
 
     // Initialize and run HPX.
     hpx::init_params init_args;
@@ -318,6 +318,57 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
         executor_name ? executor_name : exec_name(exec), count, duration, csv);
 }
 
+// Time attaching continuations to futures which are made ready afterwards,
+// this measures the overhead of the shared state itself
+void measure_function_futures_then_chain(
+    std::uint64_t count, bool csv, bool use_arena)
+{
+    auto const inc = [](future<double>&& r) { return r.get() + 1.0; };
+
+    // the shared states of all continuations of a chain are allocated from
+    // the arena, the memory is reused for the next chain
+    hpx::experimental::continuation_arena arena;
+
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::promise<double> p = use_arena ?
+            hpx::promise<double>(std::allocator_arg, arena.get_allocator()) :
+            hpx::promise<double>();
+        future<double> f = p.get_future()
+                               .then(hpx::launch::sync, inc)
+                               .then(hpx::launch::sync, inc);
+        p.set_value(null_function());
+        global_scratch = global_scratch + f.get();
+    }
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+    print_stats("then", "chain", use_arena ? "sync-arena" : "sync",
+        static_cast<std::int64_t>(count), duration, csv);
+}
+
+// Time calling get() on futures which are not ready yet, this measures the
+// overhead of suspending on the shared state
+template <typename Executor>
+void measure_function_futures_blocking_get(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        future<double> f = async(exec, &null_function);
+        global_scratch = global_scratch + f.get();
+    }
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+    print_stats("get", "blocking", exec_name(exec),
+        static_cast<std::int64_t>(count), duration, csv);
+}
+
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
     hpx::latch l(static_cast<std::int64_t>(count));
@@ -539,6 +590,9 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
                 measure_function_futures_for_loop(
                     count, csv, par_nostack, "parallel_executor_nostack");
+                measure_function_futures_then_chain(count, csv, false);
+                measure_function_futures_then_chain(count, csv, true);
+                measure_function_futures_blocking_get(count, csv, par);
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
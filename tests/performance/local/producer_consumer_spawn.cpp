@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of spawning tasks from a single producer
+// which are executed (stolen) by the other worker threads. All tasks of a
+// batch stay alive until the whole batch has been spawned, which forces the
+// queue of the producer to provide a thread object (and stack) for each of
+// them. Every --burst-interval rounds a batch of --burst-tasks tasks is
+// spawned instead, after which the recycled threads of the producer's queue
+// are trimmed down to hpx.thread_queue.max_thread_heap_size.
+//
+// For each round the elapsed time and the number of newly allocated and
+// reused thread objects are printed, e.g.:
+//
+//     producer_consumer_spawn --tasks=10000 --burst-tasks=100000
+//         --hpx:ini=hpx.thread_queue.max_thread_heap_size=20000
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "activate_counters.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+double spawn_batch(std::uint64_t count)
+{
+    hpx::promise<void> go;
+    hpx::shared_future<void> f = go.get_future();
+
+    std::vector<hpx::future<void>> consumers;
+    consumers.reserve(count);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        consumers.push_back(hpx::async([f]() { f.get(); }));
+    }
+
+    go.set_value();
+    hpx::wait_all(consumers);
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto const tasks = vm["tasks"].as<std::uint64_t>();
+    auto const rounds = vm["rounds"].as<std::uint64_t>();
+    auto const burst_tasks = vm["burst-tasks"].as<std::uint64_t>();
+    auto const burst_interval = vm["burst-interval"].as<std::uint64_t>();
+
+    std::shared_ptr<hpx::util::activate_counters> ac;
+#if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
+    ac = std::make_shared<hpx::util::activate_counters>(
+        std::vector<std::string>{
+            "/threads{locality#0/total}/count/objects-allocated",
+            "/threads{locality#0/total}/count/objects-reused"});
+    ac->reset_counters();
+#endif
+
+    std::cout << "round, tasks, time [s], allocated, reused\n";
+
+    for (std::uint64_t round = 0; round != rounds; ++round)
+    {
+        std::uint64_t const count =
+            (burst_tasks != 0 && burst_interval != 0 &&
+                round % burst_interval == 0) ?
+            burst_tasks :
+            tasks;
+
+        double const elapsed = spawn_batch(count);
+
+        std::int64_t allocated = 0;
+        std::int64_t reused = 0;
+        if (ac)
+        {
+            auto const values = ac->evaluate_counters(hpx::launch::sync, true);
+            allocated = values[0].get_value<std::int64_t>();
+            reused = values[1].get_value<std::int64_t>();
+        }
+
+        hpx::util::format_to(std::cout, "{}, {}, {:.14g}, {}, {}\n", round,
+            count, elapsed, allocated, reused);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", value<std::uint64_t>()->default_value(10000),
+         "number of tasks spawned by the producer per round")
+        ("rounds", value<std::uint64_t>()->default_value(20),
+         "number of rounds to run")
+        ("burst-tasks", value<std::uint64_t>()->default_value(0),
+         "number of tasks spawned in burst rounds (default: no bursts)")
+        ("burst-interval", value<std::uint64_t>()->default_value(10),
+         "number of rounds between two burst rounds")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
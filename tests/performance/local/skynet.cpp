@@ -16,13 +16,20 @@
 
 // This code implements two versions of the skynet micro benchmark: a 'normal'
 // and a futurized one.
+//
+// Use --compare-queuing to run the benchmark once for each of the given
+// scheduling policies, e.g.:
+//
+//     skynet_test --compare-queuing local-priority-fifo local-priority-chase-lev
 
 #include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
 
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -111,5 +118,46 @@ int hpx_main()
 
 int main(int argc, char* argv[])
 {
-    return hpx::local::init(hpx_main, argc, argv);
+    hpx::program_options::options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("compare-queuing",
+         hpx::program_options::value<std::vector<std::string>>()
+            ->multitoken(),
+         "run the benchmark once for each of the given scheduling policies "
+         "(see --hpx:queuing)")
+        ;
+    // clang-format on
+
+    hpx::program_options::variables_map vm;
+    hpx::program_options::store(
+        hpx::program_options::command_line_parser(argc, argv)
+            .allow_unregistered()
+            .options(desc_commandline)
+            .run(),
+        vm);
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    if (!vm.count("compare-queuing"))
+    {
+        return hpx::local::init(hpx_main, argc, argv, init_args);
+    }
+
+    for (auto const& queuing :
+        vm["compare-queuing"].as<std::vector<std::string>>())
+    {
+        std::cout << "Scheduler: " << queuing << "\n";
+
+        init_args.cfg = {"hpx.scheduler=" + queuing};
+        if (int const result = hpx::local::init(hpx_main, argc, argv, init_args);
+            result != 0)
+        {
+            return result;
+        }
+    }
+    return 0;
 }
@@ -6,8 +6,12 @@
 
 // This example benchmarks the time it takes to start and stop the HPX runtime.
 // This is meant to be compared to resume_suspend and openmp_parallel_region.
+// If coroutine counters are enabled, the stack page faults and the resident
+// stack size are reported as well, which allows for comparing the stack
+// allocation and reclamation policies (see hpx.stacks.*).
 
 #include <hpx/chrono.hpp>
+#include <hpx/coroutines/coroutine.hpp>
 #include <hpx/execution.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
@@ -18,6 +22,11 @@
 #include <cstdint>
 #include <iostream>
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS) && !defined(HPX_WINDOWS) &&           \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
+#define HPX_START_STOP_STACK_COUNTERS
+#endif
+
 int hpx_main()
 {
     return hpx::finalize();
@@ -47,7 +56,11 @@ int main(int argc, char** argv)
     std::uint64_t threads = hpx::resource::get_num_threads("default");
     hpx::stop();
 
-    std::cout << "threads, resume [s], apply [s], suspend [s]" << std::endl;
+    std::cout << "threads, resume [s], apply [s], suspend [s]"
+#if defined(HPX_START_STOP_STACK_COUNTERS)
+              << ", stack page faults, resident stack [bytes]"
+#endif
+              << std::endl;
 
     double start_time = 0;
     double stop_time = 0;
@@ -71,12 +84,25 @@ int main(int argc, char** argv)
 
         auto t_apply = timer.elapsed();
 
+#if defined(HPX_START_STOP_STACK_COUNTERS)
+        using coroutine_impl = hpx::threads::coroutines::coroutine::impl_type;
+
+        // sample before stopping the runtime, which releases all stacks
+        auto const resident_stack =
+            coroutine_impl::get_stack_resident_bytes(false);
+#endif
+
         hpx::stop();
         auto t_stop = timer.elapsed();
         stop_time += t_stop;
 
         std::cout << threads << ", " << t_start << ", " << t_apply << ", "
-                  << t_stop << std::endl;
+                  << t_stop
+#if defined(HPX_START_STOP_STACK_COUNTERS)
+                  << ", " << coroutine_impl::get_stack_page_fault_count(true)
+                  << ", " << resident_stack
+#endif
+                  << std::endl;
     }
     hpx::util::print_cdash_timing("StartTime", start_time);
     hpx::util::print_cdash_timing("StopTime", stop_time);
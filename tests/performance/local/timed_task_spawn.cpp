@@ -113,6 +113,8 @@ void print_results(std::uint64_t cores, double walltime, double warmup_estimate,
 
         cout << "# VERSION: " << HPX_HAVE_GIT_COMMIT << " "
              << format_build_date() << "\n"
+             << "# SCHEDULER: " << hpx::get_config_entry("hpx.scheduler", "")
+             << "\n"
              << "#\n";
 
         // Note that if we change the number of fields above, we have to
@@ -442,6 +444,20 @@ int hpx_main(variables_map& vm)
             }
         }
 
+#if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
+        // report how many of the spawned tasks required a new thread object
+        // (and stack) as opposed to reusing a recycled one
+        if (vm.count("thread-recycling"))
+        {
+            counter_shortnames.emplace_back("ALLOCATED");
+            counters.emplace_back(
+                "/threads{locality#0/total}/count/objects-allocated");
+            counter_shortnames.emplace_back("REUSED");
+            counters.emplace_back(
+                "/threads{locality#0/total}/count/objects-reused");
+        }
+#endif
+
         std::shared_ptr<hpx::util::activate_counters> ac;
         if (!counters.empty())
         {
@@ -548,17 +564,50 @@ int main(int argc, char* argv[])
         , value<std::vector<std::string> >()->composing()
         , "activate and report the specified performance counter")
 
+        ( "thread-recycling"
+        , "report the number of newly allocated and reused thread objects "
+          "(requires HPX_WITH_THREAD_CUMULATIVE_COUNTS)")
+
         ( "no-header"
         , "do not print out the header")
 
         ( "csv-header"
         , "print out csv header")
+
+        ( "compare-queuing"
+        , value<std::vector<std::string> >()->multitoken()
+        , "run the benchmark once for each of the given scheduling policies "
+          "(see --hpx:queuing)")
         ;
     // clang-format on
 
+    variables_map vm;
+    hpx::program_options::store(
+        hpx::program_options::command_line_parser(argc, argv)
+            .allow_unregistered()
+            .options(cmdline)
+            .run(),
+        vm);
+
     // Initialize and run HPX.
     hpx::init_params init_args;
     init_args.desc_cmdline = cmdline;
 
-    return hpx::init(argc, argv, init_args);
+    if (!vm.count("compare-queuing"))
+    {
+        return hpx::init(argc, argv, init_args);
+    }
+
+    // Run the benchmark once per scheduling policy, the results are printed
+    // with a header naming the scheduler in use.
+    for (auto const& queuing :
+        vm["compare-queuing"].as<std::vector<std::string> >())
+    {
+        init_args.cfg = {"hpx.scheduler=" + queuing};
+        if (int const result = hpx::init(argc, argv, init_args); result != 0)
+        {
+            return result;
+        }
+    }
+    return 0;
 }